@@ -39,6 +39,15 @@ import org.slf4j.LoggerFactory;
 
 import java.io.File;
 import java.io.FileNotFoundException;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Paths;
+import java.nio.file.StandardOpenOption;
+import java.util.Arrays;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.Scanner;
@@ -61,6 +70,8 @@ public class PcapData {
      *  ts, ip_src, ip_dst, protocol, pkt_len, ip_len_tot, ip_len_hdr, ip_len_pld, tr_len_hdr, tr_len_pld, port_src, port_dst, seq, ack, win
      *  0     1       2        3         4         5            6           7           8            9          10       11     12   13   14
      * (where seq, ack, win are valid for TCP packets only)
+     * A binary pre-parsed trace (generated from the pcap file by WindFlow/HeavyHitter/pcap2trace.out)
+     * is also accepted and read directly, producing exactly the same fields.
      *
      * Output field sequence:
      * - first field is the pcap timestamp
@@ -71,6 +82,10 @@ public class PcapData {
      * @return a list of String sequences containing the parsed information ({@code ArrayList<String[]>})
      */
     public static ArrayList<String[]> parseDataset(String input_file) {
+        if (isTraceFile(input_file)) {
+            parseTrace(input_file);
+            return new ArrayList<>(PACKETS);
+        }
         try {
             long generated = 0;
             Scanner scan = new Scanner(new File(input_file));
@@ -102,6 +117,76 @@ public class PcapData {
         }
     }
 
+    /* binary pre-parsed trace format (see WindFlow/HeavyHitter/includes/parser/trace_file.hpp) */
+    private static final byte[] TRACE_MAGIC = {'H', 'H', 'T', 'R', 'A', 'C', 'E', 0};
+    private static final int TRACE_DATA_OFFSET = 64;
+    private static final int TRACE_RECORD_SIZE = 40;
+    private static final int TRACE_MAX_VERSION = 3;     // version 2 lists the IPv6 pairs after the records, version 3 marks their hashes
+
+    /**
+     * Checks whether the input file is a binary pre-parsed trace (generated by pcap2trace) instead of a csv file.
+     * @param input_file path of the input file
+     * @return true if the file starts with the trace magic number
+     */
+    private static boolean isTraceFile(String input_file) {
+        try (FileInputStream in = new FileInputStream(input_file)) {
+            byte[] magic = new byte[TRACE_MAGIC.length];
+            return in.read(magic) == magic.length && Arrays.equals(magic, TRACE_MAGIC);
+        } catch (IOException e) {
+            return false;
+        }
+    }
+
+    /**
+     * Reads the packets of a binary pre-parsed trace and populates the source dataset.
+     * The resulting fields are identical to the ones extracted from the csv file generated from the same pcap.
+     * The address fields of the IPv6 packets only hold a hash of their address pair, so a trace listing
+     * IPv6 pairs in its header is rejected rather than reported with the hash halves as IPv4 addresses.
+     *
+     * Record layout (40 bytes, little-endian, addresses/ports/ip_len in network representation):
+     *  ts(8) ip_src(4) ip_dst(4) seq(4) ack(4) port_src(2) port_dst(2) ip_len(2) win(2) ip_hdrlen(1) tcp_hdrlen(1) protocol(1) syn(1) reserved(4)
+     *
+     * @param input_file path of the input trace file
+     */
+    private static void parseTrace(String input_file) {
+        try (FileChannel channel = FileChannel.open(Paths.get(input_file), StandardOpenOption.READ)) {
+            ByteBuffer hdr = ByteBuffer.allocate(TRACE_DATA_OFFSET).order(ByteOrder.LITTLE_ENDIAN);
+            channel.read(hdr, 0);
+            final int version = hdr.getInt(8);
+            if (version < 1 || version > TRACE_MAX_VERSION || hdr.getInt(12) != TRACE_RECORD_SIZE)
+                throw new RuntimeException("The file '" + input_file + "' has an unsupported trace format");
+            if (hdr.getLong(40) != 0)
+                throw new RuntimeException("The file '" + input_file + "' carries IPv6 packets, which are only supported by the WindFlow variant");
+            final long records = hdr.getLong(16);
+
+            // map the records in chunks (a MappedByteBuffer is limited to 2 GB)
+            final long chunk = Integer.MAX_VALUE / TRACE_RECORD_SIZE;
+            for (long first = 0; first < records; first += chunk) {
+                final int n = (int) Math.min(chunk, records - first);
+                MappedByteBuffer buf = channel.map(FileChannel.MapMode.READ_ONLY,
+                        TRACE_DATA_OFFSET + first * TRACE_RECORD_SIZE, (long) n * TRACE_RECORD_SIZE);
+                buf.order(ByteOrder.LITTLE_ENDIAN);
+                for (int i = 0; i < n; i++) {
+                    final int r = i * TRACE_RECORD_SIZE;
+                    // [timestamp, srcIP, dstIP, srcPort, dstPort, protocol, pktLen]
+                    String[] ordered_pkt = new String[]{
+                            Long.toString(buf.getLong(r)),
+                            Integer.toUnsignedString(buf.getInt(r + 8)),
+                            Integer.toUnsignedString(buf.getInt(r + 12)),
+                            Integer.toString(Short.reverseBytes(buf.getShort(r + 24)) & 0xffff),
+                            Integer.toString(Short.reverseBytes(buf.getShort(r + 26)) & 0xffff),
+                            Integer.toString(buf.get(r + 34) & 0xff),
+                            Integer.toString((Short.reverseBytes(buf.getShort(r + 28)) & 0xffff) + 18)};
+                    PACKETS.add(ordered_pkt);
+                }
+            }
+            LOG.debug("[PcapData] trace dataset size: " + PACKETS.size() + " packets");
+        } catch (IOException e) {
+            LOG.error("[PcapData] Failed to read the trace file {}", input_file);
+            throw new RuntimeException("Failed to read the trace file '" + input_file + "'");
+        }
+    }
+
     /**
      * Generates a formatted string representing the packet content.
      * @param packet packet (sequence of String fields) to print
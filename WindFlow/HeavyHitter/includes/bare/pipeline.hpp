@@ -0,0 +1,368 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    pipeline.hpp
+ *
+ *  @brief Bare-metal runtime of the heavy hitter pipeline on Iffq rings.
+ *
+ *  The same functors of the WindFlow topology (flow identifier, incremental accumulator,
+ *  detector and sink) run in dedicated threads, one per replica, bound to their placement or, by
+ *  default, to consecutive cores. Each replica is connected to every replica of the next operator
+ *  by a ring: the packets and the results are spread round-robin, while the flows are partitioned
+ *  by key among the accumulator replicas. There is no batching, no operator chaining and no
+ *  framework code between the functors, so the difference from the WindFlow run measures the
+ *  overhead of the runtime.
+ *
+ *  The accumulator keeps the time-based sliding windows of its flows (ingress time, as in the
+ *  WindFlow topology) and fires them on the watermark, the minimum over its inputs of the time up
+ *  to which every packet has been received: every item carries the watermark of its producer,
+ *  which for the sources is the generation time of the packet itself. Since the flows are
+ *  partitioned, an accumulator may receive no packets from a flow identifier for a long time:
+ *  every flow identifier also sends its watermark alone to all the accumulators when it has
+ *  advanced by a millisecond, so that the windows of every accumulator keep closing.
+ */
+
+#pragma once
+#ifndef HH_BARE_PIPELINE_HPP
+#define HH_BARE_PIPELINE_HPP
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <unistd.h>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "bare/ring.hpp"
+#include "nodes/source.hpp"
+#include "nodes/flow_identifier.hpp"
+#include "nodes/accumulator.hpp"
+#include "nodes/detector.hpp"
+#include "nodes/sink.hpp"
+#include "util/pacer.hpp"
+#include "util/placement.hpp"
+#include "util/registry.hpp"
+#include "util/tsc_clock.hpp"
+
+extern volatile unsigned long app_start_time;
+extern volatile unsigned long app_run_time;
+
+namespace bare {
+
+    /// item of a ring: tuple and watermark of the producer when it was sent
+    template<typename T>
+    struct item_t {
+        T tuple;
+        uint64_t watermark;     // nanoseconds
+        bool punctuation = false;   // only the watermark is meaningful
+    };
+
+    /**
+     * @class Pipeline
+     * @brief Source -> FlowIdentifier -> ByteLenAccumulator -> HeavyHitterDetector -> Sink on dedicated threads.
+     */
+    class Pipeline {
+    public:
+        /// parallelism of the operators
+        struct pardeg_t {
+            std::size_t source, flowid, acc, detector, sink;
+        };
+
+        static constexpr unsigned int RING_ENTRIES = 4096;
+        static constexpr uint64_t PUNCTUATION_NS = 1000000;    // advance of the watermark sent to all the accumulators
+
+    private:
+        template<typename T>
+        using mesh_t = std::vector<std::vector<std::unique_ptr<Ring<item_t<T>>>>>;     // [producer][consumer]
+
+        packets_t dataset;                  // replayed by every source replica (shared, read only)
+        pacer::Source_Pacer pacer;
+        std::function<void(std::size_t, std::size_t)> flowid_stage;     // replica of the flow identifier (specialised on the flow definition)
+        WinAcc_Inc_Functor acc_fun;
+        Detector_Functor detector_fun;
+        Sink_Functor<hh_result_t> sink_fun;
+        pardeg_t pardeg;
+        uint64_t win_ns;
+        uint64_t slide_ns;
+
+        mesh_t<packet_t> to_flowid;
+        mesh_t<flow_len_t> to_acc;
+        mesh_t<hh_result_t> to_detector;
+        mesh_t<hh_result_t> to_sink;
+
+        template<typename T>
+        static mesh_t<T> make_mesh(const std::size_t producers, const std::size_t consumers) {
+            mesh_t<T> mesh(producers);
+            for (auto& row : mesh) {
+                for (std::size_t c = 0; c < consumers; c++) row.push_back(std::make_unique<Ring<item_t<T>>>(RING_ENTRIES));
+            }
+            return mesh;
+        }
+
+        template<typename T>
+        static std::vector<Ring<item_t<T>>*> inputs_of(const mesh_t<T>& mesh, const std::size_t consumer) {
+            std::vector<Ring<item_t<T>>*> in;
+            for (const auto& row : mesh) in.push_back(row[consumer].get());
+            return in;
+        }
+
+        template<typename T>
+        static void close_all(const mesh_t<T>& mesh, const std::size_t producer) {
+            for (const auto& r : mesh[producer]) r->close();
+        }
+
+        /**
+         * @brief Consumes the items of the given rings until all of them are closed and empty.
+         *
+         * @param in input rings
+         * @param fn called with the index of the ring and each item
+         * @param closed called with the index of a ring when it has been closed and emptied
+         */
+        template<typename T, typename F, typename C>
+        static void drain(const std::vector<Ring<item_t<T>>*>& in, F&& fn, C&& closed) {
+            static constexpr int BURST = 32;        // items taken from a ring before moving to the next one
+            std::vector<bool> done(in.size(), false);
+            std::size_t open = in.size();
+            item_t<T> item;
+            while (open > 0) {
+                bool idle = true;
+                for (std::size_t i = 0; i < in.size(); i++) {
+                    if (done[i]) continue;
+                    int n = 0;
+                    while (n < BURST && in[i]->try_pop(item)) {
+                        fn(i, item);
+                        n++;
+                    }
+                    if (n > 0 || !in[i]->is_closed()) {
+                        idle = idle && (n == 0);
+                        continue;
+                    }
+                    if (in[i]->try_pop(item)) {     // pushed right before the ring was closed
+                        fn(i, item);
+                        idle = false;
+                    } else {
+                        done[i] = true;
+                        open--;
+                        closed(i);
+                    }
+                }
+                if (idle) cpu_relax();
+            }
+        }
+
+        /**
+         * @brief Places the thread of a replica (its placement, or the given core by default).
+         */
+        static void place(const std::string& op, const std::size_t replica, const std::size_t slot) {
+            if (!placement::placement.bind(op, replica)) {
+                const long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+                placement::placement.pin(op, replica, (int)(slot % std::max(n_cpus, 1L)));
+            }
+        }
+
+        void run_source(const std::size_t r, const std::size_t slot) {
+            place("Source", r, slot);
+            metrics::Replica_Stats* stats = metrics::registry.replica("Source", r);
+            pacer::Source_Pacer p(pacer);
+            std::vector<Ring<item_t<packet_t>>*> out;
+            for (const auto& ring : to_flowid[r]) out.push_back(ring.get());
+            std::size_t next = 0, dest = 0;
+            int generations = 0;
+            p.start();
+            tsc::Stamper stamper;
+            stamper.start();
+            while (!dataset.empty() && (stamper.time() - app_start_time <= app_run_time) && !Source_Functor::terminate) {
+                if (next == 0) {
+                    if (Source_Functor::replayed(generations)) break;
+                    if (generations++ > 0) p.next_generation();
+                }
+                packet_t t(dataset[next]);
+                if (const uint64_t now = p.pace(t.ts)) stamper.refresh(now);
+                t.ts = stamper.stamp();
+                out[dest]->push({t, stamper.time()});       // the watermark ignores the latency marker
+                if (++dest == out.size()) dest = 0;
+                if (++next == dataset.size()) next = 0;
+                stats->tuples_out.add();
+            }
+            stats->exec_time.set(tsc::now() - app_start_time);
+            close_all(to_flowid, r);
+        }
+
+        template<typename flowid_t>
+        void run_flowid(flowid_t fun, const std::size_t r, const std::size_t slot) {
+            place("FlowIdentifier", r, slot);
+            wf::RuntimeContext rc(pardeg.flowid, r);
+            std::vector<uint64_t> last(pardeg.source, 0);      // generation time of the last packet of each source
+            const auto& out = to_acc[r];
+            uint64_t broadcast = 0;     // watermark last sent to all the accumulators
+            drain(inputs_of(to_flowid, r), [&](const std::size_t i, const item_t<packet_t>& item) {
+                last[i] = item.watermark;
+                const flow_len_t f = fun(item.tuple, rc);
+                const uint64_t watermark = *std::min_element(last.begin(), last.end());
+                out[f.flow_key % out.size()]->push({f, watermark});
+                if (watermark >= broadcast + PUNCTUATION_NS) {     // also to the accumulators not receiving any flow of this replica
+                    for (const auto& ring : out) ring->push({flow_len_t(), watermark, true});
+                    broadcast = watermark;
+                }
+            }, [&](const std::size_t i) { last[i] = UINT64_MAX; });
+            close_all(to_acc, r);
+        }
+
+        void run_acc(const std::size_t r, const std::size_t slot) {
+            place("ByteLenAccumulator", r, slot);
+            WinAcc_Inc_Functor fun(acc_fun);
+            wf::RuntimeContext rc(pardeg.acc, r);
+            /// open windows of each flow (window w covers [w * slide, w * slide + win)) and their closing times
+            std::unordered_map<uint64_t, std::deque<std::pair<uint64_t, hh_result_t>>> windows;
+            using closing_t = std::tuple<uint64_t, uint64_t, uint64_t>;      // end, flow, window
+            std::priority_queue<closing_t, std::vector<closing_t>, std::greater<closing_t>> closing;
+            std::vector<uint64_t> wm(pardeg.flowid, 0);
+            const auto& out = to_detector[r];
+            std::size_t dest = 0;
+            auto fire = [&](const uint64_t watermark) {
+                while (!closing.empty() && std::get<0>(closing.top()) <= watermark) {
+                    const auto [end, key, w] = closing.top();
+                    closing.pop();
+                    auto& open = windows[key];
+                    auto it = std::lower_bound(open.begin(), open.end(), w, [](const auto& e, const uint64_t v) { return e.first < v; });
+                    out[dest]->push({it->second, watermark});
+                    if (++dest == out.size()) dest = 0;
+                    open.erase(it);
+                    if (open.empty()) windows.erase(key);
+                }
+            };
+            drain(inputs_of(to_acc, r), [&](const std::size_t i, const item_t<flow_len_t>& item) {
+                if (item.punctuation) {
+                    wm[i] = item.watermark;
+                    fire(*std::min_element(wm.begin(), wm.end()));
+                    return;
+                }
+                const uint64_t ts = item.tuple.ts;
+                auto& open = windows[item.tuple.flow_key];
+                const uint64_t first = (ts < win_ns) ? 0 : (ts - win_ns) / slide_ns + 1;
+                for (uint64_t w = first; w <= ts / slide_ns; w++) {
+                    auto it = std::lower_bound(open.begin(), open.end(), w, [](const auto& e, const uint64_t v) { return e.first < v; });
+                    if (it == open.end() || it->first != w) {   // first packet of the flow in the window
+                        it = open.insert(it, {w, hh_result_t()});
+                        closing.emplace(w * slide_ns + win_ns, item.tuple.flow_key, w);
+                    }
+                    fun(item.tuple, it->second, rc);
+                }
+                wm[i] = item.watermark;
+                fire(*std::min_element(wm.begin(), wm.end()));
+            }, [&](const std::size_t i) {
+                wm[i] = UINT64_MAX;
+                fire(*std::min_element(wm.begin(), wm.end()));
+            });
+            fire(UINT64_MAX);       // end of the stream: all the windows are closed
+            close_all(to_detector, r);
+        }
+
+        void run_detector(const std::size_t r, const std::size_t slot) {
+            place("HeavyHitterDetector", r, slot);
+            Detector_Functor fun(detector_fun);
+            wf::RuntimeContext rc(pardeg.detector, r);
+            const auto& out = to_sink[r];
+            std::size_t dest = 0;
+            drain(inputs_of(to_detector, r), [&](const std::size_t, const item_t<hh_result_t>& item) {
+                hh_result_t t(item.tuple);
+                if (!fun(t, rc)) return;
+                out[dest]->push({t, item.watermark});
+                if (++dest == out.size()) dest = 0;
+            }, [](const std::size_t) {});
+            close_all(to_sink, r);
+        }
+
+        void run_sink(const std::size_t r, const std::size_t slot) {
+            place("Sink", r, slot);
+            Sink_Functor<hh_result_t> fun(sink_fun);
+            wf::RuntimeContext rc(pardeg.sink, r);
+            std::optional<hh_result_t> t;
+            drain(inputs_of(to_sink, r), [&](const std::size_t, const item_t<hh_result_t>& item) {
+                t = item.tuple;
+                fun(t, rc);
+            }, [](const std::size_t) {});
+            t.reset();
+            fun(t, rc);     // end of the stream
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _dataset all the tuples that will compose the stream (moved into the pipeline)
+         * @param _pacer stream generation pacing
+         * @param _flowid flow identifier functor, any specialisation (copied in each replica, like the other functors)
+         * @param _acc incremental accumulator functor
+         * @param _detector detector functor
+         * @param _sink sink functor
+         * @param _pardeg parallelism of the operators
+         * @param _win_ns window length (nanoseconds)
+         * @param _slide_ns window slide (nanoseconds)
+         */
+        template<typename flowid_t>
+        Pipeline(packets_t& _dataset, const pacer::Source_Pacer& _pacer, const flowid_t& _flowid, const WinAcc_Inc_Functor& _acc,
+                 const Detector_Functor& _detector, const Sink_Functor<hh_result_t>& _sink, const pardeg_t& _pardeg, const uint64_t _win_ns, const uint64_t _slide_ns) :
+                dataset(std::move(_dataset)), pacer(_pacer),
+                flowid_stage([this, _flowid](const std::size_t r, const std::size_t slot) { run_flowid(_flowid, r, slot); }),
+                acc_fun(_acc), detector_fun(_detector), sink_fun(_sink),
+                pardeg(_pardeg), win_ns(_win_ns), slide_ns(_slide_ns) {
+            if (pardeg.source == 0 || pardeg.flowid == 0 || pardeg.acc == 0 || pardeg.detector == 0 || pardeg.sink == 0)
+                throw std::invalid_argument("[Pipeline] ERR: the parallelism of every operator must be positive");
+            if (slide_ns == 0 || win_ns < slide_ns)
+                throw std::invalid_argument("[Pipeline] ERR: the window slide must be positive and not longer than the window");
+            to_flowid = make_mesh<packet_t>(pardeg.source, pardeg.flowid);
+            to_acc = make_mesh<flow_len_t>(pardeg.flowid, pardeg.acc);
+            to_detector = make_mesh<hh_result_t>(pardeg.acc, pardeg.detector);
+            to_sink = make_mesh<hh_result_t>(pardeg.detector, pardeg.sink);
+        }
+
+        /**
+         * @brief Runs the pipeline until the sources stop and every replica has drained its inputs.
+         */
+        void run() {
+            std::vector<std::thread> threads;
+            std::size_t slot = 0;       // default core of the next thread
+            for (std::size_t r = 0; r < pardeg.source; r++) threads.emplace_back(&Pipeline::run_source, this, r, slot++);
+            for (std::size_t r = 0; r < pardeg.flowid; r++) threads.emplace_back(flowid_stage, r, slot++);
+            for (std::size_t r = 0; r < pardeg.acc; r++) threads.emplace_back(&Pipeline::run_acc, this, r, slot++);
+            for (std::size_t r = 0; r < pardeg.detector; r++) threads.emplace_back(&Pipeline::run_detector, this, r, slot++);
+            for (std::size_t r = 0; r < pardeg.sink; r++) threads.emplace_back(&Pipeline::run_sink, this, r, slot++);
+            for (auto& t : threads) t.join();
+        }
+    };
+}
+
+#endif //HH_BARE_PIPELINE_HPP
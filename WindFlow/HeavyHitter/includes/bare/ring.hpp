@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    ring.hpp
+ *
+ *  @brief Typed single-producer/single-consumer ring on the Iffq queue of spscq.h.
+ *
+ *  The queue carries pointers into an array of slots with the same number of entries: the
+ *  producer copies the item into the slot of the queue entry it is about to fill, and the consumer
+ *  copies it out before the entry is cleared (entries are only cleared one cache line behind the
+ *  consumer), so a slot is never rewritten while it is being read. The queue relies on the
+ *  ordering of the stores of x86, like the rest of spscq.h.
+ */
+
+#pragma once
+#ifndef HH_BARE_RING_HPP
+#define HH_BARE_RING_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "util/spscq.h"
+
+namespace bare {
+
+    inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        compiler_barrier();
+#endif
+    }
+
+    /**
+     * @class Ring
+     * @brief Bounded queue of items of type T between two threads.
+     */
+    template<typename T>
+    class Ring {
+    private:
+        Iffq* q;
+        T* slots;
+        alignas(SPSCQ_CACHELINE_SIZE) std::atomic<bool> closed;
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param entries number of entries (power of two, at least 32)
+         */
+        explicit Ring(const unsigned int entries) : q(nullptr), slots(nullptr), closed(false) {
+            q = static_cast<Iffq*>(std::aligned_alloc(SPSCQ_ALIGN_SIZE, iffq_size(entries)));
+            if (q == nullptr) throw std::bad_alloc();
+            std::memset(static_cast<void*>(q), 0, iffq_size(entries));
+            if (iffq_init(q, entries, SPSCQ_CACHELINE_SIZE, 1) != 0) {
+                std::free(q);
+                throw std::invalid_argument("[Ring] ERR: invalid number of entries " + std::to_string(entries));
+            }
+            slots = new T[entries];
+        }
+
+        Ring(const Ring&) = delete;
+        Ring& operator=(const Ring&) = delete;
+
+        ~Ring() {
+            delete[] slots;
+            std::free(q);
+        }
+
+        /**
+         * @brief Enqueues an item, if there is space.
+         */
+        bool try_push(const T& item) {
+            if (iffq_wspace(q, 1) == 0) return false;
+            T* slot = &slots[q->prod_write & q->entry_mask];
+            *slot = item;
+            compiler_barrier();     // the item is written before the entry is published
+            iffq_insert(q, reinterpret_cast<uintptr_t>(slot));
+            return true;
+        }
+
+        /**
+         * @brief Enqueues an item, spinning while the ring is full.
+         */
+        void push(const T& item) {
+            while (!try_push(item)) cpu_relax();
+        }
+
+        /**
+         * @brief Dequeues an item, if any.
+         */
+        bool try_pop(T& item) {
+            const uintptr_t m = iffq_extract(q);
+            if (m == 0) return false;
+            item = *reinterpret_cast<const T*>(m);
+            compiler_barrier();     // the item is read before its line is released
+            iffq_clear(q);
+            return true;
+        }
+
+        /**
+         * @brief Marks the end of the stream (called by the producer after its last push).
+         */
+        void close() {
+            closed.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Checks if the producer has closed the ring (items may still be queued).
+         */
+        bool is_closed() const {
+            return closed.load(std::memory_order_acquire);
+        }
+    };
+}
+
+#endif //HH_BARE_RING_HPP
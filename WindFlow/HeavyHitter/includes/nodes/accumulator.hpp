@@ -33,6 +33,15 @@
  *  @brief Accumulator operator which counts the total amount of bytes transported by each flow each given interval of time.
  *
  *  The operator works on key-based (key: flow id) timing windows, over which a total byte sum is performed.
+ *  Four implementations are available:
+ *  - non incremental (WinAcc_Functor): the packets of each window are buffered and summed when the window fires;
+ *  - incremental (WinAcc_Inc_Functor): each packet is folded into a running sum of each open window, so that
+ *    only one counter per open window (win/slide per flow) is kept;
+ *  - pane-based (WinAcc_Lift_Functor + WinAcc_Comb_Functor, for Ffat_Windows): each packet is folded into
+ *    the partial sum of its pane, and the windows are computed by combining the panes in a FlatFAT, so that the
+ *    cost per packet does not depend on the ratio between window length and slide;
+ *  - flow table (WinAcc_Table_Functor, keyed FlatMap): the byte counters of the panes of each flow are kept
+ *    in a flat open-addressing table of the replica (see util/flow_table.hpp), which evicts the idle flows.
  */
 
 #pragma once
@@ -40,12 +49,20 @@
 #define HH_WIN_ACC_HPP
 
 #include <iostream>
+#include <algorithm>
 #include <cstring>
+#include <optional>
 #include <unordered_map>
 #include <netinet/in.h>
 #include <windflow.hpp>
-#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "util/eos.hpp"
 #include "util/flow.hpp"
+#include "util/flow_table.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
 
 /**
  * @class WinAcc_Functor
@@ -59,6 +76,7 @@ private:
     std::size_t processed_tuples;
     std::size_t replica_id;
     bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
 
 public:
     /**
@@ -75,12 +93,17 @@ public:
      *
      * This implementation uses the non incremental version of the operator.
      *
-     * @param win window of wf tuples
-     * @param t result wf tuple
+     * @param win window of packets keyed by flow
+     * @param t result of the window
      * @param rc RuntimeContext providing information on parallelism degree and replica id
      */
-    void operator()(const wf::Iterable<wf_tuple_t>& win, wf_tuple_t& t, wf::RuntimeContext& rc) {
-        if (processed_tuples == 0) replica_id = rc.getReplicaIndex();
+    void operator()(const wf::Iterable<flow_len_t>& win, hh_result_t& t, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("ByteLenAccumulator", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        probe->tuples_out.add();
 
         if (win.size() > 0) {
             t.ts = win[win.size() - 1].ts;
@@ -91,13 +114,16 @@ public:
             for (const auto& i : win) {
                 t.acc_len += i.total_len;
             }
+            stage_trace::stamp(stage_trace::WINDOW_CLOSE, t.ts);
 
             /// update packet counter
             processed_tuples += win.size();
-#ifdef DEBUG_PRINT
-            std::cout << "[WinAcc-" << replica_id << "] processed win[" << win.size() << "], "
-                      << "sent result (flow: " << t.flow_key << ", bytes/win: " << t.acc_len << ")" << std::endl;
-#endif
+            probe->tuples_in.add(win.size());
+            probe->record_window(win.size());
+            if (trace::debug()) {
+                std::cout << "[WinAcc-" << replica_id << "] processed win[" << win.size() << "], "
+                          << "sent result (flow: " << t.flow_key << ", bytes/win: " << t.acc_len << ")" << std::endl;
+            }
         }
     }
 
@@ -107,9 +133,254 @@ public:
     ~WinAcc_Functor() {
         if (op_running && processed_tuples > 0) {
             op_running = false;
-#ifdef PRINT_OP_SUMMARY
-            std::cout << "[WinAcc-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed." << std::endl;
-#endif
+            if (trace::summary()) {
+                std::cout << "[WinAcc-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed." << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class WinAcc_Inc_Functor
+ *
+ * @brief Incremental version of the accumulator (running byte sum of each window).
+ */
+class WinAcc_Inc_Functor {
+private:
+    /// statistics & runtime info
+    std::size_t processed_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     */
+    WinAcc_Inc_Functor() :
+        processed_tuples(0),
+        op_running(true),
+        replica_id(0) {}
+
+    /**
+     * @brief Adds the length of a packet to the byte sum of a window of its flow.
+     *
+     * @param p packet keyed by flow
+     * @param t result of the window
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& p, hh_result_t& t, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("ByteLenAccumulator", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::stamp(stage_trace::ACC_IN, p.ts);
+
+        t.ts = std::max(t.ts, p.ts);
+        t.flow_key = p.flow_key;
+        t.ip_src = p.ip_src;
+        t.ip_dst = p.ip_dst;
+        t.acc_len += p.total_len;
+
+        /// update packet counter
+        processed_tuples++;
+        probe->tuples_in.add();     // window updates (one per packet and open window)
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~WinAcc_Inc_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[WinAcc-" << replica_id << "] a total number of " << processed_tuples << " window updates have been processed." << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class WinAcc_Lift_Functor
+ *
+ * @brief Lift function of the pane-based accumulator (turns a packet into a partial result).
+ */
+class WinAcc_Lift_Functor {
+public:
+    /**
+     * @brief Creates the partial result of a single packet.
+     *
+     * @param p packet keyed by flow
+     * @param t partial result
+     */
+    void operator()(const flow_len_t& p, hh_result_t& t) {
+        stage_trace::stamp(stage_trace::ACC_IN, p.ts);
+        t.ts = p.ts;
+        t.flow_key = p.flow_key;
+        t.ip_src = p.ip_src;
+        t.ip_dst = p.ip_dst;
+        t.acc_len = p.total_len;
+    }
+};
+
+/**
+ * @class WinAcc_Comb_Functor
+ *
+ * @brief Combine function of the pane-based accumulator (merges two partial results of the same flow).
+ */
+class WinAcc_Comb_Functor {
+public:
+    /**
+     * @brief Merges two partial results.
+     *
+     * @param a first partial result
+     * @param b second partial result
+     * @param t merged result
+     */
+    void operator()(const hh_result_t& a, const hh_result_t& b, hh_result_t& t) {
+        hh_result_t r = (a.ts >= b.ts) ? a : b;    // keep the addresses of the most recent packet
+        r.acc_len = a.acc_len + b.acc_len;
+        t = r;                                      // t can be an alias of a or b
+    }
+};
+
+/**
+ * @class WinAcc_Table_Functor
+ *
+ * @brief Per-flow byte length accumulator on a flat flow table, closing the windows on the slides of its input.
+ *
+ * Each flow holds one byte counter per pane (win/slide panes) in the table of the replica, allocated by the
+ * replica thread at its first packet. When a packet of a new slide arrives, the flows with bytes in the window
+ * are emitted, the oldest pane is subtracted from each flow, and the flows without packets for longer than the
+ * idle timeout are evicted, so the memory of the replica follows the active flows under churn. With a timeout
+ * shorter than the window, a flow evicted while still in the window loses its bytes. The open window is closed
+ * at the end of the stream, once the markers of all the sources have been received (see eos.hpp).
+ */
+class WinAcc_Table_Functor {
+private:
+    uint64_t slide_us;                                  // window slide (microseconds)
+    std::size_t num_panes;                              // panes per window
+    uint64_t timeout_slides;                            // idle timeout (slides)
+    std::size_t expected;                               // expected flows of the replica
+    std::optional<flow_table::Flow_Table> table;        // state of the flows (created by the replica thread)
+    std::size_t current;                                // pane receiving the updates
+    uint64_t epoch;                                     // slide index of the current pane
+    eos::Markers markers;                               // end of the stream of the sources
+
+    /// statistics & runtime info
+    long processed_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /// sends the flows of the window closed by the current slide, moves to the slide now and evicts the idle flows
+    void close_window(const uint64_t now, wf::Shipper<hh_result_t>& shipper) {
+        const uint64_t steps = std::min<uint64_t>(now - epoch, num_panes);
+        uint64_t flows = 0;
+        table->sweep([&](const std::size_t i) {
+            if (table->window(i) > 0) {
+                hh_result_t r;
+                r.ts = table->timestamp(i);
+                r.flow_key = table->key(i);
+                r.acc_len = table->window(i);
+                r.ip_src = table->source(i);
+                r.ip_dst = table->destination(i);
+                stage_trace::stamp(stage_trace::WINDOW_CLOSE, r.ts);
+                if (trace::debug()) {
+                    std::cout << "[WinAcc-" << replica_id << "] window result " << r.print() << std::endl;
+                }
+                shipper.push(std::move(r));
+                flows++;
+            }
+            for (uint64_t k = 1; k <= steps; k++) {
+                uint64_t& pane = table->pane(i, (current + k) % num_panes);
+                table->window(i) -= pane;
+                pane = 0;
+            }
+            return now - table->last(i) >= timeout_slides;
+        });
+        current = (current + steps) % num_panes;
+        epoch = now;
+        probe->record_window(flows);
+        probe->tuples_out.add(flows);
+        probe->table_flows.set(table->size());
+        probe->state_bytes.set(table->memory());
+        probe->live_flows.set(table->size());
+        probe->table_slots.set(table->slots());
+        probe->table_peak.set(table->peak_size());
+        probe->table_evicted.set(table->evictions());
+        probe->table_probe.set(table->longest_probe());
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _win_us window length (microseconds)
+     * @param _slide_us window slide (microseconds)
+     * @param _timeout_us idle timeout of the flows (microseconds)
+     * @param _expected expected flows of the replica (initial size of the table)
+     */
+    WinAcc_Table_Functor(const uint64_t _win_us, const uint64_t _slide_us, const uint64_t _timeout_us, const std::size_t _expected) :
+            slide_us(_slide_us),
+            num_panes(std::max<uint64_t>((_win_us + _slide_us - 1) / _slide_us, 1)),
+            timeout_slides(std::max<uint64_t>((_timeout_us + _slide_us - 1) / _slide_us, 1)),
+            expected(_expected),
+            current(0),
+            epoch(0),
+            processed_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Adds the bytes of a packet to its flow and, at the end of each slide, sends the flows of the window.
+     *
+     * @param t packet keyed by flow
+     * @param shipper Shipper object used to emit the window results
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) {        // all the sources ended: close the open window
+            if (markers.last() && processed_tuples > 0) {
+                metrics::Probe::Scope timed(probe);
+                close_window(epoch + 1, shipper);
+            }
+            return;
+        }
+        const uint64_t now = rc.getCurrentTimestamp() / slide_us;     // slide of the packet (ingress or event time)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("ByteLenAccumulator", replica_id);
+            table.emplace(expected, num_panes);
+            epoch = now;
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::stamp(stage_trace::ACC_IN, t.ts);
+
+        if (now > epoch) close_window(now, shipper);
+        const std::size_t i = table->insert(t.flow_key, now);
+        table->timestamp(i) = t.ts;
+        table->source(i) = t.ip_src;
+        table->destination(i) = t.ip_dst;
+        table->window(i) += t.total_len;
+        table->pane(i, current) += t.total_len;
+        processed_tuples++;
+        probe->tuples_in.add();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~WinAcc_Table_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[WinAcc-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed, "
+                          << table->size() << " flows in the table (" << table->slots() << " slots, "
+                          << table->evictions() << " evicted)." << std::endl;
+            }
         }
     }
 };
@@ -33,6 +33,11 @@
  *  @brief Detector node which identifies the heavy hitter (elephant) flows.
  *
  *  The operator sends the information on these flows to the sink while filters away the others.
+ *  Detector_Batch_Functor is the batch version of the operator, which selects the heavy hitters of
+ *  a whole batch of window results with a vectorized compare and compress-store.
+ *  Detector_Change_Functor is the stateful version, which keeps the heavy hitters of its flows and
+ *  only forwards the changes of that set, so that a flow staying heavy over many slides of the
+ *  windows reaches the sink once per change instead of once per window.
  */
 
 #pragma once
@@ -42,9 +47,20 @@
 #include <iostream>
 #include <cstring>
 #include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <windflow.hpp>
-#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/eos.hpp"
 #include "util/flow.hpp"
+#include "util/memory.hpp"
+#include "util/simd.hpp"
+#include "util/adaptive_batch.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
 
 extern long threshold;
 
@@ -60,6 +76,7 @@ private:
     long heavy_hitters;
     std::size_t replica_id;
     bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
 
 public:
     /**
@@ -75,12 +92,18 @@ public:
     /**
      * @brief Identifies heavy hitter flows and filters away the rest of the traffic.
      *
-     * @param t input wf tuple
+     * @param t input window result
      * @param rc RuntimeContext providing information on parallelism degree and replica id
      * @return true if a SYN packet has been processed, false otherwise
      */
-    bool operator()(wf_tuple_t& t, wf::RuntimeContext& rc) {
-        if (processed_tuples == 0) replica_id = rc.getReplicaIndex();
+    bool operator()(hh_result_t& t, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("HeavyHitterDetector", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        probe->tuples_in.add();
+        stage_trace::stamp(stage_trace::DETECTOR, t.ts);
 
         if (!t.ts) return false;    // invalid tuple (empty window in accumulator)
 
@@ -88,15 +111,16 @@ public:
         if (t.acc_len <= threshold)
             return false;
 
-#ifdef DEBUG_PRINT
-        std::cout << "[Detector-" << replica_id << "] received packet " << processed_tuples
-                  << " [hh #" << (heavy_hitters + 1) << ": " << t.print_essential(1) << "]" << std::endl;
-#endif
+        if (trace::debug()) {
+            std::cout << "[Detector-" << replica_id << "] received packet " << processed_tuples
+                      << " [hh #" << (heavy_hitters + 1) << ": " << t.print() << "]" << std::endl;
+        }
         /// update global tuple counter
         processed_tuples++;
 
         /// detected heavy hitter
         heavy_hitters++;
+        probe->tuples_out.add();
         return true;
     }
 
@@ -106,12 +130,241 @@ public:
     ~Detector_Functor() {
         if (op_running && processed_tuples > 0) {
             op_running = false;
-#ifdef PRINT_OP_SUMMARY
-            std::cout << "[Detector-" << replica_id << "] a total number of "
-                      << heavy_hitters << " heavy hitters have been detected out of "
-                      << processed_tuples << " processed packets."
-                      << std::endl;
-#endif
+            if (trace::summary()) {
+                std::cout << "[Detector-" << replica_id << "] a total number of "
+                          << heavy_hitters << " heavy hitters have been detected out of "
+                          << processed_tuples << " processed packets."
+                          << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class Detector_Batch_Functor
+ *
+ * @brief Batch version of the detector (vectorized selection of the heavy hitters).
+ *
+ * The window results are buffered until a batch is complete, then the results above the threshold are
+ * selected at once and forwarded: they are delivered with the timestamp of the last result of the batch.
+ * The last partial batch is handed to the sink at the end of the stream (see eos.hpp). The batch size is fixed, or adapted at run time to a latency target (see adaptive::Batch_Controller).
+ */
+class Detector_Batch_Functor {
+private:
+    adaptive::Batch_Controller batcher; // results per batch
+    std::vector<hh_result_t> results;   // buffered window results
+    std::vector<uint64_t> acc_len;      // byte sums of the buffered results
+    std::vector<uint32_t> selected;     // indexes of the heavy hitters in the batch
+    std::size_t buffered;
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long heavy_hitters;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /// forwards the heavy hitters of the buffered results
+    template<typename emit_t>
+    void select_batch(emit_t&& emit) {
+        const std::size_t n = simd::select_above(buffered, acc_len.data(), (uint64_t)std::max(threshold, 0L), selected.data());
+        for (std::size_t i = 0; i < n; i++) {
+            emit(results[selected[i]]);
+        }
+        heavy_hitters += n;
+        probe->tuples_out.add(n);
+        probe->batches.add();
+        if (batcher.is_adaptive()) probe->batch_len.set(batcher.size());
+        buffered = 0;
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _batcher results per batch (fixed or adaptive)
+     */
+    explicit Detector_Batch_Functor(const adaptive::Batch_Controller& _batcher) :
+            batcher(_batcher),
+            results(batcher.capacity()),
+            acc_len(batcher.capacity()),
+            selected(batcher.capacity()),
+            buffered(0),
+            processed_tuples(0),
+            heavy_hitters(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Buffers a window result and, when the batch is complete, forwards the heavy hitters.
+     *
+     * @param t input window result
+     * @param shipper Shipper object used to emit the heavy hitters
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const hh_result_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("HeavyHitterDetector", replica_id);
+            eos::at_end([this](const eos::emit_t& emit) {      // the last partial batch goes to the sink at the end of the stream
+                if (buffered > 0) select_batch(emit);
+            });
+        }
+        metrics::Probe::Scope timed(probe);
+        processed_tuples++;
+        probe->tuples_in.add();
+        stage_trace::stamp(stage_trace::DETECTOR, t.ts);
+
+        results[buffered] = t;
+        acc_len[buffered] = (t.ts) ? t.acc_len : 0;     // invalid tuples (empty window in accumulator) are discarded
+        if (batcher.add(++buffered)) select_batch([&](const hh_result_t& r) { shipper.push(r); });
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Detector_Batch_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[Detector-" << replica_id << "] a total number of "
+                          << heavy_hitters << " heavy hitters have been detected out of "
+                          << processed_tuples << " window results (batches of " << batcher.size()
+                          << ((batcher.is_adaptive()) ? ", adaptive, at the end" : "") << ")."
+                          << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class Detector_Change_Functor
+ *
+ * @brief Stateful version of the detector forwarding only the changes of the heavy hitter set.
+ *
+ * The stream is partitioned by flow, so each replica keeps the heavy hitters of its own flows. A window
+ * result is forwarded when its flow becomes heavy or the peak of the flow grows; when the flow stops
+ * being heavy, because one of its results falls under the threshold or because no result of it arrives
+ * for a window length and a slide (the flow left the windows), a result with no bytes (acc_len 0) is
+ * forwarded instead. The times are the timestamps of the results, i.e. ingress time.
+ */
+class Detector_Change_Functor {
+private:
+    /// heavy hitter kept by the replica
+    struct state_t {
+        uint64_t peak;                  // largest byte sum since the flow became heavy
+        uint64_t last;                  // timestamp of its last result above the threshold (nanoseconds)
+        uint32_t ip_src, ip_dst;
+    };
+
+    arena::unordered_map<uint64_t, state_t> heavy;
+    uint64_t horizon;                   // time without results after which a heavy flow is cleared (nanoseconds)
+    uint64_t next_sweep;
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long events;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    void emit(const hh_result_t& t, wf::Shipper<hh_result_t>& shipper) {
+        shipper.push(t);
+        events++;
+        probe->tuples_out.add();
+    }
+
+    void clear(const uint64_t key, const state_t& s, const uint64_t ts, wf::Shipper<hh_result_t>& shipper) {
+        hh_result_t r;
+        r.ts = ts;
+        r.flow_key = key;
+        r.ip_src = s.ip_src;
+        r.ip_dst = s.ip_dst;
+        emit(r, shipper);
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _horizon_ns time without results after which a heavy flow is cleared (window length plus slide, nanoseconds)
+     */
+    explicit Detector_Change_Functor(const uint64_t _horizon_ns) :
+            horizon(_horizon_ns),
+            next_sweep(0),
+            processed_tuples(0),
+            events(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Updates the heavy hitters of the replica with a window result and forwards their changes.
+     *
+     * @param t input window result
+     * @param shipper Shipper object used to emit the changes
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const hh_result_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("HeavyHitterDetector", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        probe->tuples_in.add();
+        stage_trace::stamp(stage_trace::DETECTOR, t.ts);
+
+        if (!t.ts) return;      // invalid tuple (empty window in accumulator)
+        processed_tuples++;
+
+        const uint64_t now = t.ts & ~(uint64_t)1;
+        const std::size_t flows = heavy.size();
+        auto it = heavy.find(t.flow_key);
+        if (t.acc_len > threshold) {
+            if (it == heavy.end()) {        // the flow became heavy
+                heavy.emplace(t.flow_key, state_t{t.acc_len, now, t.ip_src, t.ip_dst});
+                emit(t, shipper);
+            } else {
+                it->second.last = now;
+                if (t.acc_len > it->second.peak) {      // its peak grew
+                    it->second.peak = t.acc_len;
+                    emit(t, shipper);
+                }
+            }
+        } else if (it != heavy.end()) {     // the flow stopped being heavy
+            clear(it->first, it->second, t.ts, shipper);
+            heavy.erase(it);
+        }
+
+        /// clear the heavy hitters without results in the last window (checked once every half horizon)
+        if (now >= next_sweep) {
+            for (auto h = heavy.begin(); h != heavy.end();) {
+                if (h->second.last + horizon < now) {
+                    clear(h->first, h->second, now, shipper);
+                    h = heavy.erase(h);
+                } else {
+                    h++;
+                }
+            }
+            next_sweep = now + horizon / 2;
+        }
+        if (heavy.size() != flows) {
+            probe->live_flows.set(heavy.size());
+            probe->state_bytes.set(memory::bytes_of_map(heavy));
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Detector_Change_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[Detector-" << replica_id << "] a total number of "
+                          << events << " heavy hitter changes have been forwarded out of "
+                          << processed_tuples << " window results (" << heavy.size() << " heavy hitters at the end)."
+                          << std::endl;
+            }
         }
     }
 };
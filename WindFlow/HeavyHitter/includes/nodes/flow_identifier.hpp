@@ -31,6 +31,10 @@
  *  @date    04/05/2022
  * 
  *  @brief FlowId node which identifies different flows in the stream of packets.
+ *
+ *  Two implementations are available: FlowId_Functor processes one packet at a time, while
+ *  FlowId_Batch_Functor gathers the packets in batches and processes the fields of the whole
+ *  batch at once with vectorized kernels.
  */
 
 #pragma once
@@ -40,54 +44,86 @@
 #include <iostream>
 #include <cstring>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <windflow.hpp>
-#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
 #include "util/flow.hpp"
+#include "util/simd.hpp"
+#include "util/adaptive_batch.hpp"
+#include "util/eos.hpp"
+#include "util/registry.hpp"
+#include "util/sampling.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
 
 /**
  * @class FlowId_Functor
  * 
  * @brief Define the logic of the operator which identifies different network traffic flows as all the incoming traffic is analyzed. 
  * 
- * A relaxed flow is defined by the tuple <IPv4 source address, IPv4 destination address>.
+ * By default a relaxed flow is defined by the tuple <IPv4 source address, IPv4 destination address>,
+ * the other flow definitions (5-tuple, source or destination address only) are selected at run time
+ * among the specialisations of the functor (see flow::with_def). With packet sampling the lengths
+ * of the packets are scaled by the sampling rate (see sampling.hpp).
+ *
+ * @tparam DEF fields identifying a flow
  */
+template<flow::flow_def_t DEF = flow::flow_def_t::TWO_TUPLE>
 class FlowId_Functor {
 private:
+    uint32_t weight;                    // packets represented by each packet received (packet sampling)
+
     /// statistics & runtime info
     long processed_tuples;
     std::size_t replica_id;
     bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
 
 public:
     /**
      * @brief Constructor.
-     *
      */
     FlowId_Functor() :
+            weight(sampling::spec.weight()),
             processed_tuples(0),
             op_running(true),
             replica_id(0) {}
 
     /**
-     * @brief Identifies a flow and sets up the flow key field of each incoming tuple before forwarding it.
+     * @brief Identifies the flow of each incoming packet and forwards it keyed by flow, with its length.
      *
-     * @param t input wf tuple
+     * @param t input packet
      * @param rc RuntimeContext providing information on parallelism degree and replica id
+     * @return the packet keyed by flow
      */
-    void operator()(wf_tuple_t& t, wf::RuntimeContext& rc) {
-        if (processed_tuples == 0) replica_id = rc.getReplicaIndex();
-        
+    flow_len_t operator()(const packet_t& t, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) return eos::forward(t);     // a source ended (see eos.hpp)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("FlowIdentifier", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::begin(t.ts);
+
         /// identify flow and set up the corresponding field in the tuple
-        const relaxed_flow::relaxed_flow_t f = std::make_tuple(t.ip_src, t.ip_dst);
-        t.flow_key = relaxed_flow::key_hash()(f);
-        t.total_len = 18 + ntohs(t.ip_len);
-
-#ifdef DEBUG_PRINT
-        std::cout << "[FlowId-" << replica_id << "] received packet " << processed_tuples
-                  << " [" << t.print_essential(0) << "]" << std::endl;
-#endif
+        flow_len_t r;
+        r.flow_key = flow::key<DEF>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol);
+        r.total_len = (18 + ntohs(t.ip_len)) * weight;
+        r.ts = t.ts;
+        r.ip_src = t.ip_src;
+        r.ip_dst = t.ip_dst;
+        r.port_syn = ntohs(t.port_dst) | ((uint32_t)(t.syn != 0) << 16);
+
+        if (trace::debug()) {
+            std::cout << "[FlowId-" << replica_id << "] received packet " << processed_tuples
+                      << " [" << r.print() << "]" << std::endl;
+        }
         /// update global tuple counter
         processed_tuples++;
+        probe->tuples_in.add();
+        probe->tuples_out.add();
+        return r;
     }
 
     /**
@@ -96,9 +132,127 @@ public:
     ~FlowId_Functor() {
         if (op_running && processed_tuples > 0) {
             op_running = false;
-#ifdef PRINT_OP_SUMMARY
-            std::cout << "[FlowId-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed." << std::endl;
-#endif
+            if (trace::summary()) {
+                std::cout << "[FlowId-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed." << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class FlowId_Batch_Functor
+ *
+ * @brief Batch version of the flow identifier (vectorized computation of the flow keys and lengths).
+ *
+ * The packets are buffered in structure of arrays layout until a batch is complete, then the keys and
+ * the total lengths of the whole batch are computed and the tuples are forwarded. The tuples keep their
+ * own generation time, but are delivered with the timestamp of the last packet of the batch. The batch
+ * size is fixed, or adapted at run time to a latency target (see adaptive::Batch_Controller). At the
+ * end of the stream, or when a source is idle for the flush timeout, the partial batch is processed with
+ * the marker of the source (see eos.hpp).
+ *
+ * @tparam DEF fields identifying a flow
+ */
+template<flow::flow_def_t DEF = flow::flow_def_t::TWO_TUPLE>
+class FlowId_Batch_Functor {
+private:
+    adaptive::Batch_Controller batcher;     // packets per batch
+    uint32_t weight;                        // packets represented by each packet received (packet sampling)
+
+    /// fields of the buffered packets
+    std::vector<uint64_t> ts;
+    std::vector<uint32_t> ip_src, ip_dst;
+    std::vector<uint16_t> port_src, port_dst, ip_len;
+    std::vector<uint8_t> protocol;
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> total_len;
+    std::size_t buffered;
+
+    /// statistics & runtime info
+    long processed_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    void process_batch(wf::Shipper<flow_len_t>& shipper) {
+        flow::key_batch<DEF>(buffered, ip_src.data(), ip_dst.data(), port_src.data(), port_dst.data(), protocol.data(), keys.data());
+        simd::lengths(buffered, ip_len.data(), total_len.data());
+        for (std::size_t i = 0; i < buffered; i++) {
+            flow_len_t r;
+            r.ts = ts[i];
+            r.flow_key = keys[i];
+            r.ip_src = ip_src[i];
+            r.ip_dst = ip_dst[i];
+            r.total_len = total_len[i] * weight;
+            shipper.push(std::move(r));
+        }
+        probe->tuples_out.add(buffered);
+        probe->batches.add();
+        if (batcher.is_adaptive()) probe->batch_len.set(batcher.size());
+        buffered = 0;
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _batcher packets per batch (fixed or adaptive)
+     */
+    explicit FlowId_Batch_Functor(const adaptive::Batch_Controller& _batcher) :
+            batcher(_batcher),
+            weight(sampling::spec.weight()),
+            ts(batcher.capacity()), ip_src(batcher.capacity()), ip_dst(batcher.capacity()), port_src(batcher.capacity()),
+            port_dst(batcher.capacity()), ip_len(batcher.capacity()), protocol(batcher.capacity()), keys(batcher.capacity()),
+            total_len(batcher.capacity()),
+            buffered(0),
+            processed_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Buffers a packet and, when the batch is complete, identifies the flows of all its packets.
+     *
+     * @param t input packet
+     * @param shipper Shipper object used to emit the packets keyed by flow
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const packet_t& t, wf::Shipper<flow_len_t>& shipper, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) {        // a source ended (or is idle): flush the partial batch, and pass the end to the keyed stage
+            if (buffered > 0) {
+                metrics::Probe::Scope timed(probe);
+                process_batch(shipper);
+            }
+            if (eos::plan.forwarded() && !eos::is_flush(t)) shipper.push(eos::forward(t));
+            return;
+        }
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("FlowIdentifier", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::begin(t.ts);
+        ts[buffered] = t.ts;
+        ip_src[buffered] = t.ip_src;
+        ip_dst[buffered] = t.ip_dst;
+        port_src[buffered] = t.port_src;
+        port_dst[buffered] = t.port_dst;
+        ip_len[buffered] = t.ip_len;
+        protocol[buffered] = t.protocol;
+        processed_tuples++;
+        probe->tuples_in.add();
+        if (batcher.add(++buffered)) process_batch(shipper);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~FlowId_Batch_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[FlowId-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed in batches of "
+                          << batcher.size() << ((batcher.is_adaptive()) ? " (adaptive, at the end)" : "") << "." << std::endl;
+            }
         }
     }
 };
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    fused.hpp
+ *
+ *  @brief Fused node running flow identification, window accumulation and detection in one operator.
+ *
+ *  The operator is chained to the Source, so that each replica processes its own share of the
+ *  traffic from start to end in a single thread, without exchanging tuples with the other
+ *  replicas (run-to-completion, shared-nothing): only the detected heavy hitters are sent to the
+ *  Sink. Each replica has to receive all the packets of its flows, i.e. the input has to be
+ *  partitioned by flow (sharded dataset with -D hash, or RSS queues of a live interface). The open
+ *  window of each replica is handed to the sink at the end of the stream (see eos.hpp).
+ */
+
+#pragma once
+#ifndef HH_FUSED_HPP
+#define HH_FUSED_HPP
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <netinet/in.h>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/eos.hpp"
+#include "util/flow.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
+
+extern long threshold;
+
+/**
+ * @class Fused_Functor
+ *
+ * @brief Define the logic of the operator computing the heavy hitters of its share of the traffic.
+ *
+ * @tparam DEF fields identifying a flow
+ */
+template<flow::flow_def_t DEF = flow::flow_def_t::TWO_TUPLE>
+class Fused_Functor {
+private:
+    /// state of a flow in the window
+    struct flow_state_t {
+        uint64_t ts;                // generation time of the last packet
+        uint64_t bytes;             // bytes in the window
+        uint32_t ip_src, ip_dst;
+    };
+    using panes_t = arena::unordered_map<uint64_t, uint64_t>;
+
+    uint64_t slide_us;                                  // window slide (microseconds)
+    std::size_t num_panes;                              // panes per window
+    arena::unordered_map<uint64_t, flow_state_t> flows;  // flows in the window
+    std::vector<panes_t> panes;                         // bytes of the flows in each pane
+    std::size_t current;                                // pane receiving the updates
+    uint64_t epoch;                                     // slide index of the current pane
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long heavy_hitters;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /// sends the heavy hitters of the window closed by the current slide (emit takes each result)
+    template<typename emit_t>
+    void close_window(const emit_t& emit) {
+        probe->record_window(flows.size());
+        std::size_t bytes = memory::bytes_of_map(flows);
+        for (const auto& p : panes) bytes += memory::bytes_of_map(p);
+        probe->state_bytes.set(bytes);
+        probe->live_flows.set(flows.size());
+        for (const auto& f : flows) {
+            if (f.second.bytes <= (uint64_t)threshold) continue;
+            hh_result_t r;
+            r.ts = f.second.ts;
+            stage_trace::stamp(stage_trace::WINDOW_CLOSE, r.ts);
+            r.flow_key = f.first;
+            r.acc_len = f.second.bytes;
+            r.ip_src = f.second.ip_src;
+            r.ip_dst = f.second.ip_dst;
+            if (trace::debug()) {
+                std::cout << "[Fused-" << replica_id << "] hh #" << (heavy_hitters + 1) << ": " << r.print() << std::endl;
+            }
+            emit(std::move(r));
+            heavy_hitters++;
+            probe->tuples_out.add();
+        }
+    }
+
+    /// removes the bytes of a pane from the window
+    void expire(panes_t& pane) {
+        for (const auto& p : pane) {
+            auto it = flows.find(p.first);
+            if ((it->second.bytes -= p.second) == 0) flows.erase(it);
+        }
+        pane.clear();
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _win_us window length (microseconds)
+     * @param _slide_us window slide (microseconds)
+     */
+    Fused_Functor(const uint64_t _win_us, const uint64_t _slide_us) :
+            slide_us(_slide_us),
+            num_panes(std::max<uint64_t>((_win_us + _slide_us - 1) / _slide_us, 1)),
+            current(0),
+            epoch(0),
+            processed_tuples(0),
+            heavy_hitters(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Accumulates the bytes of a packet in its flow and, at the end of each slide, sends the heavy hitters.
+     *
+     * @param t input packet
+     * @param shipper Shipper object used to emit the results
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const packet_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        const uint64_t now = rc.getCurrentTimestamp() / slide_us;     // slide of the packet (ingress or event time)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("FusedHeavyHitter", replica_id);
+            panes.resize(num_panes);
+            epoch = now;
+            eos::at_end([this](const eos::emit_t& emit) {      // the open window is not closed by a later packet
+                close_window([&emit](hh_result_t&& r) { emit(r); });
+            });
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::begin(t.ts);               // the flow identification and the accumulation are the same stage
+        stage_trace::stamp(stage_trace::ACC_IN, t.ts);
+
+        if (now > epoch) {
+            close_window([&shipper](hh_result_t&& r) { shipper.push(std::move(r)); });
+            for (uint64_t e = epoch; e < now && e < epoch + num_panes; e++) {
+                current = (current + 1) % num_panes;
+                expire(panes[current]);
+            }
+            epoch = now;
+        }
+
+        const uint64_t key = flow::key<DEF>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol);
+        const uint32_t len = 18 + ntohs(t.ip_len);
+        flow_state_t& f = flows[key];
+        f.ts = t.ts;
+        f.bytes += len;
+        f.ip_src = t.ip_src;
+        f.ip_dst = t.ip_dst;
+        panes[current][key] += len;
+        processed_tuples++;
+        probe->tuples_in.add();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Fused_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[Fused-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed, "
+                          << heavy_hitters << " heavy hitters detected." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_FUSED_HPP
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    generator_source.hpp
+ *
+ *  @brief Source node generating synthetic traffic instead of replaying a trace.
+ */
+
+#pragma once
+#ifndef HH_GENERATOR_SOURCE_HPP
+#define HH_GENERATOR_SOURCE_HPP
+
+#include <iostream>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/metric.hpp"
+#include "util/pacer.hpp"
+#include "util/event_time.hpp"
+#include "util/eos.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/traffic.hpp"
+#include "nodes/source.hpp"
+#include "util/trace.hpp"
+
+extern volatile unsigned long app_start_time;
+extern volatile unsigned long app_run_time;
+
+/**
+ * @class Generator_Source_Functor
+ *
+ * @brief Define the logic of the Source generating the packets of a synthetic traffic model.
+ */
+class Generator_Source_Functor {
+private:
+    traffic::spec_t spec;               // parameters of the traffic
+    long generated_tuples;              // total number of generated tuples
+    pacer::Source_Pacer pacer;          // stream generation pacing (global rate)
+    event_time::Event_Clock clock;      // emission in ingress time or event time
+
+    /// runtime info
+    std::size_t replica_id;
+    metrics::Replica_Stats* stats;      // live counters of the replica
+
+    /// time variables
+    unsigned long current_time;
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _spec parameters of the traffic
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
+     */
+    Generator_Source_Functor(const traffic::spec_t& _spec, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock) :
+            spec(_spec),
+            generated_tuples(0),
+            pacer(_pacer),
+            clock(_clock),
+            replica_id(0),
+            stats(nullptr),
+            current_time(app_start_time) {}
+
+    /**
+     * @brief Generates packet tuples until the end of the run.
+     *
+     * @param shipper Source_Shipper object used for generating input tuples
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(wf::Source_Shipper<packet_t>& shipper, wf::RuntimeContext& rc) {
+        replica_id = rc.getReplicaIndex();
+        stats = metrics::registry.replica("Source", replica_id);
+        placement::placement.bind("Source", replica_id);
+        traffic::Generator gen(spec, replica_id, rc.getParallelism());
+        const unsigned long onset = app_start_time + (unsigned long)(spec.onset * 1e9);
+        pacer.start();
+
+        tsc::Stamper stamper;           // batch-level timestamps and latency markers
+        stamper.start();
+        current_time = stamper.time();
+        eos::Idle_Flush idle(shipper, clock);     // flush markers while the pacer waits
+        while ((current_time - app_start_time <= app_run_time) && !Source_Functor::terminate) {
+            packet_t t;
+            gen.next(current_time >= onset, t);
+            if (const uint64_t now = pacer.pace(0, idle)) stamper.refresh(now);      // wait for the emission slot of the tuple
+            t.ts = stamper.stamp();
+            current_time = stamper.time();
+            if (trace::debug()) {
+                std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples
+                          << ", " << t.print() << std::endl;
+            }
+            clock.push(shipper, std::move(t), current_time / 1000);     // the generation time is also the event time
+            idle.sent();
+            generated_tuples++;
+            stats->tuples_out.add();
+        }
+
+        /// update throughput statistics
+        eos::send(shipper, clock);      // the operators which hold packets or windows flush them
+        stats->exec_time.set(tsc::now() - app_start_time);
+        if (trace::summary()) {
+            std::cout << "[Source-" << replica_id << " started termination..."
+                      << " (generated tuples: " << generated_tuples << ")" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Generator_Source_Functor() = default;
+};
+
+#endif //HH_GENERATOR_SOURCE_HPP
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    gpu.hpp
+ *
+ *  @brief GPU version of the flow identifier and of the window accumulator (make GPU=1, -a gpu).
+ *
+ *  The packets are converted on the CPU, in the thread of the source, to gpu_flow_t tuples (the GPU
+ *  operators cannot change the type of the tuples) and shipped to the GPU in batches. A Map_GPU
+ *  computes the flow keys and the lengths of the whole batch, and a keyed Ffat_Windows_GPU sums the
+ *  bytes of each flow in the windows. The results go back to the CPU detector and sink, unchanged.
+ */
+
+#pragma once
+#ifndef HH_GPU_HPP
+#define HH_GPU_HPP
+
+#include <windflow.hpp>
+#include <windflow_gpu.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/device.hpp"
+#include "util/flow.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+
+/**
+ * @brief Packet processed by the GPU operators (packet fields, flow key and total length).
+ */
+struct gpu_flow_t
+{
+    uint64_t ts;                   // timestamp (tuple generation time set in the source)
+    uint64_t flow_key;             // flow identifier (computed on the GPU)
+    uint32_t ip_src, ip_dst;       // source/destination IP address (binary representation)
+    uint16_t port_src, port_dst;   // source/destination port (network representation)
+    uint16_t ip_len;               // length of the entire IP packet in bytes (network representation)
+    uint8_t protocol;              // transport protocol
+    uint8_t reserved;
+    uint32_t total_len;            // total length in bytes of the packet (computed on the GPU)
+
+    HH_HD gpu_flow_t() : ts(0), flow_key(0), ip_src(0), ip_dst(0), port_src(0), port_dst(0), ip_len(0), protocol(0), reserved(0), total_len(0) {}
+};
+
+/**
+ * @class GPU_Stage_Functor
+ *
+ * @brief Converts the packets to the tuples of the GPU operators (chained to the source, batches of the GPU size).
+ */
+class GPU_Stage_Functor {
+private:
+    long processed_tuples;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    GPU_Stage_Functor() : processed_tuples(0) {}
+
+    gpu_flow_t operator()(const packet_t& t, wf::RuntimeContext& rc) {
+        if (processed_tuples++ == 0) probe.attach("GPUStage", rc.getReplicaIndex());
+        probe->tuples_in.add();
+        probe->tuples_out.add();
+        stage_trace::begin(t.ts);
+        gpu_flow_t r;
+        r.ts = t.ts;
+        r.ip_src = t.ip_src;
+        r.ip_dst = t.ip_dst;
+        r.port_src = t.port_src;
+        r.port_dst = t.port_dst;
+        r.ip_len = t.ip_len;
+        r.protocol = t.protocol;
+        return r;
+    }
+};
+
+/**
+ * @class FlowId_GPU_Functor
+ *
+ * @brief Flow identifier running on the GPU, one thread per packet of the batch (same keys as FlowId_Functor).
+ *
+ * @tparam DEF fields identifying a flow
+ */
+template<flow::flow_def_t DEF = flow::flow_def_t::TWO_TUPLE>
+class FlowId_GPU_Functor {
+public:
+    HH_HD void operator()(gpu_flow_t& t) const {
+        t.flow_key = flow::key<DEF>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol);
+        t.total_len = 18 + (uint32_t)(((t.ip_len & 0xff) << 8) | (t.ip_len >> 8));     // ntohs is not available on the device
+    }
+};
+
+/**
+ * @class Flow_Key_GPU
+ *
+ * @brief Key extractor of the GPU window accumulator.
+ */
+class Flow_Key_GPU {
+public:
+    HH_HD uint64_t operator()(const gpu_flow_t& t) const {
+        return t.flow_key;
+    }
+};
+
+/**
+ * @class WinAcc_Lift_GPU_Functor
+ *
+ * @brief Lift function of the GPU window accumulator (turns a packet into a partial result).
+ */
+class WinAcc_Lift_GPU_Functor {
+public:
+    HH_HD void operator()(const gpu_flow_t& p, hh_result_t& t) const {
+        t.ts = p.ts;
+        t.flow_key = p.flow_key;
+        t.ip_src = p.ip_src;
+        t.ip_dst = p.ip_dst;
+        t.acc_len = p.total_len;
+    }
+};
+
+/**
+ * @class WinAcc_Comb_GPU_Functor
+ *
+ * @brief Combine function of the GPU window accumulator (same merge as WinAcc_Comb_Functor).
+ */
+class WinAcc_Comb_GPU_Functor {
+public:
+    HH_HD void operator()(const hh_result_t& a, const hh_result_t& b, hh_result_t& t) const {
+        hh_result_t r = (a.ts >= b.ts) ? a : b;    // keep the addresses of the most recent packet
+        r.acc_len = a.acc_len + b.acc_len;
+        t = r;                                      // t can be an alias of a or b
+    }
+};
+
+#endif //HH_GPU_HPP
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    hhh.hpp
+ *
+ *  @brief Hierarchical heavy hitter detection over the IPv4 prefixes.
+ *
+ *  Alternative to the ByteLenAccumulator and HeavyHitterDetector operators. The bytes of each
+ *  packet are added in one pass to its /32, /24, /16 and /8 prefixes (of the source or of the
+ *  destination address), all kept in a single table of the window counts; the packets are
+ *  partitioned on the /8 prefix, so each replica holds complete subtrees of the hierarchy.
+ *  Whenever the window slides, the hierarchy is visited bottom-up and a prefix is reported if
+ *  its bytes, discounted of those of its reported descendants, exceed the threshold: traffic
+ *  spread over many addresses is reported at the first level where it becomes heavy, and only
+ *  the most specific heavy prefixes are reported. The open window is closed at the end of the
+ *  stream, once the markers of all the sources have been received (see eos.hpp).
+ */
+
+#pragma once
+#ifndef HH_HHH_HPP
+#define HH_HHH_HPP
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/eos.hpp"
+#include "util/memory.hpp"
+#include "util/prefix.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
+
+extern long threshold;
+
+/**
+ * @class HHH_Functor
+ *
+ * @brief Define the logic of the operator detecting the hierarchical heavy hitters (partitioned on the /8 prefix).
+ */
+class HHH_Functor {
+private:
+    using counts_t = arena::unordered_map<uint64_t, uint64_t>;
+
+    prefix::dim_t dim;              // hierarchy on the source or destination address
+    uint64_t slide_us;              // window slide (microseconds)
+    std::size_t num_panes;          // panes per window
+    counts_t window;                // bytes of the prefixes of all the levels in the window
+    std::vector<counts_t> panes;    // bytes of the /32 prefixes in each pane
+    std::size_t current;            // pane receiving the updates
+    uint64_t epoch;                 // slide index of the current pane
+    uint64_t last_ts;               // generation time of the last packet
+    eos::Markers markers;           // end of the stream of the sources
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long reported_prefixes;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /// removes the bytes of a pane from the window
+    void expire(counts_t& pane) {
+        for (const auto& leaf : pane) {
+            for (const unsigned len : prefix::levels) {
+                auto it = window.find(prefix::parent(leaf.first, len));
+                if ((it->second -= leaf.second) == 0) window.erase(it);
+            }
+        }
+        pane.clear();
+    }
+
+    /**
+     * @brief Reports the hierarchical heavy hitters of the window closed by the current slide.
+     */
+    void close_window(wf::Shipper<hh_result_t>& shipper) {
+        std::size_t bytes = memory::bytes_of_map(window);
+        for (const auto& p : panes) bytes += memory::bytes_of_map(p);
+        probe->state_bytes.set(bytes);
+        probe->live_flows.set(window.size());
+        stage_trace::stamp(stage_trace::WINDOW_CLOSE, last_ts);
+
+        /// only the prefixes above the threshold can be reported
+        std::vector<std::pair<uint64_t, uint64_t>> heavy[prefix::num_levels];
+        for (const auto& p : window) {
+            if (p.second <= (uint64_t)threshold) continue;
+            for (std::size_t l = 0; l < prefix::num_levels; l++) {
+                if (prefix::length(p.first) == prefix::levels[l]) heavy[l].push_back(p);
+            }
+        }
+
+        /// bytes of the reported descendants of each prefix
+        counts_t discount;
+        for (std::size_t l = 0; l < prefix::num_levels; l++) {
+            for (const auto& p : heavy[l]) {
+                auto d = discount.find(p.first);
+                const uint64_t covered = (d == discount.end()) ? 0 : d->second;
+                const uint64_t residual = p.second - covered;
+                if (residual > (uint64_t)threshold) {
+                    hh_result_t r;
+                    r.ts = last_ts;
+                    r.flow_key = p.first;
+                    r.acc_len = residual;
+                    r.ip_src = (dim == prefix::dim_t::SRC) ? prefix::address(p.first) : 0;
+                    r.ip_dst = (dim == prefix::dim_t::DST) ? prefix::address(p.first) : 0;
+                    shipper.push(std::move(r));
+                    reported_prefixes++;
+                    probe->tuples_out.add();
+                }
+                if (l + 1 < prefix::num_levels && (residual > (uint64_t)threshold || covered > 0)) {
+                    discount[prefix::parent(p.first, prefix::levels[l + 1])] += (residual > (uint64_t)threshold) ? p.second : covered;
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _dim hierarchy on the source or destination address
+     * @param _win_us window length (microseconds)
+     * @param _slide_us window slide (microseconds)
+     */
+    HHH_Functor(const prefix::dim_t _dim, const uint64_t _win_us, const uint64_t _slide_us) :
+            dim(_dim),
+            slide_us(_slide_us),
+            num_panes(std::max<uint64_t>((_win_us + _slide_us - 1) / _slide_us, 1)),
+            current(0),
+            epoch(0),
+            last_ts(0),
+            processed_tuples(0),
+            reported_prefixes(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Adds the bytes of a packet to its prefixes and, at the end of each slide, reports the heavy prefixes.
+     *
+     * @param t input packet keyed by flow
+     * @param shipper Shipper object used to emit the results
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) {        // all the sources ended: close the open window
+            if (markers.last() && processed_tuples > 0) {
+                metrics::Probe::Scope timed(probe);
+                close_window(shipper);
+            }
+            return;
+        }
+        const uint64_t now = rc.getCurrentTimestamp() / slide_us;     // slide of the packet (ingress or event time)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("HierarchicalHeavyHitterDetector", replica_id);
+            panes.resize(num_panes);
+            epoch = now;
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::stamp(stage_trace::ACC_IN, t.ts);
+
+        if (now > epoch) {
+            close_window(shipper);
+            for (uint64_t e = epoch; e < now && e < epoch + num_panes; e++) {
+                current = (current + 1) % num_panes;
+                expire(panes[current]);
+            }
+            epoch = now;
+        }
+
+        const uint32_t addr = ntohl((dim == prefix::dim_t::SRC) ? t.ip_src : t.ip_dst);
+        const uint64_t leaf = prefix::key(dim, 32, addr);
+        panes[current][leaf] += t.total_len;
+        for (const unsigned len : prefix::levels) {
+            window[prefix::parent(leaf, len)] += t.total_len;
+        }
+        last_ts = t.ts;
+        processed_tuples++;
+        probe->tuples_in.add();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~HHH_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[HHH-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed, "
+                          << reported_prefixes << " heavy prefixes reported." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_HHH_HPP
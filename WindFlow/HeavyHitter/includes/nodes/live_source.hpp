@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    live_source.hpp
+ *
+ *  @brief Source node generating the input stream from live packet capturing.
+ *
+ *  Source node which reads packets from a nethuns socket (AF_XDP, netmap, AF_PACKET or libpcap
+ *  backend, selected at compile time through the NETHUNS_SOCKET macro). Each replica of the
+ *  source is bound to its own receive queue of the network interface, and the packet headers
+ *  are parsed in place, straight out of the receive ring. The termination flag is shared with
+ *  the Source_Functor.
+ *
+ *  The capture can also be given as a list of interface:queue pairs (e.g. "eth0:0,eth0:1,eth1:0"),
+ *  one per replica, to read from the queues of several interfaces.
+ */
+
+#pragma once
+#ifndef HH_LIVE_SOURCE_HPP
+#define HH_LIVE_SOURCE_HPP
+
+#include <iostream>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <nethuns.h>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "parser/header_parser.hpp"
+#include "nodes/source.hpp"
+#include "util/metric.hpp"
+#include "util/event_time.hpp"
+#include "util/eos.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
+
+extern volatile unsigned long app_start_time;
+extern volatile unsigned long app_run_time;
+
+/**
+ * @class Live_Source_Functor
+ *
+ * @brief Define the logic of the Source capturing packets from a network interface.
+ */
+class Live_Source_Functor {
+private:
+    /// capture configuration
+    std::string interface;              // name of the network interface to capture from
+    int first_queue;                    // RX queue bound to replica 0 (replica i is bound to first_queue + i)
+    std::vector<std::pair<std::string, int>> endpoints;     // interface and queue of each replica (list given)
+    bool zero_copy;                     // request the zero-copy capture mode to the nethuns backend
+    event_time::Event_Clock clock;      // emission in ingress time or event time (capture timestamps of the NIC/kernel)
+
+    /// operator state & statistics
+    nethuns_socket_t* socket;           // nethuns socket of this replica (opened in the replica thread)
+    long generated_tuples;              // total number of generated tuples
+    long received_packets;              // total number of packets read from the ring (TCP and non TCP)
+
+    /// runtime info
+    std::size_t replica_id;
+    metrics::Replica_Stats* stats;      // live counters of the replica
+
+    /// time variables
+    unsigned long current_time;
+
+    /**
+     * @brief Opens the nethuns socket and binds it to the RX queue of this replica.
+     */
+    void open_socket() {
+        char errbuf[NETHUNS_ERRBUF_SIZE];
+
+        nethuns_socket_options opt{};
+        opt.numblocks = 1;
+        opt.numpackets = 2048;
+        opt.packetsize = 2048;
+        opt.timeout_ms = 0;
+        opt.dir = nethuns_in;
+        opt.capture = (zero_copy) ? nethuns_cap_zero_copy : nethuns_cap_default;
+        opt.mode = nethuns_socket_rx_only;
+        opt.promisc = true;
+        opt.rxhash = true;
+        opt.tx_qdisc_bypass = false;
+
+        socket = nethuns_open(&opt, errbuf);
+        if (socket == nullptr)
+            throw std::runtime_error("[Live_Source] ERR: failed to open nethuns socket (" + std::string(errbuf) + ")");
+
+        int queue = first_queue + static_cast<int>(replica_id);
+        if (!endpoints.empty()) {
+            if (replica_id >= endpoints.size()) {
+                nethuns_close(socket);
+                socket = nullptr;
+                throw std::runtime_error("[Live_Source] ERR: no interface:queue given for replica " + std::to_string(replica_id));
+            }
+            interface = endpoints[replica_id].first;
+            queue = endpoints[replica_id].second;
+        }
+        if (nethuns_bind(socket, interface.c_str(), queue) < 0) {
+            std::string err(nethuns_error(socket));
+            nethuns_close(socket);
+            socket = nullptr;
+            throw std::runtime_error("[Live_Source] ERR: failed to bind nethuns socket to " + interface
+                                     + " queue " + std::to_string(queue) + " (" + err + ")");
+        }
+        if (trace::debug()) {
+            std::cout << "[Source-" << replica_id << "] capturing from " << interface << " queue " << queue << std::endl;
+        }
+    }
+
+public:
+    /**
+     * @brief Parses a list of interface:queue pairs separated by commas.
+     *
+     * @param spec capture spec (a single interface without queue gives an empty list)
+     * @return interface and queue of each replica
+     */
+    static std::vector<std::pair<std::string, int>> parse_endpoints(const std::string& spec) {
+        std::vector<std::pair<std::string, int>> list;
+        if (spec.find_first_of(",:") == std::string::npos) return list;
+        std::stringstream ss(spec);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            const std::size_t colon = item.rfind(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 == item.size()
+                    || item.find_first_not_of("0123456789", colon + 1) != std::string::npos)
+                throw std::invalid_argument("[Live_Source] ERR: expected interface:queue, found " + item);
+            list.emplace_back(item.substr(0, colon), std::stoi(item.substr(colon + 1)));
+        }
+        return list;
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param _interface network interface to capture packets from, or list of interface:queue pairs (one per replica)
+     * @param _first_queue RX queue bound to the first source replica
+     * @param _zero_copy enables the zero-copy capture mode
+     * @param _clock emission in ingress time or event time
+     */
+    Live_Source_Functor(const std::string& _interface, const int _first_queue, const bool _zero_copy,
+                        const event_time::Event_Clock& _clock) :
+            interface(_interface),
+            first_queue(_first_queue),
+            zero_copy(_zero_copy),
+            clock(_clock),
+            socket(nullptr),
+            generated_tuples(0),
+            received_packets(0),
+            replica_id(0),
+            stats(nullptr),
+            current_time(app_start_time) {
+        endpoints = parse_endpoints(_interface);
+    }
+
+    /**
+     * @brief Copy constructor (each replica opens its own socket).
+     */
+    Live_Source_Functor(const Live_Source_Functor& other) :
+            interface(other.interface),
+            first_queue(other.first_queue),
+            endpoints(other.endpoints),
+            zero_copy(other.zero_copy),
+            clock(other.clock),
+            socket(nullptr),
+            generated_tuples(0),
+            received_packets(0),
+            replica_id(0),
+            stats(nullptr),
+            current_time(other.current_time) {}
+
+    /**
+     * @brief Sends the captured TCP packets as tuples in a item-by-item fashion.
+     *
+     * @param shipper Source_Shipper object used for generating input tuples
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(wf::Source_Shipper<packet_t>& shipper, wf::RuntimeContext& rc) {
+        replica_id = rc.getReplicaIndex();
+        stats = metrics::registry.replica("Source", replica_id);
+        placement::placement.bind("Source", replica_id);
+        open_socket();
+
+        const nethuns_pkthdr_t* pkthdr = nullptr;
+        const uint8_t* frame = nullptr;
+        tsc::Stamper stamper;           // batch-level timestamps and latency markers
+        stamper.start();
+        current_time = stamper.time();
+        eos::Idle_Flush idle(shipper, clock);     // flush markers while the ring is empty
+
+        /// capture loop
+        while ((current_time - app_start_time <= app_run_time) && !Source_Functor::terminate) {
+            uint64_t pkt_id = nethuns_recv(socket, &pkthdr, &frame);
+            if (pkt_id == NETHUNS_ERROR || pkt_id == NETHUNS_EOF) {
+                std::cerr << "[Live_Source] ERR: nethuns_recv failed (" << nethuns_error(socket) << ")" << std::endl;
+                break;
+            }
+
+            if (pkt_id > 0) {
+                received_packets++;
+
+                /// parse the headers in place and release the slot to the ring as soon as possible
+                wf_tuple_t pkt;
+                const bool valid = header_parser::parse(frame, nethuns_snaplen(pkthdr), pkt);
+                const uint64_t capture_ts = nethuns_tstamp_sec(pkthdr) * (uint64_t)1000000 + nethuns_tstamp_usec(pkthdr);
+                nethuns_release(socket, pkt_id);
+
+                if (valid) {
+                    packet_t t(pkt);
+                    t.ts = stamper.stamp();
+                    if (trace::debug()) {
+                        std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples << ", " << t.print() << std::endl;
+                    }
+                    clock.push(shipper, std::move(t), capture_ts);     // send the tuple
+                    idle.sent();
+                    /// update global tuple counter
+                    generated_tuples++;
+                    stats->tuples_out.add();
+                }
+            } else {
+                const uint64_t now = tsc::now();
+                stamper.refresh(now);           // empty ring, the clock is not advanced by the stamps
+                idle(now);
+            }
+            current_time = stamper.time(); // get the new current time (read once per batch of tuples)
+        }
+
+        /// EOS is reached here, start source termination
+        eos::send(shipper, clock);      // the operators which hold packets or windows flush them
+        stats->exec_time.set(tsc::now() - app_start_time);
+        if (trace::summary()) {
+            std::cout << "[Source-" << replica_id << " started termination..."
+                      << " (captured packets: " << received_packets
+                      << ", generated tuples: " << generated_tuples << ")" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Live_Source_Functor() {
+        if (socket != nullptr) nethuns_close(socket);
+    }
+};
+
+#endif //HH_LIVE_SOURCE_HPP
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    pre_aggregator.hpp
+ *
+ *  @brief PreAggregator node combining the bytes of the packets of each flow before the keyed window stage.
+ *
+ *  The operator is chained to the FlowId operator, so each of its replicas sums the packets of its
+ *  own share of the stream without partitioning it. The partial sums of a sub-interval of the
+ *  window slide are sent to the window stage when the sub-interval ends, so an elephant flow costs
+ *  the keyed replica one tuple per sub-interval per upstream replica instead of one per packet.
+ *  The window assignment of the bytes is delayed by at most one sub-interval. The partial sums
+ *  of the last sub-interval are sent with the marker of each source at the end of the stream
+ *  (see eos.hpp).
+ */
+
+#pragma once
+#ifndef HH_PRE_AGGREGATOR_HPP
+#define HH_PRE_AGGREGATOR_HPP
+
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/eos.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/trace.hpp"
+
+/**
+ * @class Pre_Aggregator_Functor
+ *
+ * @brief Define the logic of the operator computing the partial byte sums of the flows over short sub-intervals.
+ */
+class Pre_Aggregator_Functor {
+private:
+    static constexpr std::size_t MAX_FLOWS = 1 << 16;   // the partial sums are sent earlier if more flows are active
+
+    uint64_t interval_us;                               // length of the sub-interval (microseconds)
+    arena::unordered_map<uint64_t, flow_len_t> partials;    // partial sums of the flows in the current sub-interval
+    uint64_t current;                                   // index of the current sub-interval
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long emitted_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    void flush(wf::Shipper<flow_len_t>& shipper) {
+        for (auto& p : partials) {
+            shipper.push(std::move(p.second));
+        }
+        emitted_tuples += partials.size();
+        probe->tuples_out.add(partials.size());
+        probe->record_window(partials.size());
+        probe->state_bytes.set(memory::bytes_of_map(partials));
+        probe->live_flows.set(partials.size());
+        partials.clear();
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _interval_us length of the sub-interval of aggregation (microseconds)
+     */
+    explicit Pre_Aggregator_Functor(const uint64_t _interval_us) :
+            interval_us(std::max<uint64_t>(_interval_us, 1)),
+            current(0),
+            processed_tuples(0),
+            emitted_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Adds the bytes of a packet to the partial sum of its flow, and sends the partial sums when the sub-interval ends.
+     *
+     * @param t input packet keyed by flow
+     * @param shipper Shipper object used to emit the partial sums
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& t, wf::Shipper<flow_len_t>& shipper, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) {        // a source ended: send the partial sums, and pass the marker to the keyed stage
+            if (!partials.empty()) {
+                metrics::Probe::Scope timed(probe);
+                flush(shipper);
+            }
+            if (eos::plan.keyed > 0) shipper.push(flow_len_t(t));
+            return;
+        }
+        const uint64_t now = rc.getCurrentTimestamp() / interval_us;    // sub-interval of the packet (ingress or event time)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("PreAggregator", replica_id);
+            partials.reserve(MAX_FLOWS);
+            current = now;
+        }
+        metrics::Probe::Scope timed(probe);
+        if (now != current || partials.size() >= MAX_FLOWS) {
+            flush(shipper);
+            current = now;
+        }
+        processed_tuples++;
+        probe->tuples_in.add();
+
+        auto it = partials.find(t.flow_key);
+        if (it == partials.end()) {
+            partials.emplace(t.flow_key, t);
+            return;
+        }
+        flow_len_t& p = it->second;
+        if (p.total_len > std::numeric_limits<uint32_t>::max() - t.total_len) {    // the partial sum would overflow
+            shipper.push(p);
+            emitted_tuples++;
+            probe->tuples_out.add();
+            p.total_len = 0;
+        }
+        p.total_len += t.total_len;
+        p.ts = t.ts;            // most recent packet of the flow (latency is measured on it)
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Pre_Aggregator_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[PreAggregator-" << replica_id << "] a total number of " << processed_tuples << " packets have been combined into "
+                          << emitted_tuples << " partial sums." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_PRE_AGGREGATOR_HPP
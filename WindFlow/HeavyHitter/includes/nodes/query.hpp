@@ -0,0 +1,457 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    query.hpp
+ *
+ *  @brief Queries sharing the source and the flow identifier of the heavy hitter pipeline.
+ *
+ *  In the multi-query topology the stream of the flow identifier is split into branches: the heavy
+ *  hitter pipeline (branch 0) and one branch per query, each with its own key, windows, detector and
+ *  sink, so that the packets are parsed and hashed once for all the queries:
+ *  - syn: SYN flood, the SYN packets towards each destination in a window;
+ *  - ddos: volumetric attack, the bytes towards each destination in a window;
+ *  - scan: port scan, the distinct destinations (address and port) of the SYN packets of each source in a window.
+ *  The SYN packets are sent to every branch, the others only to the branches that count all the traffic:
+ *  an operator chained to the flow identifier copies each packet once per branch reading it, tagged with
+ *  the branch, and the split sends each copy to its branch (there is no list of branches per packet).
+ */
+
+#pragma once
+#ifndef HH_QUERY_HPP
+#define HH_QUERY_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/eos.hpp"
+#include "util/hh_stats.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/trace.hpp"
+#include "util/tsc_clock.hpp"
+
+extern volatile unsigned long app_start_time;
+
+namespace query {
+
+    /// queries of the multi-query topology
+    enum class kind_t { SYN, DDOS, SCAN };
+
+    /// parameters of a query
+    struct spec_t {
+        kind_t kind = kind_t::SYN;
+        long threshold = 0;         // the keys above it in a window are reported
+        std::size_t win_ms = 0;     // window length and slide (0 takes the ones of the heavy hitter pipeline)
+        std::size_t slide_ms = 0;
+    };
+
+    inline std::string name(const kind_t k) {
+        return (k == kind_t::SYN) ? "syn" : (k == kind_t::DDOS) ? "ddos" : "scan";
+    }
+
+    /// prefix of the names of the operators of a query
+    inline std::string op_name(const kind_t k) {
+        return (k == kind_t::SYN) ? "SynFlood" : (k == kind_t::DDOS) ? "Volumetric" : "PortScan";
+    }
+
+    /// quantity compared with the threshold
+    inline std::string unit(const kind_t k) {
+        return (k == kind_t::SYN) ? "SYN packets" : (k == kind_t::DDOS) ? "bytes" : "destination ports";
+    }
+
+    /// keys of the query (destinations or sources)
+    inline std::string keys(const kind_t k) {
+        return (k == kind_t::SCAN) ? "sources" : "destinations";
+    }
+
+    inline long default_threshold(const kind_t k) {
+        return (k == kind_t::SYN) ? 1000 : (k == kind_t::DDOS) ? 10000000 : 100;
+    }
+
+    /// destination port of a keyed packet (host order)
+    inline uint32_t port_dst(const flow_len_t& t) {
+        return t.port_syn & 0xffff;
+    }
+
+    /// connection request (SYN without ACK, see packet_t)
+    inline bool syn(const flow_len_t& t) {
+        return (t.port_syn >> 16) & 1;
+    }
+
+    /// branch of a copy made by the Fan_Out operator, in the bits of port_syn above the SYN flag
+    inline std::size_t branch(const flow_len_t& t) {
+        return t.port_syn >> 17;
+    }
+
+    /**
+     * @brief Parses a list of queries in the form name[:threshold[:win_ms[:slide_ms]]],... (name is syn, ddos or scan).
+     */
+    inline std::vector<spec_t> parse(const std::string& list) {
+        std::vector<spec_t> queries;
+        std::stringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            std::vector<std::string> fields;
+            std::stringstream is(item);
+            std::string f;
+            while (std::getline(is, f, ':')) fields.push_back(f);
+            if (fields.empty() || fields.size() > 4) throw std::invalid_argument("[query] ERR: invalid query " + item + " (expected name[:threshold[:win_ms[:slide_ms]]])");
+            spec_t q;
+            if (fields[0] == "syn") q.kind = kind_t::SYN;
+            else if (fields[0] == "ddos") q.kind = kind_t::DDOS;
+            else if (fields[0] == "scan") q.kind = kind_t::SCAN;
+            else throw std::invalid_argument("[query] ERR: unknown query " + fields[0] + " (expected syn, ddos or scan)");
+            for (const auto& other : queries) {
+                if (other.kind == q.kind) throw std::invalid_argument("[query] ERR: query " + fields[0] + " given twice");
+            }
+            try {
+                q.threshold = (fields.size() > 1) ? std::stol(fields[1]) : default_threshold(q.kind);
+                if (fields.size() > 2) q.win_ms = std::stoul(fields[2]);
+                if (fields.size() > 3) q.slide_ms = std::stoul(fields[3]);
+            } catch (const std::exception&) {
+                throw std::invalid_argument("[query] ERR: invalid query " + item + " (expected name[:threshold[:win_ms[:slide_ms]]])");
+            }
+            if (q.threshold < 0) throw std::invalid_argument("[query] ERR: the threshold of " + item + " must not be negative");
+            if (fields.size() > 2 && q.win_ms == 0) throw std::invalid_argument("[query] ERR: the window of " + item + " must be positive");
+            if (q.slide_ms > q.win_ms) throw std::invalid_argument("[query] ERR: the slide of " + item + " is longer than its window");
+            queries.push_back(q);
+        }
+        if (queries.empty()) throw std::invalid_argument("[query] ERR: no queries in " + list);
+        return queries;
+    }
+
+    /**
+     * @class Fan_Out
+     * @brief Copies each keyed packet once per branch reading it (0 is the heavy hitter pipeline, i + 1 the query i).
+     */
+    class Fan_Out {
+    private:
+        std::vector<uint32_t> all;          // tags of the branches of a SYN packet
+        std::vector<uint32_t> plain;        // tags of the branches of the other packets
+
+    public:
+        explicit Fan_Out(const std::vector<spec_t>& queries) : all{0}, plain{0} {
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                all.push_back((uint32_t)(i + 1) << 17);
+                if (queries[i].kind == kind_t::DDOS) plain.push_back((uint32_t)(i + 1) << 17);
+            }
+        }
+
+        void operator()(const flow_len_t& t, wf::Shipper<flow_len_t>& shipper) const {
+            if (eos::is_marker(t)) {        // the markers only go on to the keyed stage of the heavy hitter pipeline
+                shipper.push(flow_len_t(t));
+                return;
+            }
+            for (const uint32_t tag : (syn(t)) ? all : plain) {
+                flow_len_t copy = t;
+                copy.port_syn = (t.port_syn & 0x1ffff) | tag;
+                shipper.push(std::move(copy));
+            }
+        }
+    };
+
+    /**
+     * @class Splitter
+     * @brief Splitting logic of the copies of the keyed packets (single destination: the branch of the copy).
+     */
+    class Splitter {
+    public:
+        std::size_t operator()(const flow_len_t& t) const {
+            return branch(t);
+        }
+    };
+
+    /**
+     * @class Results_Board
+     * @brief Results of the queries, merged from their sink replicas at the end of the stream.
+     */
+    class Results_Board {
+    private:
+        std::map<kind_t, hh_stats::Results_Table> tables;
+        mutable std::mutex m;
+
+    public:
+        void add(const kind_t k, const hh_stats::Results_Table& t) {
+            std::unique_lock<std::mutex> lock(m);
+            tables[k].merge(t);
+        }
+
+        /// results of a query (peak of each key above the threshold)
+        hh_stats::Results_Table get(const kind_t k) const {
+            std::unique_lock<std::mutex> lock(m);
+            const auto it = tables.find(k);
+            return (it == tables.end()) ? hh_stats::Results_Table() : it->second;
+        }
+    };
+
+    /// results of all the queries
+    inline Results_Board board;
+
+    /**
+     * @brief Writes the results of a query to report_<name>.txt (by decreasing peak) and a line on the given stream.
+     *
+     * @return number of keys above the threshold
+     */
+    inline std::size_t write_report(std::ostream& out, const spec_t& q) {
+        const hh_stats::Results_Table table = board.get(q.kind);
+        std::vector<hh_stats::Results_Table::entry_t> entries;
+        table.for_each([&entries](const hh_stats::Results_Table::entry_t& e) { entries.push_back(e); });
+        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.acc_len > b.acc_len; });
+        const std::string file = "report_" + name(q.kind) + ".txt";
+        std::ofstream report(file);
+        report << "[" << op_name(q.kind) << "-REPORT]\n";
+        for (const auto& e : entries) {
+            report << wf_tuple_t::addr_to_string((q.kind == kind_t::SCAN) ? e.ip_src : e.ip_dst) << " : max peak " << e.acc_len << " " << unit(q.kind) << '\n';
+        }
+        out << "[QUERY] " << name(q.kind) << ": " << entries.size() << " " << keys(q.kind) << " above " << q.threshold << " " << unit(q.kind)
+            << " in a window (" << file << ")" << std::endl;
+        return entries.size();
+    }
+}
+
+/**
+ * @class Query_Acc_Functor
+ *
+ * @brief Incremental accumulator of the syn and ddos queries (SYN packets or bytes of each window of a destination).
+ */
+class Query_Acc_Functor {
+private:
+    query::kind_t kind;
+
+    /// statistics & runtime info
+    std::size_t processed_tuples;
+    std::size_t replica_id;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _kind query (syn or ddos)
+     */
+    explicit Query_Acc_Functor(const query::kind_t _kind) :
+            kind(_kind),
+            processed_tuples(0),
+            replica_id(0) {}
+
+    /**
+     * @brief Adds a packet to a window of its destination.
+     *
+     * @param p packet keyed by flow
+     * @param t result of the window
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& p, hh_result_t& t, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach(query::op_name(kind) + "Accumulator", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+
+        t.ts = std::max(t.ts, p.ts);
+        t.flow_key = p.ip_dst;
+        t.ip_dst = p.ip_dst;
+        t.acc_len += (kind == query::kind_t::SYN) ? 1 : p.total_len;     // the syn branch only receives SYN packets
+
+        processed_tuples++;
+        probe->tuples_in.add();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Query_Acc_Functor() = default;
+};
+
+/**
+ * @class Scan_Acc_Functor
+ *
+ * @brief Accumulator of the scan query (distinct destinations of the SYN packets of each window of a source).
+ */
+class Scan_Acc_Functor {
+private:
+    std::vector<uint64_t> targets;      // destinations (address and port) of the current window
+
+    /// statistics & runtime info
+    std::size_t replica_id;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     */
+    Scan_Acc_Functor() : replica_id(0) {}
+
+    /**
+     * @brief Counts the distinct destinations of a window of SYN packets of a source.
+     *
+     * @param win window of SYN packets of a source
+     * @param t result of the window
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const wf::Iterable<flow_len_t>& win, hh_result_t& t, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach(query::op_name(query::kind_t::SCAN) + "Accumulator", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        probe->tuples_out.add();
+        if (win.size() == 0) return;
+
+        targets.clear();
+        for (const auto& p : win) {
+            targets.push_back(((uint64_t)p.ip_dst << 16) | query::port_dst(p));
+        }
+        std::sort(targets.begin(), targets.end());
+        t.ts = win[win.size() - 1].ts;
+        t.flow_key = win[win.size() - 1].ip_src;
+        t.ip_src = win[win.size() - 1].ip_src;
+        t.acc_len = std::unique(targets.begin(), targets.end()) - targets.begin();
+
+        probe->tuples_in.add(win.size());
+        probe->record_window(win.size());
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Scan_Acc_Functor() = default;
+};
+
+/**
+ * @class Query_Detector_Functor
+ *
+ * @brief Detector of a query: forwards the window results above its threshold.
+ */
+class Query_Detector_Functor {
+private:
+    query::spec_t spec;
+
+    /// statistics & runtime info
+    std::size_t replica_id;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _spec query
+     */
+    explicit Query_Detector_Functor(const query::spec_t& _spec) : spec(_spec), replica_id(0) {}
+
+    /**
+     * @brief Selects the window results above the threshold of the query.
+     *
+     * @param t input window result
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     * @return true if the result is above the threshold
+     */
+    bool operator()(hh_result_t& t, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach(query::op_name(spec.kind) + "Detector", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        probe->tuples_in.add();
+        if (!t.ts || t.acc_len <= (uint64_t)spec.threshold) return false;
+        probe->tuples_out.add();
+        return true;
+    }
+};
+
+/**
+ * @class Query_Sink_Functor
+ *
+ * @brief Sink of a query: keeps the peak of each reported key and publishes them at the end of the stream.
+ */
+class Query_Sink_Functor {
+private:
+    query::kind_t kind;
+    hh_stats::Results_Table results;
+
+    /// statistics & runtime info
+    std::size_t replica_id;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _kind query
+     */
+    explicit Query_Sink_Functor(const query::kind_t _kind) : kind(_kind), replica_id(0) {}
+
+    /**
+     * @brief Records a result of the query, or publishes the results at the end of the stream.
+     *
+     * @param t input tuple
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(std::optional<hh_result_t>& t, wf::RuntimeContext& rc) {
+        if (!probe.attached()) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach(query::op_name(kind) + "Sink", replica_id);
+        }
+        if (t.has_value()) {
+            metrics::Probe::Scope timed(probe);
+            probe->tuples_in.add();
+            if (tsc::marked(t->ts)) {
+                const uint64_t now = tsc::now();
+                probe->record_latency((now > t->ts) ? now - t->ts : 0);
+            }
+            if (results.upsert(t->flow_key, t->ip_src, t->ip_dst, t->acc_len) == hh_stats::Results_Table::upsert_t::INSERTED) {
+                probe->state_bytes.set(results.memory());
+                probe->live_flows.set(results.size());
+            }
+        } else {
+            /// stream is terminated here (EOS)
+            probe->exec_time.set(tsc::now() - app_start_time);
+            query::board.add(kind, results);
+            if (trace::summary()) {
+                std::cout << "[" << query::op_name(kind) << "Sink-" << replica_id << "] " << results.size() << " " << query::keys(kind)
+                          << " above the threshold." << std::endl;
+            }
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Query_Sink_Functor() = default;
+};
+
+#endif //HH_QUERY_HPP
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    sampler.hpp
+ *
+ *  @brief Sampler node keeping 1 in N packets, or the packets of 1 in N flows, of the stream of the sources.
+ *
+ *  The operator is chained to the sources, so the packets dropped never reach the queues of the flow
+ *  identifier: the load of the whole pipeline shrinks with the sampling rate. The lengths of the
+ *  packets kept by packet sampling are scaled back up by the flow identifier (see sampling.hpp).
+ */
+
+#pragma once
+#ifndef HH_SAMPLER_HPP
+#define HH_SAMPLER_HPP
+
+#include <iostream>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/eos.hpp"
+#include "util/flow.hpp"
+#include "util/registry.hpp"
+#include "util/sampling.hpp"
+#include "util/trace.hpp"
+
+/**
+ * @class Sampler_Functor
+ *
+ * @brief Define the logic of the operator sampling the packets emitted by a source replica.
+ *
+ * Packet sampling is deterministic: each replica keeps the first packet it receives and then every
+ * N-th one. Flow sampling keeps the packets of the flows selected by the hash of their key, the same
+ * in every replica.
+ *
+ * @tparam DEF fields identifying a flow (flow sampling)
+ */
+template<flow::flow_def_t DEF = flow::flow_def_t::TWO_TUPLE>
+class Sampler_Functor {
+private:
+    sampling::spec_t spec;
+    uint32_t countdown;                 // packets before the next one kept (packet sampling)
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long kept_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _spec sampling mode and rate
+     */
+    explicit Sampler_Functor(const sampling::spec_t& _spec) :
+            spec(_spec),
+            countdown(1),
+            processed_tuples(0),
+            kept_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Keeps the sampled packets and filters away the others.
+     *
+     * @param t input packet
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     * @return true if the packet is kept, false otherwise
+     */
+    bool operator()(packet_t& t, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) return true;      // the end of the stream is never sampled away (see eos.hpp)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("Sampler", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        processed_tuples++;
+        probe->tuples_in.add();
+
+        bool keep;
+        if (spec.mode == sampling::mode_t::PACKET) {
+            keep = (--countdown == 0);
+            if (keep) countdown = spec.rate;
+        } else {
+            keep = sampling::keeps_flow(flow::key<DEF>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol), spec.rate);
+        }
+        if (!keep) return false;
+
+        kept_tuples++;
+        probe->tuples_out.add();
+        const uint64_t len = 18 + ntohs(t.ip_len);     // same length as the flow identifier, before scaling
+        probe->bytes_out.add(len);
+        probe->bytes_sq_out.add(len * len);
+        return true;
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Sampler_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[Sampler-" << replica_id << "] a total number of " << kept_tuples << " packets have been kept out of "
+                          << processed_tuples << " received." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_SAMPLER_HPP
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    sharded_source.hpp
+ *
+ *  @brief Source node replaying a disjoint shard of the dataset in each replica.
+ *
+ *  All the replicas share a single read-only copy of the dataset. At startup each replica
+ *  copies its own slice (a contiguous range of packets, or the packets whose flow, in the flow
+ *  definition of the run, hashes to the replica) into a vector allocated and first touched by the replica thread, so that the pages
+ *  are placed on the NUMA node of the core running the replica. When the last replica has taken
+ *  its slice the shared copy is released, so the resident dataset is not multiplied by the
+ *  source parallelism, and the replicas together replay the original trace once per generation.
+ *  With several input files, the dataset holds the inputs of each replica one after the other and
+ *  each replica takes its own range (its inputs, merged on the capture timestamps).
+ */
+
+#pragma once
+#ifndef HH_SHARDED_SOURCE_HPP
+#define HH_SHARDED_SOURCE_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "nodes/source.hpp"
+#include "util/memory.hpp"
+#include "util/metric.hpp"
+#include "util/pacer.hpp"
+#include "util/event_time.hpp"
+#include "util/eos.hpp"
+#include "util/flow.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
+
+extern volatile unsigned long app_start_time;
+extern volatile unsigned long app_run_time;
+
+/**
+ * @brief Policies to split the dataset among the source replicas (INPUT: the given range of each replica).
+ */
+enum class shard_policy_t { RANGE, HASH, INPUT };
+
+/**
+ * @class Sharded_Source_Functor
+ *
+ * @brief Define the logic of the Source replaying its own shard of the dataset.
+ */
+class Sharded_Source_Functor {
+private:
+    /// operator state & statistics
+    std::shared_ptr<const packets_t> dataset;    // whole dataset (shared, released after sharding)
+    packets_t shard;                    // packets replayed by this replica (NUMA-local)
+    shard_policy_t policy;              // how the dataset is split among the replicas
+    flow::flow_def_t def;               // flow definition of the HASH policy
+    std::vector<std::size_t> offsets;   // first packet of each replica, and end of the dataset (INPUT policy)
+    int generations;                    // counts the times the shard is replayed
+    long generated_tuples;              // total number of generated tuples
+    pacer::Source_Pacer pacer;          // stream generation pacing (global rate or trace replay)
+    event_time::Event_Clock clock;      // emission in ingress time or event time
+
+    /// runtime info
+    std::size_t replica_id;
+    metrics::Replica_Stats* stats;      // live counters of the replica
+    std::size_t parallelism;
+
+    /// time variables
+    unsigned long current_time;
+
+    /**
+     * @brief Selects the replica in charge of a packet (all the packets of a flow go to the same replica).
+     */
+    std::size_t shard_of(const packet_t& t, const std::size_t n) const {
+        uint64_t k = 0;
+        flow::with_def(def, [&](auto d) { k = flow::key<d>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol); });
+        return ((k * 0x9e3779b97f4a7c15ULL) >> 32) % n;
+    }
+
+    /**
+     * @brief Copies the shard of this replica out of the shared dataset, then drops the reference to it.
+     */
+    void build_shard() {
+        const std::size_t size = dataset->size();
+        if (policy == shard_policy_t::RANGE) {
+            const std::size_t first = size * replica_id / parallelism;
+            const std::size_t last = size * (replica_id + 1) / parallelism;
+            shard.assign(dataset->begin() + first, dataset->begin() + last);
+        } else if (policy == shard_policy_t::INPUT) {
+            if (replica_id + 1 < offsets.size()) {
+                shard.assign(dataset->begin() + offsets[replica_id], dataset->begin() + offsets[replica_id + 1]);
+            }
+        } else {
+            shard.reserve(size / parallelism + 1);
+            for (const auto& t : *dataset) {
+                if (shard_of(t, parallelism) == replica_id) shard.push_back(t);
+            }
+            shard.shrink_to_fit();
+        }
+        dataset.reset();    // the last replica frees the shared copy
+
+        if (trace::summary()) {
+            unsigned cpu = 0, node = 0;
+            syscall(SYS_getcpu, &cpu, &node, nullptr);
+            std::cout << "[Source-" << replica_id << "] shard of " << shard.size() << " packets"
+                      << " (cpu " << cpu << ", numa node " << node << ")" << std::endl;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _dataset all the tuples that will compose the stream (moved into the shared copy)
+     * @param _policy policy used to split the dataset among the replicas
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
+     * @param _def flow definition hashed by the HASH policy
+     */
+    Sharded_Source_Functor(packets_t& _dataset, const shard_policy_t _policy, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock,
+                           const flow::flow_def_t _def = flow::flow_def_t::TWO_TUPLE) :
+            dataset(std::make_shared<const packets_t>(std::move(_dataset))),
+            policy(_policy),
+            def(_def),
+            generations(0),
+            generated_tuples(0),
+            pacer(_pacer),
+            clock(_clock),
+            replica_id(0),
+            stats(nullptr),
+            parallelism(1),
+            current_time(app_start_time) {}
+
+    /**
+     * @brief Constructor (the dataset holds the inputs of the replicas one after the other).
+     *
+     * @param _dataset all the tuples that will compose the stream (moved into the shared copy)
+     * @param _offsets first packet of the inputs of each replica, followed by the size of the dataset
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
+     */
+    Sharded_Source_Functor(packets_t& _dataset, const std::vector<std::size_t>& _offsets, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock) :
+            Sharded_Source_Functor(_dataset, shard_policy_t::INPUT, _pacer, _clock) {
+        offsets = _offsets;
+    }
+
+    /**
+     * @brief Sends the packet tuples of this replica's shard in a item-by-item fashion.
+     *
+     * @param shipper Source_Shipper object used for generating input tuples
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(wf::Source_Shipper<packet_t>& shipper, wf::RuntimeContext& rc) {
+        replica_id = rc.getReplicaIndex();
+        stats = metrics::registry.replica("Source", replica_id);
+        placement::placement.bind("Source", replica_id);
+        parallelism = rc.getParallelism();
+        build_shard();
+        stats->state_bytes.set(memory::bytes_of(shard));
+        if (shard.empty()) {
+            std::cerr << "[Sharded_Source] ERR: replica " << replica_id << " received an empty shard." << std::endl;
+        }
+        std::size_t next_tuple_idx = 0;
+
+        pacer.start();
+        tsc::Stamper stamper;           // batch-level timestamps and latency markers
+        stamper.start();
+        current_time = stamper.time(); // get the current time
+
+        eos::Idle_Flush idle(shipper, clock);     // flush markers while the pacer waits
+
+        /// generation loop
+        while (!shard.empty() && (current_time - app_start_time <= app_run_time) && !Source_Functor::terminate) {
+            /// count the number of generations
+            if (next_tuple_idx == 0) {
+                if (Source_Functor::replayed(generations)) break;
+                if (generations > 0) {
+                    pacer.next_generation();
+                    clock.next_generation();
+                }
+                generations++;
+            }
+
+            /// generate new tuple
+            packet_t t(shard[next_tuple_idx]);
+            const uint64_t capture_ts = t.ts;
+            if (const uint64_t now = pacer.pace(capture_ts, idle)) stamper.refresh(now);     // wait for the emission slot of the tuple
+            t.ts = stamper.stamp();
+            if (trace::debug()) {
+                std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples
+                          << ", " << t.print() << std::endl;
+            }
+            clock.push(shipper, std::move(t), capture_ts);     // send the tuple
+            idle.sent();
+
+            /// index of the next tuple to generate
+            if (++next_tuple_idx == shard.size()) next_tuple_idx = 0;
+
+            /// update global tuple counter
+            generated_tuples++;
+            stats->tuples_out.add();
+
+            current_time = stamper.time(); // get the new current time (read once per batch of tuples)
+        }
+
+        /// EOS is reached here, start source termination
+        eos::send(shipper, clock);      // the operators which hold packets or windows flush them
+        stats->exec_time.set(tsc::now() - app_start_time);
+        if (trace::summary()) {
+            std::cout << "[Source-" << replica_id << " started termination..."
+                      << " (generated tuples: " << generated_tuples
+                      << ", generations: " << generations << ")" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Sharded_Source_Functor() = default;
+};
+
+#endif //HH_SHARDED_SOURCE_HPP
@@ -40,13 +40,17 @@
 #include <algorithm>
 #include <iostream>
 #include <cstring>
-#include "tuples/wf_tuple.hpp"
+#include <type_traits>
+#include "tuples/hh_tuples.hpp"
+#include "util/alerts.hpp"
+#include "util/eos.hpp"
 #include "util/metric.hpp"
 #include "util/hh_stats.hpp"
+#include "util/stage_trace.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
 
-extern std::atomic<long> received_tuples;           // total number of tuples received by all the sinks in the Data-Flow graph
 extern metrics::Metrics_Aggregator latency_aggr;    // latency statistics aggregator
-extern metrics::Atomic_Double sink_exec_time;       // sum of the execution times (milliseconds) of all the sink replicas
 extern hh_stats::Results_Aggregator result_aggr;    // heavy hitter results aggregator
 extern volatile unsigned long app_start_time;
 
@@ -54,15 +58,60 @@ extern volatile unsigned long app_start_time;
  * @class Sink_Functor
  * 
  * @brief Define the logic of the Sink receiving the final results.
+ *
+ * @tparam tuple_t type of the received tuples (hh_result_t, or packet_t when the sink is fed by the sources)
  */
+template<typename tuple_t = hh_result_t>
 class Sink_Functor {
 private:
     /// statistics, results, runtime info
     long processed_tuples;
     hh_stats::Results_Collector res_coll;
-    std::vector<double> tuple_latencies;
     metrics::Metrics_Collector metrics_coll;
     std::size_t replica_id;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /// processes a result (received, or handed by the drains at the end of the stream)
+    void receive(const tuple_t& t, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            metrics_coll.set_sink(replica_id);
+            res_coll.set_sink(replica_id);
+            probe.attach("Sink", replica_id);
+        }
+        metrics::Probe::Scope timed(probe);
+        if (trace::debug()) {
+            std::cout << "[Sink-" << replica_id << "] received packet " << processed_tuples << ", " << t.print() << std::endl;
+        }
+        /// update global tuple counter
+        processed_tuples++;
+
+        /// update latency samples (only the tuples carrying a latency marker read the clock)
+        probe->tuples_in.add();
+        if (tsc::marked(t.ts)) {
+            probe->record_latency(metrics_coll.update(t));
+            stage_trace::complete(replica_id, t.ts);
+        }
+
+        /// update heavy hitter statistics (and stream the new, raised or cleared ones, if the alerts are enabled)
+        if constexpr (std::is_same_v<tuple_t, hh_result_t>) {
+            if (t.acc_len == 0) {      // the flow stopped being heavy (change-only detection)
+                if (alerts::writer.enabled()) {
+                    alerts::writer.publish(replica_id, alerts::alert_t{tsc::now(), t.flow_key, 0, t.ip_src, t.ip_dst, false});
+                }
+            } else {
+                const auto changed = res_coll.update(t);
+                if (changed == hh_stats::Results_Table::upsert_t::INSERTED) {
+                    probe->state_bytes.set(res_coll.get_collection_memory());
+                    probe->live_flows.set(res_coll.get_collection_size());
+                }
+                if (changed != hh_stats::Results_Table::upsert_t::UNCHANGED && alerts::writer.enabled()) {
+                    alerts::writer.publish(replica_id, alerts::alert_t{tsc::now(), t.flow_key, t.acc_len, t.ip_src, t.ip_dst,
+                                                                       changed == hh_stats::Results_Table::upsert_t::INSERTED});
+                }
+            }
+        }
+    }
 
 public:
     /**
@@ -76,48 +125,30 @@ public:
     /**
      * @brief Prints results and evaluates latency statistics.
      *
-     * @param t input wf tuple
+     * @param t input tuple
      * @param rc RuntimeContext providing information on parallelism degree and replica id
      */
-    void operator()(std::optional<wf_tuple_t>& t, wf::RuntimeContext& rc) {
+    void operator()(std::optional<tuple_t>& t, wf::RuntimeContext& rc) {
         if (t.has_value()) {    // valid tuple
-            if (processed_tuples == 0) {
-                replica_id = rc.getReplicaIndex();
-                metrics_coll.set_sink(replica_id);
-                res_coll.set_sink(replica_id);
-            }
-#ifdef DEBUG_PRINT
-            std::cout << "[Sink-" << replica_id << "] received packet " << processed_tuples << ", " << t->print_essential(1) << std::endl;
-#endif
-            /// update global tuple counter
-            processed_tuples++;
-
-            /// update latency samples
-            metrics_coll.update(t.value());
-
-            /// update heavy hitter statistics
-            res_coll.update(t.value());
-
+            receive(t.value(), rc);
         } else {
-            /// stream is terminated here (EOS)
-#ifdef PRINT_OP_RESULTS
-            std::cout << "[Sink-" << replica_id << " started termination... (processed tuples: "
-                      << processed_tuples
-                      << ", heavy hitters detected: "
-                      << res_coll.get_collection_size() << ")" << std::endl;
-#endif
-            sink_exec_time.fetch_add((double)(wf::current_time_nsecs() - app_start_time) / 1000000L);  // sink replica execution time (milliseconds)
-
-            /// manage metrics and results as last thing
-            if (processed_tuples == 0) {
-                latency_aggr.add_empty_sink();
-                result_aggr.add_empty_sink();
+            /// stream is terminated here (EOS): the last replica also takes the results still held by the operators
+            if constexpr (std::is_same_v<tuple_t, hh_result_t>) {
+                eos::sink_ended(rc.getParallelism(), [&](const hh_result_t& r) { receive(r, rc); });
             }
-            else {
-                received_tuples.fetch_add(processed_tuples);
-                //metrics_coll.add(std::move(tuple_latencies));     // it is now done in an incremental way with metrics_coll.update()
-                latency_aggr.add_collector(std::move(metrics_coll));
-                result_aggr.add_res_collector(std::move(res_coll));
+            if (trace::summary()) {
+                std::cout << "[Sink-" << replica_id << " started termination... (processed tuples: "
+                          << processed_tuples
+                          << ", heavy hitters detected: "
+                          << res_coll.get_collection_size() << ")" << std::endl;
+            }
+            if (!probe.attached()) probe.attach("Sink", rc.getReplicaIndex());
+            probe->exec_time.set(tsc::now() - app_start_time);     // sink replica execution time
+
+            /// manage metrics and results as last thing (each replica fills its own slot of the aggregators)
+            if (processed_tuples > 0) {
+                latency_aggr.add_collector(replica_id, std::move(metrics_coll));
+                result_aggr.add_res_collector(replica_id, std::move(res_coll));
             }
         }
     }
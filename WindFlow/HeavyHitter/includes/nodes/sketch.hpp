@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    sketch.hpp
+ *
+ *  @brief Sketch-based heavy hitter detection, in bounded memory.
+ *
+ *  Alternative to the ByteLenAccumulator and HeavyHitterDetector operators. The packets are
+ *  partitioned by flow among the replicas of the Sketch operator, and each replica counts the bytes
+ *  of its flows in a sliding-window Count-Min sketch of fixed size, so the estimate of a flow covers
+ *  all its packets. The flows whose estimate exceeds the threshold are kept as candidates: whenever
+ *  the window slides, the candidates still above the threshold are emitted as heavy hitters. The
+ *  open window is closed at the end of the stream, once the markers of all the sources have been
+ *  received (see eos.hpp).
+ */
+
+#pragma once
+#ifndef HH_SKETCH_HPP
+#define HH_SKETCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <unordered_map>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/count_min.hpp"
+#include "util/eos.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
+
+extern long threshold;
+extern std::atomic<uint64_t> sketch_window_bytes;   // sum over the sketch replicas of the largest window volume (bytes)
+
+/**
+ * @class Sketch_Functor
+ *
+ * @brief Define the logic of the operator counting the bytes of the flows in a Count-Min sketch (partitioned on flow key).
+ */
+class Sketch_Functor {
+private:
+    /// candidate heavy hitter flow
+    struct candidate_t {
+        uint64_t ts;                // generation time of the last packet
+        uint32_t ip_src, ip_dst;
+    };
+
+    sketch::Window_Count_Min cm;                            // window sketch of this replica
+    arena::unordered_map<uint64_t, candidate_t> candidates;  // flows above the threshold
+    uint64_t slide_us;              // window slide (microseconds)
+    uint64_t epoch;                 // slide index of the current pane
+    uint64_t max_window_bytes;      // largest volume of a window in this replica
+    eos::Markers markers;           // end of the stream of the sources
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long heavy_hitters;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    /**
+     * @brief Sends the candidates above the threshold in the window closed by the current slide.
+     */
+    void close_window(wf::Shipper<hh_result_t>& shipper) {
+        const uint64_t bytes = cm.get_window_bytes();
+        if (bytes > max_window_bytes) {
+            sketch_window_bytes.fetch_add(bytes - max_window_bytes, std::memory_order_relaxed);
+            max_window_bytes = bytes;
+        }
+        probe->record_window(candidates.size());
+        probe->state_bytes.set(cm.get_memory() + memory::bytes_of_map(candidates));
+        probe->live_flows.set(candidates.size());
+        for (auto it = candidates.begin(); it != candidates.end();) {
+            const uint64_t est = cm.estimate(it->first);
+            if (est <= (uint64_t)std::max(threshold, 0L)) {   // no more a candidate
+                it = candidates.erase(it);
+                continue;
+            }
+            hh_result_t r;
+            r.ts = it->second.ts;
+            r.flow_key = it->first;
+            r.acc_len = est;
+            r.ip_src = it->second.ip_src;
+            r.ip_dst = it->second.ip_dst;
+            stage_trace::stamp(stage_trace::WINDOW_CLOSE, r.ts);
+            shipper.push(std::move(r));
+            heavy_hitters++;
+            probe->tuples_out.add();
+            ++it;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _width counters per row of the sketch
+     * @param _depth rows of the sketch
+     * @param _win_us window length (microseconds)
+     * @param _slide_us window slide (microseconds)
+     */
+    Sketch_Functor(const std::size_t _width, const std::size_t _depth, const uint64_t _win_us, const uint64_t _slide_us) :
+            cm(_width, _depth, (_win_us + _slide_us - 1) / _slide_us),
+            slide_us(_slide_us),
+            epoch(0),
+            max_window_bytes(0),
+            processed_tuples(0),
+            heavy_hitters(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Counts the bytes of a packet and, at the end of each slide, emits the heavy hitters.
+     *
+     * @param t input packet keyed by flow
+     * @param shipper Shipper object used to emit the heavy hitters
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const flow_len_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (eos::is_marker(t)) {        // all the sources ended: close the open window
+            if (markers.last() && processed_tuples > 0) {
+                metrics::Probe::Scope timed(probe);
+                close_window(shipper);
+            }
+            return;
+        }
+        const uint64_t now = rc.getCurrentTimestamp() / slide_us;     // slide of the packet (ingress or event time)
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            if (probe.attach("Sketch", replica_id)) {
+                cm = sketch::Window_Count_Min(cm);      // first touch of the counters on the node of the replica
+            }
+            epoch = now;
+        }
+        metrics::Probe::Scope timed(probe);
+        stage_trace::stamp(stage_trace::ACC_IN, t.ts);
+
+        if (now > epoch) {
+            /// the window ends: only the first closed window is emitted, the next ones (if no packet has been
+            /// received for more than a slide) contain a subset of its panes and so cannot have larger counts
+            close_window(shipper);
+            if (now - epoch >= cm.get_panes()) {
+                cm.clear();
+            } else {
+                for (uint64_t e = epoch; e < now; e++) cm.slide();
+            }
+            epoch = now;
+        }
+
+        const uint64_t est = cm.update(t.flow_key, t.total_len);
+        if (est > (uint64_t)std::max(threshold, 0L)) {
+            candidates[t.flow_key] = candidate_t{t.ts, t.ip_src, t.ip_dst};
+        }
+        processed_tuples++;
+        probe->tuples_in.add();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Sketch_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[Sketch-" << replica_id << "] a total number of " << processed_tuples << " packets have been processed, "
+                          << heavy_hitters << " heavy hitters detected." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_SKETCH_HPP
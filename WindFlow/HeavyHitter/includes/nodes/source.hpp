@@ -34,21 +34,31 @@
  * 
  *  Source node which reads packets from a pre-filled dataset in memory and
  *  generates the tuple stream to feed the application processing graph.
+ *
+ *  With no pacing, in ingress time and without debug tracing there is nothing to do between two
+ *  tuples, so the replica emits the dataset in contiguous chunks (bulk emission): the packets are
+ *  read sequentially, each one is stamped in the tuple moved into the output batch of the shipper,
+ *  and the index wraps around once per chunk. The termination condition is checked between chunks.
  */
 
 #pragma once
 #ifndef HH_STANDARD_SOURCE_HPP
 #define HH_STANDARD_SOURCE_HPP
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 #include <string>
 #include <windflow.hpp>
-#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "util/memory.hpp"
 #include "util/metric.hpp"
+#include "util/pacer.hpp"
+#include "util/event_time.hpp"
+#include "util/eos.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
 
-extern std::atomic<long> sent_tuples;                   // total number of tuples emitted by all the sources in the Data-Flow graph
-extern metrics::Atomic_Double source_exec_time;         // sum of the execution times (milliseconds) of all the source replicas
 extern volatile unsigned long app_start_time;
 extern volatile unsigned long app_run_time;
 
@@ -60,29 +70,35 @@ extern volatile unsigned long app_run_time;
 class Source_Functor {
 private:
     /// operator state & statistics
-    std::vector<wf_tuple_t> dataset;    // contains all the packet tuples
+    packets_t dataset;                  // contains all the packet tuples
     std::size_t next_tuple_idx;         // index of the next tuple to be sent
     int generations;                    // counts the times the input pcap file is generated
     long generated_tuples;              // total number of generated tuples
-    int rate;                           // stream generation rate
+    pacer::Source_Pacer pacer;          // stream generation pacing (global rate or trace replay)
+    event_time::Event_Clock clock;      // emission in ingress time or event time
     
     /// runtime info
     std::size_t replica_id;
+    metrics::Replica_Stats* stats;      // live counters of the replica
 
     /// time variables
     unsigned long current_time;
+    tsc::Stamper stamper;               // batch-level timestamps and latency markers
 
     /**
-     *  @brief Add some active delay (busy-waiting function)
+     * @brief Emits a contiguous range of the dataset in ingress time (bulk emission).
      *
-     *  @param waste_time wait time in nanoseconds
+     * @param first first packet of the range
+     * @param last end of the range
+     * @param stamper timestamps of the replica
+     * @param shipper shipper of the replica (or any object with a push taking the tuple by rvalue)
      */
-    static void active_delay(unsigned long waste_time) {
-        auto start_time = wf::current_time_nsecs();
-        bool end = false;
-        while (!end) {
-            auto end_time = wf::current_time_nsecs();
-            end = (end_time - start_time) >= waste_time;
+    template<typename shipper_t>
+    static inline void emit_range(const packet_t* first, const packet_t* last, tsc::Stamper& stamper, shipper_t& shipper) {
+        for (const packet_t* p = first; p != last; p++) {
+            packet_t t(*p);
+            t.ts = stamper.stamp();
+            shipper.push(std::move(t));
         }
     }
 
@@ -90,70 +106,144 @@ public:
     /// the termination condition can be a received SIGINT/SIGTERM or the expiration of the time frame defined by app_run_time (set in fc.cpp)
     inline static volatile bool terminate;
 
+    /// generations of the input replayed by each source replica before its termination (0 replays it until the end of the run time)
+    inline static int max_generations;
+
+    /**
+     * @brief Checks if a replica has replayed all the generations of its input.
+     *
+     * @param generations generations started by the replica
+     */
+    static bool replayed(const int generations) {
+        return max_generations > 0 && generations >= max_generations;
+    }
+
+    /// tuples emitted between two checks of the termination condition (bulk emission)
+    static constexpr std::size_t CHUNK = 256;
+
     /**
      * @brief Constructor.
      *
      * @param _dataset all the tuples that will compose the stream
-     * @param _rate stream generation rate
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
      */
-    Source_Functor(std::vector<wf_tuple_t>& _dataset, const int _rate) :
+    Source_Functor(packets_t& _dataset, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock) :
             dataset(std::move(_dataset)),
             current_time(app_start_time),
             next_tuple_idx(0),
             generations(0),
             generated_tuples(0),
-            rate(_rate),
-            replica_id(0) {}
+            pacer(_pacer),
+            clock(_clock),
+            replica_id(0),
+            stats(nullptr) {}
+
+    /**
+     * @brief Measures the largest emission rate of a replica, emitting the dataset in bulk to a shipper that drops the tuples.
+     *
+     * @param _dataset all the tuples that will compose the stream
+     * @param _ms length of the measure (milliseconds)
+     * @return tuples per second (0 if the dataset is empty)
+     */
+    static double max_emit_rate(const packets_t& _dataset, const uint64_t _ms = 200) {
+        struct null_shipper_t {
+            uint64_t digest = 0;        // keeps the tuples from being optimised away
+            inline void push(packet_t&& t) {
+                digest += t.ts ^ t.ip_src;
+            }
+        } shipper;
+        if (_dataset.empty()) return 0;
+        tsc::Stamper stamper;
+        stamper.start();
+        const uint64_t start = stamper.time();
+        uint64_t emitted = 0;
+        std::size_t next = 0;
+        while (stamper.time() - start < _ms * 1000000) {
+            const std::size_t end = std::min(next + CHUNK, _dataset.size());
+            emit_range(_dataset.data() + next, _dataset.data() + end, stamper, shipper);
+            emitted += end - next;
+            next = (end == _dataset.size()) ? 0 : end;
+        }
+        const uint64_t elapsed = tsc::now() - start;
+        volatile uint64_t digest = shipper.digest;
+        (void)digest;
+        return (elapsed > 0) ? emitted * 1e9 / elapsed : 0;
+    }
 
     /**
-     * @brief Sends packet tuples in a item-by-item fashion.
+     * @brief Sends packet tuples in a item-by-item fashion, or in contiguous chunks when nothing happens between two tuples.
      *
      * @param shipper Source_Shipper object used for generating input tuples
      * @param rc RuntimeContext providing information on parallelism degree and replica id
      */
-    void operator()(wf::Source_Shipper<wf_tuple_t>& shipper, wf::RuntimeContext& rc) {
-        current_time = wf::current_time_nsecs(); // get the current time
+    void operator()(wf::Source_Shipper<packet_t>& shipper, wf::RuntimeContext& rc) {
+        stamper.start();
+        current_time = stamper.time(); // get the current time
 
-        if (generated_tuples == 0) replica_id = rc.getReplicaIndex();
+        if (generated_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            stats = metrics::registry.replica("Source", replica_id);
+            if (placement::placement.bind("Source", replica_id)) {
+                packets_t(dataset).swap(dataset);     // first touch of the dataset on the node of the replica
+            }
+            stats->state_bytes.set(memory::bytes_of(dataset));   // packets replayed by the replica
+            pacer.start();
+        }
+        const bool bulk = !pacer.enabled() && !clock.is_enabled() && !trace::debug();
+
+        eos::Idle_Flush idle(shipper, clock);     // flush markers while the pacer waits
 
         /// generation loop
-    	while ((current_time - app_start_time <= app_run_time) && !terminate) {
+    	while ((current_time - app_start_time <= app_run_time) && !terminate && !dataset.empty()) {
 
             /// count the number of generations
-            if (next_tuple_idx == 0) generations++;
-
-            /// generate new tuple
-            wf_tuple_t t(dataset.at(next_tuple_idx));
-            t.ts = wf::current_time_nsecs();
-            shipper.push(t);     // send the tuple
-
-            /// index of the next tuple to generate
-            next_tuple_idx = (next_tuple_idx + 1) % dataset.size();
-
-#ifdef DEBUG_PRINT
-            std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples
-                      << ", " << t.print() << std::endl;
-#endif
-            /// update global tuple counter
-            generated_tuples++;
-            
-            if (rate != 0) { // active waiting to respect the generation rate
-	            long delay_nsec = (long) ((1.0 / rate) * 1e9);
-	            active_delay(delay_nsec);
-	        }
-            current_time = wf::current_time_nsecs(); // get the new current time
-
-            /// EOS is reached here, start source termination
-            if ((current_time - app_start_time > app_run_time) || terminate) {
-                /// update throughput statistics
-                source_exec_time.fetch_add((double)(wf::current_time_nsecs() - app_start_time) / 1000000L);
-                sent_tuples.fetch_add(generated_tuples);
-
-#ifdef PRINT_OP_RESULT
-                std::cout << "[Source-" << replica_id << " started termination..."
-                          << " (generated tuples: " << generated_tuples << ")" << std::endl;
-#endif
+            if (next_tuple_idx == 0) {
+                if (replayed(generations)) break;
+                if (generations > 0) {
+                    pacer.next_generation();
+                    clock.next_generation();
+                }
+                generations++;
             }
+
+            if (bulk) {
+                /// send the next chunk, up to the end of the dataset
+                const std::size_t end = std::min(next_tuple_idx + CHUNK, dataset.size());
+                emit_range(dataset.data() + next_tuple_idx, dataset.data() + end, stamper, shipper);
+                generated_tuples += end - next_tuple_idx;
+                stats->tuples_out.add(end - next_tuple_idx);
+                next_tuple_idx = (end == dataset.size()) ? 0 : end;
+            } else {
+                /// generate new tuple
+                packet_t t(dataset[next_tuple_idx]);
+                const uint64_t capture_ts = t.ts;
+                if (const uint64_t now = pacer.pace(capture_ts, idle)) stamper.refresh(now);     // wait for the emission slot of the tuple
+                t.ts = stamper.stamp();
+                if (trace::debug()) {
+                    std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples
+                              << ", " << t.print() << std::endl;
+                }
+                clock.push(shipper, std::move(t), capture_ts);     // send the tuple
+                idle.sent();
+
+                /// index of the next tuple to generate
+                if (++next_tuple_idx == dataset.size()) next_tuple_idx = 0;
+
+                /// update global tuple counter
+                generated_tuples++;
+                stats->tuples_out.add();
+            }
+
+            current_time = stamper.time(); // get the new current time (read once per batch of tuples)
+        }
+
+        /// EOS is reached here, start source termination
+        eos::send(shipper, clock);      // the operators which hold packets or windows flush them
+        stats->exec_time.set(tsc::now() - app_start_time);      // update throughput statistics
+        if (trace::summary()) {
+            std::cout << "[Source-" << replica_id << " started termination..."
+                      << " (generated tuples: " << generated_tuples << ")" << std::endl;
         }
     }
 
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    stream_source.hpp
+ *
+ *  @brief Source node generating the input stream from a trace file read on demand.
+ *
+ *  Source node which pulls the packets lazily from a streaming reader (e.g. Pcap_Mmap_Reader)
+ *  instead of a pre-filled dataset in memory. The trace is replayed from the beginning each
+ *  time its end is reached, until the application run time expires.
+ *
+ *  With several traces (e.g. one capture per NIC queue) each replica reads its own ones, the
+ *  traces i with i % parallelism equal to its index, merged on the capture timestamps.
+ */
+
+#pragma once
+#ifndef HH_STREAM_SOURCE_HPP
+#define HH_STREAM_SOURCE_HPP
+
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "nodes/source.hpp"
+#include "util/metric.hpp"
+#include "util/pacer.hpp"
+#include "util/event_time.hpp"
+#include "util/eos.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
+
+extern volatile unsigned long app_start_time;
+extern volatile unsigned long app_run_time;
+
+/**
+ * @class Stream_Source_Functor
+ *
+ * @brief Define the logic of the Source reading the trace on demand.
+ *
+ * @tparam reader_t streaming reader type, providing open(), next(wf_tuple_t&) and rewind()
+ */
+template<typename reader_t>
+class Stream_Source_Functor {
+private:
+    /// operator state & statistics
+    std::vector<reader_t> readers;      // streaming readers of the traces (the ones of the replica, once started)
+    std::vector<wf_tuple_t> heads;      // next packet of each reader of the replica
+    std::vector<bool> pending;          // the reader has a packet in heads
+    int generations;                    // counts the times the input trace is replayed
+    long generated_tuples;              // total number of generated tuples
+    pacer::Source_Pacer pacer;          // stream generation pacing (global rate or trace replay)
+    event_time::Event_Clock clock;      // emission in ingress time or event time
+
+    /// runtime info
+    std::size_t replica_id;
+    metrics::Replica_Stats* stats;      // live counters of the replica
+
+    /// time variables
+    unsigned long current_time;
+
+    /**
+     * @brief Gets the next packet of the replica (the oldest among the heads of its readers).
+     */
+    bool next(wf_tuple_t& pkt) {
+        if (readers.size() == 1) return readers[0].next(pkt);
+        std::size_t first = readers.size();
+        for (std::size_t i = 0; i < readers.size(); i++) {
+            if (pending[i] && (first == readers.size() || heads[i].ts < heads[first].ts)) first = i;
+        }
+        if (first == readers.size()) return false;
+        pkt = heads[first];
+        pending[first] = readers[first].next(heads[first]);
+        return true;
+    }
+
+    /**
+     * @brief Restarts all the readers of the replica from the beginning of their traces.
+     */
+    void rewind() {
+        for (std::size_t i = 0; i < readers.size(); i++) {
+            readers[i].rewind();
+            if (readers.size() > 1) pending[i] = readers[i].next(heads[i]);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _reader streaming reader of the trace (replayed by every replica)
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
+     */
+    Stream_Source_Functor(const reader_t& _reader, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock) :
+            Stream_Source_Functor(std::vector<reader_t>{_reader}, _pacer, _clock) {}
+
+    /**
+     * @brief Constructor.
+     *
+     * @param _readers streaming readers of the traces (shared among the replicas if there is only one)
+     * @param _pacer stream generation pacing
+     * @param _clock emission in ingress time or event time
+     */
+    Stream_Source_Functor(const std::vector<reader_t>& _readers, const pacer::Source_Pacer& _pacer, const event_time::Event_Clock& _clock) :
+            readers(_readers),
+            generations(0),
+            generated_tuples(0),
+            pacer(_pacer),
+            clock(_clock),
+            replica_id(0),
+            stats(nullptr),
+            current_time(app_start_time) {}
+
+    /**
+     * @brief Sends packet tuples in a item-by-item fashion, decoding them from the trace on demand.
+     *
+     * @param shipper Source_Shipper object used for generating input tuples
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(wf::Source_Shipper<packet_t>& shipper, wf::RuntimeContext& rc) {
+        replica_id = rc.getReplicaIndex();
+        stats = metrics::registry.replica("Source", replica_id);
+        placement::placement.bind("Source", replica_id);
+        if (readers.size() > 1) {      // keep the traces of this replica
+            std::vector<reader_t> own;
+            for (std::size_t i = replica_id; i < readers.size(); i += rc.getParallelism()) own.push_back(readers[i]);
+            readers.swap(own);
+            if (readers.empty()) {
+                std::cerr << "[Stream_Source] ERR: replica " << replica_id << " has no input trace." << std::endl;
+            }
+        }
+        heads.resize(readers.size());
+        pending.assign(readers.size(), false);
+        for (std::size_t i = 0; i < readers.size(); i++) {
+            readers[i].open();
+            if (readers.size() > 1) pending[i] = readers[i].next(heads[i]);
+        }
+        generations = 1;
+        long generation_tuples = 0;     // tuples sent in the current generation
+
+        pacer.start();
+        tsc::Stamper stamper;           // batch-level timestamps and latency markers
+        stamper.start();
+        current_time = stamper.time(); // get the current time
+
+        eos::Idle_Flush idle(shipper, clock);     // flush markers while the pacer waits
+
+        /// generation loop
+        while (!readers.empty() && (current_time - app_start_time <= app_run_time) && !Source_Functor::terminate) {
+            wf_tuple_t pkt;
+            if (!next(pkt)) {
+                if (generation_tuples == 0) {       // no TCP packets in the whole trace
+                    std::cerr << "[Stream_Source] ERR: the input trace contains no TCP packets." << std::endl;
+                    break;
+                }
+                /// end of the trace, start a new generation
+                if (Source_Functor::replayed(generations)) break;
+                rewind();
+                pacer.next_generation();
+                clock.next_generation();
+                generations++;
+                generation_tuples = 0;
+                continue;
+            }
+
+            packet_t t(pkt);
+            const uint64_t capture_ts = t.ts;
+            if (const uint64_t now = pacer.pace(capture_ts, idle)) stamper.refresh(now);     // wait for the emission slot of the tuple
+            t.ts = stamper.stamp();
+            if (trace::debug()) {
+                std::cout << "[Source-" << replica_id << "] sent packet " << generated_tuples
+                          << ", " << t.print() << std::endl;
+            }
+            clock.push(shipper, std::move(t), capture_ts);     // send the tuple
+            idle.sent();
+
+            /// update global tuple counter
+            generated_tuples++;
+            stats->tuples_out.add();
+            generation_tuples++;
+
+            current_time = stamper.time(); // get the new current time (read once per batch of tuples)
+        }
+
+        /// EOS is reached here, start source termination
+        eos::send(shipper, clock);      // the operators which hold packets or windows flush them
+        for (auto& r : readers) r.close();
+        stats->exec_time.set(tsc::now() - app_start_time);
+        if (trace::summary()) {
+            std::cout << "[Source-" << replica_id << " started termination..."
+                      << " (generated tuples: " << generated_tuples
+                      << ", generations: " << generations << ")" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stream_Source_Functor() = default;
+};
+
+#endif //HH_STREAM_SOURCE_HPP
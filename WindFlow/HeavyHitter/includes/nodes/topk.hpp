@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    topk.hpp
+ *
+ *  @brief Detector nodes reporting only the K largest flows of each window.
+ *
+ *  Alternative to the HeavyHitterDetector operator, with an output rate bounded by K results per
+ *  window whatever the number of flows above the threshold. Two variants are available:
+ *  - global (TopK_Functor + TopK_Merge_Functor): each replica keeps the K largest window results
+ *    it receives in a bounded heap, and sends them to a single merge replica when the window
+ *    ends, followed by an end-of-window marker; the merge replica emits the K largest flows of
+ *    the window once all the replicas have closed it;
+ *  - per destination (TopK_Dst_Functor): the window results are partitioned on the destination
+ *    address, and each replica emits the K largest flows towards each destination.
+ *
+ *  The windows are identified by the timestamps of their results. Only the results above the
+ *  threshold are considered, and the results of a window received after those of a later
+ *  window (the windows of different flows can fire out of order) are forwarded at once, and
+ *  dropped by the merge if it has already emitted their window. The windows still open at the
+ *  end of the stream are handed to the sink (see eos.hpp): in the global variant those of the
+ *  TopK replicas and of the merge are merged first.
+ */
+
+#pragma once
+#ifndef HH_TOPK_HPP
+#define HH_TOPK_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/eos.hpp"
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+#include "util/stage_trace.hpp"
+#include "util/trace.hpp"
+
+extern long threshold;
+
+namespace topk {
+
+    /**
+     * @class Bounded_Heap
+     * @brief The K largest window results (min-heap on the byte sum).
+     */
+    class Bounded_Heap {
+    private:
+        std::vector<hh_result_t> heap;
+        std::size_t k;
+
+        static bool greater(const hh_result_t& a, const hh_result_t& b) {
+            return a.acc_len > b.acc_len;
+        }
+
+    public:
+        explicit Bounded_Heap(const std::size_t _k = 1) : k(std::max<std::size_t>(_k, 1)) {
+            heap.reserve(k);
+        }
+
+        void add(const hh_result_t& r) {
+            if (heap.size() < k) {
+                heap.push_back(r);
+                std::push_heap(heap.begin(), heap.end(), greater);
+            } else if (r.acc_len > heap.front().acc_len) {
+                std::pop_heap(heap.begin(), heap.end(), greater);
+                heap.back() = r;
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+        }
+
+        /// the results in the heap, from the largest (the heap is emptied)
+        std::vector<hh_result_t> take() {
+            std::sort_heap(heap.begin(), heap.end(), greater);
+            std::vector<hh_result_t> sorted;
+            sorted.swap(heap);
+            heap.reserve(k);
+            return sorted;
+        }
+
+        bool empty() const {
+            return heap.empty();
+        }
+    };
+
+    /// windows by timestamp
+    using windows_t = std::map<uint64_t, Bounded_Heap>;
+    /// adds the open windows of a replica
+    using holder_t = std::function<void(windows_t&)>;
+
+    inline std::mutex holders_mutex;
+    inline std::vector<holder_t> holders;       // replicas of the global variant holding open windows
+
+    /// adds results to a window
+    inline void add(windows_t& windows, const uint64_t ts, const std::vector<hh_result_t>& results, const std::size_t k) {
+        auto& heap = windows.try_emplace(ts, k).first->second;
+        for (const auto& r : results) heap.add(r);
+    }
+
+    /**
+     * @brief Registers a replica of the global variant (called with its first input): at the end of the stream
+     *        the open windows of all the replicas are merged, and their K largest flows handed to the sink.
+     */
+    inline void hold(holder_t holder) {
+        bool first;
+        {
+            std::lock_guard<std::mutex> lock(holders_mutex);
+            first = holders.empty();
+            holders.push_back(std::move(holder));
+        }
+        if (!first) return;
+        eos::at_end([](const eos::emit_t& emit) {
+            std::lock_guard<std::mutex> lock(holders_mutex);
+            windows_t windows;
+            for (const auto& h : holders) h(windows);
+            for (auto& w : windows) {
+                for (const auto& r : w.second.take()) emit(r);
+            }
+            holders.clear();
+        });
+    }
+}
+
+/**
+ * @class TopK_Functor
+ *
+ * @brief Define the logic of the operator selecting the K largest flows of each window in each replica.
+ */
+class TopK_Functor {
+private:
+    std::size_t k;
+    topk::Bounded_Heap heap;    // K largest results of the current window
+    uint64_t window;            // timestamp of the current window
+    bool open;                  // at least a result of the current window has been received
+
+    /// statistics & runtime info
+    long processed_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+    void close(wf::Shipper<hh_partial_t>& shipper) {
+        const auto top = heap.take();
+        for (const auto& r : top) {
+            hh_partial_t p;
+            p.result = r;
+            p.epoch = window;
+            shipper.push(std::move(p));
+        }
+        hh_partial_t marker;        // end of the window for this replica
+        marker.epoch = window;
+        shipper.push(std::move(marker));
+        probe->tuples_out.add(top.size() + 1);
+        probe->record_window(top.size());
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _k flows reported per window
+     */
+    explicit TopK_Functor(const std::size_t _k) :
+            k(_k),
+            heap(_k),
+            window(0),
+            open(false),
+            processed_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Adds a window result to the K largest ones, and sends them when a new window starts.
+     *
+     * @param t input window result
+     * @param shipper Shipper object used to emit the partial top-K
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const hh_result_t& t, wf::Shipper<hh_partial_t>& shipper, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("TopK", replica_id);
+            topk::hold([this](topk::windows_t& windows) {      // the current window is not closed by a later one
+                if (open) topk::add(windows, window, heap.take(), k);
+                open = false;
+            });
+        }
+        metrics::Probe::Scope timed(probe);
+        processed_tuples++;
+        probe->tuples_in.add();
+        stage_trace::stamp(stage_trace::DETECTOR, t.ts);
+
+        const uint64_t ts = rc.getCurrentTimestamp();
+        const bool valid = t.ts && t.acc_len > (uint64_t)threshold;     // empty windows in accumulator are skipped
+        if (open && ts < window) {      // late result, merged in its window downstream (dropped there if the window was emitted)
+            if (!valid) return;
+            hh_partial_t p;
+            p.result = t;
+            p.epoch = ts;
+            shipper.push(std::move(p));
+            probe->tuples_out.add();
+            return;
+        }
+        if (open && ts > window) close(shipper);
+        window = ts;
+        open = true;
+        if (valid) heap.add(t);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~TopK_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[TopK-" << replica_id << "] a total number of " << processed_tuples << " window results have been processed." << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class TopK_Merge_Functor
+ *
+ * @brief Define the logic of the operator merging the partial top-K of the replicas (single replica).
+ */
+class TopK_Merge_Functor {
+private:
+    /// partial top-K of a window
+    struct window_t {
+        topk::Bounded_Heap heap;
+        std::size_t closed = 0;     // replicas that have closed the window
+    };
+
+    std::size_t upstream;                   // replicas sending the partial top-K
+    std::size_t k;
+    std::map<uint64_t, window_t> windows;   // open windows, by timestamp
+    uint64_t emitted_window;                // timestamp of the last window emitted
+    bool emitted;                           // at least a window has been emitted
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long emitted_tuples;
+    long late_results;                      // late results of windows already emitted (dropped)
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _upstream parallelism of the TopK operator
+     * @param _k flows reported per window
+     */
+    TopK_Merge_Functor(const std::size_t _upstream, const std::size_t _k) :
+            upstream(std::max<std::size_t>(_upstream, 1)),
+            k(_k),
+            emitted_window(0),
+            emitted(false),
+            processed_tuples(0),
+            emitted_tuples(0),
+            late_results(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Merges a partial result and emits the top-K of the windows closed by all the replicas.
+     *
+     * A window is also emitted when a later window is closed by all the replicas (some replicas may
+     * receive no results of a window). The late results of a window already emitted are dropped
+     * and counted, so that no window is reported twice.
+     *
+     * @param p partial result or end-of-window marker
+     * @param shipper Shipper object used to emit the results
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const hh_partial_t& p, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("TopKMerge", replica_id);
+            topk::hold([this](topk::windows_t& open) {       // the windows not closed by all the replicas
+                for (auto& w : windows) {
+                    const auto top = w.second.heap.take();
+                    topk::add(open, w.first, top, k);
+                }
+                windows.clear();
+            });
+        }
+        metrics::Probe::Scope timed(probe);
+        processed_tuples++;
+        probe->tuples_in.add();
+
+        if (emitted && p.epoch <= emitted_window) {     // late result of a window already emitted
+            late_results++;
+            return;
+        }
+        auto it = windows.find(p.epoch);
+        if (it == windows.end()) {
+            it = windows.emplace(p.epoch, window_t{topk::Bounded_Heap(k)}).first;
+        }
+        if (p.result.ts) {
+            it->second.heap.add(p.result);
+            return;
+        }
+        if (++it->second.closed < upstream) return;
+
+        /// the window and the previous ones are complete
+        const auto end = std::next(it);
+        for (auto w = windows.begin(); w != end; w++) {
+            for (auto& r : w->second.heap.take()) {
+                shipper.push(std::move(r));
+                emitted_tuples++;
+                probe->tuples_out.add();
+            }
+        }
+        emitted_window = it->first;
+        emitted = true;
+        windows.erase(windows.begin(), end);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~TopK_Merge_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[TopKMerge-" << replica_id << "] a total number of " << emitted_tuples << " top-K results have been emitted, "
+                          << late_results << " late results of emitted windows dropped." << std::endl;
+            }
+        }
+    }
+};
+
+/**
+ * @class TopK_Dst_Functor
+ *
+ * @brief Define the logic of the operator selecting the K largest flows towards each destination (partitioned on the destination).
+ */
+class TopK_Dst_Functor {
+private:
+    std::size_t k;
+    arena::unordered_map<uint32_t, topk::Bounded_Heap> heaps;   // K largest results of the current window, per destination
+    uint64_t window;            // timestamp of the current window
+    bool open;
+
+    /// statistics & runtime info
+    long processed_tuples;
+    long emitted_tuples;
+    std::size_t replica_id;
+    bool op_running;
+    metrics::Probe probe;               // counters and sampled timing of the replica
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _k flows reported per window and destination
+     */
+    explicit TopK_Dst_Functor(const std::size_t _k) :
+            k(_k),
+            window(0),
+            open(false),
+            processed_tuples(0),
+            emitted_tuples(0),
+            replica_id(0),
+            op_running(true) {}
+
+    /**
+     * @brief Adds a window result to the K largest ones of its destination, and emits them when a new window starts.
+     *
+     * @param t input window result
+     * @param shipper Shipper object used to emit the results
+     * @param rc RuntimeContext providing information on parallelism degree and replica id
+     */
+    void operator()(const hh_result_t& t, wf::Shipper<hh_result_t>& shipper, wf::RuntimeContext& rc) {
+        if (processed_tuples == 0) {
+            replica_id = rc.getReplicaIndex();
+            probe.attach("TopK", replica_id);
+            eos::at_end([this](const eos::emit_t& emit) {      // the current window is not closed by a later one
+                for (auto& h : heaps) {
+                    for (const auto& r : h.second.take()) {
+                        emit(r);
+                        emitted_tuples++;
+                    }
+                }
+                heaps.clear();
+            });
+        }
+        metrics::Probe::Scope timed(probe);
+        processed_tuples++;
+        probe->tuples_in.add();
+        stage_trace::stamp(stage_trace::DETECTOR, t.ts);
+
+        const uint64_t ts = rc.getCurrentTimestamp();
+        const bool valid = t.ts && t.acc_len > (uint64_t)threshold;     // empty windows in accumulator are skipped
+        if (open && ts < window) {      // late result
+            if (valid) {
+                shipper.push(t);
+                emitted_tuples++;
+                probe->tuples_out.add();
+            }
+            return;
+        }
+        if (open && ts > window) {
+            probe->state_bytes.set(memory::bytes_of_map(heaps) + heaps.size() * k * sizeof(hh_result_t));
+            for (auto& h : heaps) {
+                for (auto& r : h.second.take()) {
+                    shipper.push(std::move(r));
+                    emitted_tuples++;
+                    probe->tuples_out.add();
+                }
+            }
+            heaps.clear();
+        }
+        window = ts;
+        open = true;
+        if (!valid) return;
+        auto it = heaps.find(t.ip_dst);
+        if (it == heaps.end()) it = heaps.emplace(t.ip_dst, topk::Bounded_Heap(k)).first;
+        it->second.add(t);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~TopK_Dst_Functor() {
+        if (op_running && processed_tuples > 0) {
+            op_running = false;
+            if (trace::summary()) {
+                std::cout << "[TopK-" << replica_id << "] a total number of " << processed_tuples << " window results have been processed, "
+                          << emitted_tuples << " top-K results emitted." << std::endl;
+            }
+        }
+    }
+};
+
+#endif //HH_TOPK_HPP
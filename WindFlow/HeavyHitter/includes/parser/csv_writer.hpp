@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    csv_writer.hpp
+ *
+ *  @brief Streaming writer exporting packet tuples as csv text.
+ *
+ *  Two formats are supported. In the standard format the IPv4 addresses are kept in their binary
+ *  representation (printed as unsigned integers), while in the human-readable format they are
+ *  converted to text form. In both cases the fields are:
+ *
+ *      ts, ip_src, ip_dst, protocol, pkt_len, ip_len, ip_hdrlen, ip_datalen, tcp_hdrlen, tcp_datalen, port_src, port_dst, seq, ack, win, syn
+ *       0    1       2        3         4       5        6          7            8           9           10        11     12   13   14   15
+ *
+ *  The standard format is the one read by the Flink, Storm and Spark variants of the application.
+ */
+
+#pragma once
+#ifndef HH_CSV_WRITER_HPP
+#define HH_CSV_WRITER_HPP
+
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <arpa/inet.h>
+#include "tuples/wf_tuple.hpp"
+
+/**
+ * @class Csv_Writer
+ *
+ * @brief Class writing packet tuples to a csv file, one line per packet, without buffering the whole content in memory.
+ */
+class Csv_Writer {
+private:
+    std::ofstream csv;
+    bool readable;          // convert the addresses to text form
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _csv_file path of the csv file to create
+     * @param _readable true to generate the human-readable format
+     */
+    Csv_Writer(const std::string& _csv_file, const bool _readable) : csv(_csv_file), readable(_readable) {
+        if (!csv.is_open())
+            throw std::invalid_argument("[Csv_Writer] ERR: cannot create " + _csv_file);
+    }
+
+    /**
+     * @brief Appends a packet tuple to the csv file.
+     *
+     * @param t packet tuple
+     */
+    void write(const wf_tuple_t& t) {
+        /// timestamp (microseconds)
+        csv << t.ts << ",";
+
+        /// source and destination (IP addresses)
+        if (readable) {
+            char ipsrc_buf[16], ipdst_buf[16];
+            inet_ntop(AF_INET, reinterpret_cast<const void*>(&t.ip_src), ipsrc_buf, sizeof(ipsrc_buf));  // convert IPv4 address from binary to text form
+            inet_ntop(AF_INET, reinterpret_cast<const void*>(&t.ip_dst), ipdst_buf, sizeof(ipdst_buf));
+            csv << ipsrc_buf << "," << ipdst_buf << ",";
+        } else {
+            csv << t.ip_src << "," << t.ip_dst << ",";      // keep IPv4 address in binary format
+        }
+
+        /// transport layer protocol
+        csv << (unsigned)t.protocol << ",";
+
+        /// entire packet length
+        csv << ntohs(t.ip_len) + 18 << ",";      // 14 bytes MAC header (6 src + 6 dst + 2 ethertype) + 4 bytes CRC checksum
+
+        /// IP length (total, header, payload)
+        csv << ntohs(t.ip_len) << ",";           // convert from network byte order to host byte order (short, 2 bytes)
+        csv << t.ip_hdrlen << ",";
+        csv << ntohs(t.ip_len) - t.ip_hdrlen << ",";
+
+        /// TCP length (header, payload)
+        csv << t.tcp_hdrlen << ",";
+        csv << ntohs(t.ip_len) - t.ip_hdrlen - t.tcp_hdrlen << ",";
+        csv << ntohs(t.port_src) << ",";
+        csv << ntohs(t.port_dst) << ",";
+        csv << ntohl(t.seq) << ",";         // convert from network byte order to host byte order (long, 4 bytes)
+        csv << ntohl(t.ack) << ",";
+        csv << t.win << ",";
+        csv << t.syn;
+
+        csv << '\n';
+    }
+
+    /**
+     * @brief Flushes and closes the csv file.
+     */
+    void close() {
+        if (csv.is_open()) csv.close();
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Csv_Writer() {
+        close();
+    }
+};
+
+#endif //HH_CSV_WRITER_HPP
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    header_parser.hpp
+ *
+ *  @brief Helper functions extracting the relevant header fields from a raw ethernet frame (IPv4 or IPv6, untagged or vlan tagged).
+ *
+ *  The same decoding logic is shared by the pcap dump file parser and by the live capture source,
+ *  which parses the headers straight out of the receive ring without copying the frame.
+ */
+
+#pragma once
+#ifndef HH_HEADER_PARSER_HPP
+#define HH_HEADER_PARSER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <arpa/inet.h>
+#include <net/ethernet.h>
+#include <netinet/ip.h>
+#include <netinet/tcp.h>
+#include "tuples/wf_tuple.hpp"
+
+namespace header_parser {
+
+    /// stacked vlan tags accepted in front of the IP header (802.1Q, or 802.1ad QinQ)
+    constexpr int MAX_VLAN_TAGS = 2;
+    constexpr uint32_t VLAN_TAG_LEN = 4;
+    constexpr uint16_t ETHERTYPE_QINQ = 0x88a8;
+
+    /// IPv6 extension headers walked before the transport header
+    constexpr int MAX_IPV6_EXT_HDRS = 8;
+    constexpr uint32_t IPV6_HDR_LEN = 40;
+
+    /**
+     * @brief Decodes the TCP header found at offset off of the frame.
+     */
+    inline bool parse_tcp(const u_char* p_data, const uint32_t caplen, const uint32_t off, wf_tuple_t& t) {
+        if (caplen < off + sizeof(struct tcphdr)) return false;
+        const struct tcphdr *tcp_hdr = reinterpret_cast<const struct tcphdr *>(p_data + off);
+        t.protocol = IPPROTO_TCP;
+        t.port_src = tcp_hdr->th_sport;     // network representation
+        t.port_dst = tcp_hdr->th_dport;     // network representation
+        t.tcp_hdrlen = tcp_hdr->doff * 4;   // length in bytes of TCP header (DataOffset field specifies the size of the TCP header in 32-bit words)
+        t.seq = tcp_hdr->seq;               // sequence number of the first data byte (network representation)
+        t.ack = ((tcp_hdr->ack) ? tcp_hdr->ack_seq : 0);  // acknowledgment number (first sequence number that the sender of the ACK is expecting, if ACK=1) (network representation)
+        t.win = tcp_hdr->window;            // size of the receive window in bytes
+        t.syn = tcp_hdr->syn;               // SYN flag (if set to 1 it identifies a newly opened TCP connection)
+        return true;
+    }
+
+    /**
+     * @brief Decodes the IPv4 header found at offset off of the frame, and the TCP header behind it.
+     */
+    inline bool parse_ipv4(const u_char* p_data, const uint32_t caplen, const uint32_t off, wf_tuple_t& t) {
+        if (caplen < off + sizeof(struct ip)) return false;
+        const struct ip *ip_hdr = reinterpret_cast<const struct ip *>(p_data + off);
+        if (ip_hdr->ip_v != 4 || ip_hdr->ip_p != IPPROTO_TCP) return false;     // select TCP packets only
+        t.ip_version = 4;
+        t.ip_src = ip_hdr->ip_src.s_addr;   // IP src (keep binary format, print fun will convert address to text form)
+        t.ip_dst = ip_hdr->ip_dst.s_addr;   // IP dst (keep binary format, print fun will convert address to text form)
+        t.ip_len = ip_hdr->ip_len;          // IP packet length in bytes, including header and data (network representation)
+        t.ip_hdrlen = ip_hdr->ip_hl * 4;    // IP header length in bytes (HdrLen field specifies the size of the IP header in 32-bit words)
+        return parse_tcp(p_data, caplen, off + t.ip_hdrlen, t);
+    }
+
+    /**
+     * @brief Decodes the IPv6 header found at offset off of the frame, walks its extension headers and
+     *        decodes the TCP header behind them.
+     *
+     * Only the first fragment of a fragmented packet carries the TCP header, the other ones are skipped.
+     * The hash of the two addresses is stored in the 32-bit fields and their full form is registered
+     * (see ip6::hash), the ip_len field is set to the length of the whole packet (fixed header included)
+     * as for IPv4. No IPv6 packet is decoded if ip6::accepted is reset.
+     */
+    inline bool parse_ipv6(const u_char* p_data, const uint32_t caplen, const uint32_t off, wf_tuple_t& t) {
+        if (caplen < off + IPV6_HDR_LEN) return false;
+        const u_char* h = p_data + off;
+        if ((h[0] >> 4) != 6 || !ip6::accepted) return false;
+        uint16_t payload_len;
+        std::memcpy(&payload_len, h + 4, sizeof(payload_len));
+        uint8_t next = h[6];
+        uint32_t len = IPV6_HDR_LEN;
+        for (int i = 0; i < MAX_IPV6_EXT_HDRS && next != IPPROTO_TCP; i++) {
+            if (caplen < off + len + 8) return false;
+            const u_char* ext = p_data + off + len;
+            switch (next) {
+                case IPPROTO_HOPOPTS:
+                case IPPROTO_ROUTING:
+                case IPPROTO_DSTOPTS:
+                    len += (ext[1] + 1) * 8;
+                    break;
+                case IPPROTO_FRAGMENT:
+                    if (((ext[2] << 8 | ext[3]) & 0xfff8) != 0) return false;   // not the first fragment
+                    len += 8;
+                    break;
+                case IPPROTO_AH:
+                    len += (ext[1] + 2) * 4;
+                    break;
+                default:
+                    return false;       // not a TCP packet
+            }
+            next = ext[0];
+        }
+        if (next != IPPROTO_TCP) return false;
+        t.ip_version = 6;
+        const uint64_t pair = ip6::hash(h + 8, h + 24);
+        t.ip_src = static_cast<uint32_t>(pair >> 32);
+        t.ip_dst = static_cast<uint32_t>(pair);
+        ip6::remember(pair, h + 8, h + 24);
+        t.ip_len = htons(ntohs(payload_len) + IPV6_HDR_LEN);
+        t.ip_hdrlen = len;
+        return parse_tcp(p_data, caplen, off + len, t);
+    }
+
+    /**
+     * @brief Decodes the ethernet, IP and TCP headers of a frame and fills the corresponding tuple fields.
+     *
+     * Up to MAX_VLAN_TAGS stacked 802.1Q/802.1ad tags are skipped, then the frame is dispatched on its
+     * EtherType to the IPv4 or IPv6 decoder.
+     * The timestamp field of the tuple is not touched, it is up to the caller to set it.
+     *
+     * @param p_data pointer to the first byte of the ethernet frame
+     * @param caplen number of captured bytes available from p_data
+     * @param t wf tuple to fill with the content of the packet
+     * @return true if the frame carries a (complete) TCP header over IPv4 or IPv6, false otherwise
+     */
+    inline bool parse(const u_char* p_data, const uint32_t caplen, wf_tuple_t& t) {
+        if (p_data == nullptr || caplen < sizeof(struct ether_header)) return false;
+
+        /// access ethernet header and skip the vlan tags (the EtherType of each tag follows its TCI)
+        uint16_t ether_type = reinterpret_cast<const struct ether_header *>(p_data)->ether_type;
+        uint32_t l2_len = sizeof(struct ether_header);
+        for (int i = 0; i < MAX_VLAN_TAGS && (ether_type == htons(ETHERTYPE_VLAN) || ether_type == htons(ETHERTYPE_QINQ)); i++) {
+            if (caplen < l2_len + VLAN_TAG_LEN) return false;
+            std::memcpy(&ether_type, p_data + l2_len + 2, sizeof(ether_type));
+            l2_len += VLAN_TAG_LEN;
+        }
+
+        switch (ntohs(ether_type)) {
+            case ETHERTYPE_IP:
+                return parse_ipv4(p_data, caplen, l2_len, t);
+            case ETHERTYPE_IPV6:
+                return parse_ipv6(p_data, caplen, l2_len, t);
+            default:
+                return false;
+        }
+    }
+}
+
+#endif //HH_HEADER_PARSER_HPP
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    parallel_loader.hpp
+ *
+ *  @brief Loader decoding a pcap dump file on a pool of threads.
+ *
+ *  The record headers of the memory mapped file are walked once to split it in ranges of about the
+ *  same size, and to count the records of each range. The threads take the ranges in turn and decode
+ *  each one into a buffer they allocate and fill themselves, keeping only the TCP packets, so that no
+ *  memory is initialized or touched by a single thread ahead of the decoding. The buffers are then
+ *  appended to the dataset in the order of the file, each one released once copied.
+ */
+
+#pragma once
+#ifndef HH_PARALLEL_LOADER_HPP
+#define HH_PARALLEL_LOADER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "parser/pcap_mmap_reader.hpp"
+
+namespace loader {
+
+    /// ranges decoded by each thread on average (the later ranges balance the faster threads)
+    constexpr std::size_t CHUNKS_PER_THREAD = 8;
+
+    /**
+     * @brief Gets the number of loader threads (0 is one per online core).
+     */
+    inline std::size_t threads_of(const std::size_t threads) {
+        return (threads > 0) ? threads : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief Decodes the TCP packets of a pcap dump file on a pool of threads and appends the kept ones to a dataset, in the order of the file.
+     *
+     * @param file pcap dump file of ethernet frames
+     * @param threads loader threads (the calling one included)
+     * @param dataset packets, extended with the ones of the file
+     * @param keep predicate selecting the packets to append (called concurrently)
+     * @return false if the file is not a classic pcap dump of ethernet frames (it has to be decoded by libpcap)
+     */
+    template<typename keep_t>
+    bool append_pcap(const std::string& file, const std::size_t threads, packets_t& dataset, keep_t&& keep) {
+        Pcap_Mmap_Reader reader(file, 0);
+        try {
+            reader.open();
+        } catch (const std::invalid_argument&) {
+            return false;
+        }
+        const std::vector<Pcap_Mmap_Reader::chunk_t> chunks = reader.split(threads * CHUNKS_PER_THREAD);
+        std::vector<packets_t> decoded(chunks.size());             // kept packets of each range (allocated by the thread decoding it)
+        std::atomic<std::size_t> next{0};
+        auto work = [&]() {
+            for (std::size_t i = next++; i < chunks.size(); i = next++) {
+                packets_t& out = decoded[i];
+                out.reserve(chunks[i].records);
+                reader.parse_range(chunks[i], [&](const wf_tuple_t& t) {
+                    const packet_t p(t);
+                    if (keep(p)) out.push_back(p);
+                });
+            }
+        };
+        std::vector<std::thread> pool;
+        for (std::size_t t = 1; t < std::min(threads, chunks.size()); t++) pool.emplace_back(work);
+        work();
+        for (auto& t : pool) t.join();
+
+        std::size_t total = dataset.size();
+        for (const auto& d : decoded) total += d.size();
+        dataset.reserve(total);
+        for (auto& d : decoded) {
+            dataset.insert(dataset.end(), d.begin(), d.end());
+            packets_t().swap(d);
+        }
+        return true;
+    }
+}
+
+#endif //HH_PARALLEL_LOADER_HPP
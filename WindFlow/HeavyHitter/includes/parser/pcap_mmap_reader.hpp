@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    pcap_mmap_reader.hpp
+ *
+ *  @brief Streaming reader for pcap dump files of arbitrary size.
+ *
+ *  The dump file is memory mapped and its records are decoded lazily, one at a time, by the
+ *  source replica that owns the reader. Only a bounded window of the file is kept resident:
+ *  the pages ahead of the read cursor are prefetched with MADV_WILLNEED, while the pages left
+ *  behind are released with MADV_DONTNEED, so that the memory footprint does not depend on the
+ *  size of the trace.
+ */
+
+#pragma once
+#ifndef HH_PCAP_MMAP_READER_HPP
+#define HH_PCAP_MMAP_READER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "tuples/wf_tuple.hpp"
+#include "parser/header_parser.hpp"
+
+/**
+ * @class Pcap_Mmap_Reader
+ *
+ * @brief Class decoding the TCP packets of a memory mapped pcap dump file through a bounded prefetch window.
+ *
+ * A reader object can be freely copied before open() is called: the mapping is created by the
+ * replica which is going to consume the records, so that each replica has its own read cursor.
+ */
+class Pcap_Mmap_Reader {
+private:
+    /// pcap file format (see the libpcap savefile specification)
+    static constexpr uint32_t MAGIC_USEC = 0xa1b2c3d4;
+    static constexpr uint32_t MAGIC_NSEC = 0xa1b23c4d;
+    static constexpr std::size_t FILE_HDR_LEN = 24;
+    static constexpr std::size_t REC_HDR_LEN = 16;
+    static constexpr uint32_t LINKTYPE_ETHERNET = 1;
+
+    /// configuration
+    std::string pcap_file;          // path of the pcap dump file
+    std::size_t window;             // size in bytes of the resident window ahead of the read cursor
+
+    /// mapping and cursor
+    const u_char* base;             // first byte of the mapping
+    std::size_t size;               // size in bytes of the file
+    std::size_t cursor;             // offset of the next record header
+    std::size_t prefetched;         // offset up to which the file has been prefetched
+    std::size_t released;           // offset up to which the file has been released
+    std::size_t page;               // system page size
+    bool swapped;                   // file written with the opposite byte order
+    bool nsec;                      // timestamps with nanosecond resolution
+
+    uint32_t read32(const u_char* p) const {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return (swapped) ? __builtin_bswap32(v) : v;
+    }
+
+    /**
+     * @brief Slides the resident window forward once the cursor gets close to its end.
+     */
+    void advance_window() {
+        if (cursor + window / 2 < prefetched) return;
+
+        /// release the pages already consumed (whole pages strictly behind the cursor)
+        std::size_t behind = (cursor / page) * page;
+        if (behind > released) {
+            madvise(const_cast<u_char*>(base) + released, behind - released, MADV_DONTNEED);
+            released = behind;
+        }
+
+        /// prefetch the next window of the file
+        std::size_t from = (cursor / page) * page;
+        std::size_t len = std::min(window, size - from);
+        if (len > 0) madvise(const_cast<u_char*>(base) + from, len, MADV_WILLNEED);
+        prefetched = from + len;
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param _pcap_file path of the pcap dump file
+     * @param _window size in bytes of the prefetch window
+     */
+    Pcap_Mmap_Reader(const std::string& _pcap_file, const std::size_t _window) :
+            pcap_file(_pcap_file),
+            window(_window),
+            base(nullptr),
+            size(0),
+            cursor(0),
+            prefetched(0),
+            released(0),
+            page(4096),
+            swapped(false),
+            nsec(false) {}
+
+    /**
+     * @brief Copy constructor (the copy is not mapped, it has to be opened on its own).
+     */
+    Pcap_Mmap_Reader(const Pcap_Mmap_Reader& other) :
+            Pcap_Mmap_Reader(other.pcap_file, other.window) {}
+
+    Pcap_Mmap_Reader& operator=(const Pcap_Mmap_Reader&) = delete;
+
+    /**
+     * @brief Maps the pcap dump file and validates its global header.
+     */
+    void open() {
+        int fd = ::open(pcap_file.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::invalid_argument("[Pcap_Mmap_Reader] ERR: cannot open " + pcap_file);
+        struct stat st{};
+        if (fstat(fd, &st) < 0 || static_cast<std::size_t>(st.st_size) < FILE_HDR_LEN) {
+            ::close(fd);
+            throw std::invalid_argument("[Pcap_Mmap_Reader] ERR: " + pcap_file + " is not a pcap dump file");
+        }
+        size = st.st_size;
+        void* m = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (m == MAP_FAILED)
+            throw std::runtime_error("[Pcap_Mmap_Reader] ERR: mmap of " + pcap_file + " failed");
+        base = static_cast<const u_char*>(m);
+        madvise(m, size, MADV_SEQUENTIAL);
+        page = sysconf(_SC_PAGESIZE);
+
+        /// global header: magic number identifies byte order and timestamp resolution
+        uint32_t magic;
+        std::memcpy(&magic, base, sizeof(magic));
+        if (magic == MAGIC_USEC || magic == MAGIC_NSEC) {
+            swapped = false;
+        } else if (__builtin_bswap32(magic) == MAGIC_USEC || __builtin_bswap32(magic) == MAGIC_NSEC) {
+            swapped = true;
+            magic = __builtin_bswap32(magic);
+        } else {
+            close();
+            throw std::invalid_argument("[Pcap_Mmap_Reader] ERR: " + pcap_file + " has an unknown pcap magic number");
+        }
+        nsec = (magic == MAGIC_NSEC);
+        if ((read32(base + 20) & 0xffff) != LINKTYPE_ETHERNET) {
+            close();
+            throw std::invalid_argument("[Pcap_Mmap_Reader] ERR: " + pcap_file + " does not contain ethernet frames");
+        }
+        rewind();
+    }
+
+    /**
+     * @brief Moves the read cursor back to the first record of the file.
+     */
+    void rewind() {
+        cursor = FILE_HDR_LEN;
+        prefetched = 0;
+        released = 0;
+        advance_window();
+    }
+
+    /**
+     * @brief Decodes the next TCP packet of the file.
+     *
+     * Records which do not carry a TCP packet are skipped.
+     *
+     * @param t wf tuple filled with the content of the packet (timestamp in microseconds)
+     * @return false when the end of the file is reached, true otherwise
+     */
+    bool next(wf_tuple_t& t) {
+        while (cursor + REC_HDR_LEN <= size) {
+            const u_char* rec = base + cursor;
+            const uint32_t ts_sec = read32(rec);
+            const uint32_t ts_frac = read32(rec + 4);
+            const uint32_t caplen = read32(rec + 8);
+            const u_char* data = rec + REC_HDR_LEN;
+            if (cursor + REC_HDR_LEN + caplen > size) break;     // truncated record at the end of the file
+
+            cursor += REC_HDR_LEN + caplen;
+            __builtin_prefetch(base + cursor);     // next record header
+            advance_window();
+
+            if (header_parser::parse(data, caplen, t)) {
+                t.ts = ts_sec * (uint64_t)1000000 + ((nsec) ? ts_frac / 1000 : ts_frac);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Decodes a batch of up to BATCH records of the file and appends their TCP packets to a dataset.
+     *
+     * The record headers of the batch are walked first, prefetching the frame headers they point to,
+     * so that the frames are already in cache when they are decoded.
+     *
+     * @param dataset vector extended with the tuples of the TCP packets of the batch (timestamps in microseconds)
+     * @return number of records consumed, 0 when the end of the file is reached
+     */
+    template<std::size_t BATCH = 32>
+    std::size_t next_batch(std::vector<wf_tuple_t>& dataset) {
+        const u_char* data[BATCH];
+        uint32_t caplen[BATCH];
+        uint64_t ts[BATCH];
+        std::size_t n = 0;
+        while (n < BATCH && cursor + REC_HDR_LEN <= size) {
+            const u_char* rec = base + cursor;
+            caplen[n] = read32(rec + 8);
+            if (cursor + REC_HDR_LEN + caplen[n] > size) break;     // truncated record at the end of the file
+            const uint32_t ts_frac = read32(rec + 4);
+            ts[n] = read32(rec) * (uint64_t)1000000 + ((nsec) ? ts_frac / 1000 : ts_frac);
+            data[n] = rec + REC_HDR_LEN;
+            __builtin_prefetch(data[n]);
+            __builtin_prefetch(data[n] + 64);      // IPv6 and tagged frames spill over the first line
+            cursor += REC_HDR_LEN + caplen[n];
+            n++;
+        }
+        advance_window();
+
+        for (std::size_t i = 0; i < n; i++) {
+            wf_tuple_t t;
+            if (header_parser::parse(data[i], caplen[i], t)) {
+                t.ts = ts[i];
+                dataset.push_back(t);
+            }
+        }
+        return n;
+    }
+
+    /// contiguous range of records of the file
+    struct chunk_t {
+        std::size_t begin, end;     // offsets of the first record header and past the last record of the range
+        std::size_t records;        // records in the range
+    };
+
+    /**
+     * @brief Walks the record headers of the mapped file once and splits its records in ranges of about the same size.
+     *
+     * @param chunks number of ranges
+     * @return ranges, in the order of the file (a truncated record at the end of the file is left out)
+     */
+    std::vector<chunk_t> split(const std::size_t chunks) const {
+        std::vector<chunk_t> ranges;
+        const std::size_t target = std::max<std::size_t>((size - FILE_HDR_LEN) / std::max<std::size_t>(chunks, 1), 1);
+        chunk_t c{FILE_HDR_LEN, FILE_HDR_LEN, 0};
+        std::size_t off = FILE_HDR_LEN;
+        while (off + REC_HDR_LEN <= size) {
+            const std::size_t caplen = read32(base + off + 8);
+            if (off + REC_HDR_LEN + caplen > size) break;
+            off += REC_HDR_LEN + caplen;
+            c.records++;
+            if (off - c.begin >= target) {
+                c.end = off;
+                ranges.push_back(c);
+                c = chunk_t{off, off, 0};
+            }
+        }
+        if (c.records > 0) {
+            c.end = off;
+            ranges.push_back(c);
+        }
+        return ranges;
+    }
+
+    /**
+     * @brief Decodes the records of a range of the mapped file, in the order of the file.
+     *
+     * The read cursor is not used, so different ranges can be decoded concurrently.
+     *
+     * @param c range of records (see split)
+     * @param emit called on the tuple of each TCP packet of the range (timestamp in microseconds)
+     */
+    template<typename emit_t>
+    void parse_range(const chunk_t& c, emit_t&& emit) const {
+        const std::size_t from = (c.begin / page) * page;
+        madvise(const_cast<u_char*>(base) + from, c.end - from, MADV_WILLNEED);
+        for (std::size_t off = c.begin; off < c.end;) {
+            const u_char* rec = base + off;
+            const uint32_t caplen = read32(rec + 8);
+            off += REC_HDR_LEN + caplen;
+            __builtin_prefetch(base + off);     // next record header
+            wf_tuple_t t;
+            if (header_parser::parse(rec + REC_HDR_LEN, caplen, t)) {
+                const uint32_t ts_frac = read32(rec + 4);
+                t.ts = read32(rec) * (uint64_t)1000000 + ((nsec) ? ts_frac / 1000 : ts_frac);
+                emit(t);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the size of the mapped file.
+     *
+     * @return size in bytes
+     */
+    std::size_t get_size() const {
+        return size;
+    }
+
+    /**
+     * @brief Unmaps the file.
+     */
+    void close() {
+        if (base != nullptr) {
+            munmap(const_cast<u_char*>(base), size);
+            base = nullptr;
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Pcap_Mmap_Reader() {
+        close();
+    }
+};
+
+#endif //HH_PCAP_MMAP_READER_HPP
@@ -41,10 +41,10 @@
 #include <fstream>
 #include <optional>
 #include <string>
-#include <tuple>
 #include <vector>
 #include <stdexcept>
 #include <ctime>
+#include <cstdlib>
 #include <pcap.h>
 #include <arpa/inet.h>
 #include <net/ethernet.h>
@@ -53,18 +53,11 @@
 #include <netinet/tcp.h>
 #include <netinet/udp.h>
 #include "tuples/wf_tuple.hpp"
-
-/**
- * @brief Tokenize the content of a single packet from the csv file.
- * 
- * FieldFormat (where seq, ack, win are valid for TCP packets only) and corresponding access positions:
- * 
- *      ts, ip_src, ip_dst, ip_hdrlen, ip_len, protocol, port_src, port_dst, hdrlen, length, seq, ack, win
- *       0     1      2         3         4       5        6         7         8       9     10   11   12
- * 
- */
-typedef std::tuple<uint64_t, uint32_t, uint32_t, uint16_t, uint16_t, uint8_t, 
-                    uint16_t, uint16_t, uint16_t, uint16_t, uint32_t, uint32_t, uint16_t> tokenized_packet;
+#include "parser/header_parser.hpp"
+#include "parser/pcap_mmap_reader.hpp"
+#include "parser/csv_writer.hpp"
+#include "parser/trace_file.hpp"
+#include "util/trace.hpp"
 
 /**
  * @class PcapTransformer
@@ -80,28 +73,21 @@ private:
      * @class PcapParser 
      * 
      * @brief Sub-class to parse the initial pcap file.
+     *
+     * Classic pcap dump files of ethernet frames are memory mapped and decoded in batches (see
+     * Pcap_Mmap_Reader::next_batch), any other format readable by libpcap (e.g. pcapng) goes
+     * through the pcap_loop callback.
      */
     class PcapParser {
     private:
-        /// 802.1Q header structure.
-        struct vlan_ethhdr {
-            u_char h_dest[ETHER_ADDR_LEN];
-            u_char h_source[ETHER_ADDR_LEN];
-            u_int16_t h_vlan_proto;
-            u_int16_t h_vlan_TCI;
-            u_int16_t h_vlan_encapsulated_proto;
-        };
-
         //----------------------- variables ------------------------------------//
 
-        /// pcap handle
-        pcap_t* pcap_handle;
-
-        /// stringstream to store the pcap file relevant content
-        std::stringstream pcap_ss;
+        /// bulk load window of the memory mapped file
+        static constexpr std::size_t BULK_WINDOW = 256UL << 20;
 
-        /// stringstream to store the pcap file relevant content in a human readable format
-        std::stringstream pcap_ss_read;
+        /// pcap dump file and its handle
+        std::string pcap_file;
+        pcap_t* pcap_handle;
 
         /// tuple dataset to store the pcap file relevant content
         std::vector<wf_tuple_t> pcap_dataset;
@@ -132,126 +118,12 @@ private:
             /// here we have a valid packet to process
             t.ts = p_hdr->ts.tv_sec * (uint64_t)1000000 + p_hdr->ts.tv_usec;   // ts in microseconds (epoch time)
 
-            /// access ethernet header
-            const struct ether_header *e_hdr = reinterpret_cast<const struct ether_header *>(p_data);
-            if (e_hdr == nullptr) throw std::invalid_argument("[PcapParser] ERR: failed access to ethernet header while parsing packet.");
-
-            /// check presence of vlan header
-            const struct vlan_ethhdr *vlan_hdr = nullptr;
-            if (e_hdr->ether_type == htons(ETHERTYPE_VLAN))
-                vlan_hdr = reinterpret_cast<const struct vlan_ethhdr *>(p_data);
-
-            /// access IP header
-            const struct ip *ip_hdr = (vlan_hdr) ?
-                                    reinterpret_cast<const struct ip *>(vlan_hdr + 1) :
-                                    reinterpret_cast<const struct ip *> (e_hdr + 1);
-            if (ip_hdr == nullptr) throw std::invalid_argument("[PcapParser] ERR: failed access to IP header while parsing packet.");
-            t.ip_src = reinterpret_cast<uint32_t>(ip_hdr->ip_src.s_addr);      // IP src (keep binary format, print fun will convert address to text form)
-            t.ip_dst = reinterpret_cast<uint32_t>(ip_hdr->ip_dst.s_addr);      // IP dst (keep binary format, print fun will convert address to text form)
-            t.ip_len = reinterpret_cast<uint16_t>(ip_hdr->ip_len);             // IP packet length in bytes, including header and data (network representation)
-            t.ip_hdrlen = ip_hdr->ip_hl * 4;    // IP header length in bytes (HdrLen field specifies the size of the IP header in 32-bit words), assume no options
-
-            /// access transport layer header
-            const struct tcphdr *tcp_hdr = reinterpret_cast<const struct tcphdr *>(reinterpret_cast<const char *>(ip_hdr) + (ip_hdr->ip_hl * 4));
-
             /// select TCP packets only
-            if (ip_hdr->ip_p == IPPROTO_TCP) {
-                t.protocol = IPPROTO_TCP;
-                if (tcp_hdr != nullptr) {
-                    t.port_src = tcp_hdr->th_sport;   // network representation
-                    t.port_dst = tcp_hdr->th_dport;   // network representation
-                    t.tcp_hdrlen = tcp_hdr->doff *
-                                   4; // length in bytes of TCP header (DataOffset field specifies the size of the TCP header in 32-bit words)
-                    t.seq = tcp_hdr->seq;             // sequence number of the first data byte (network representation)
-                    t.ack = ((tcp_hdr->ack) ? tcp_hdr->ack_seq
-                                            : 0);  // acknowledgment number (first sequence number that the sender of the ACK is expecting, if ACK=1) (network representation)
-                    t.win = tcp_hdr->window;          // size of the receive window in bytes
-                    t.syn = tcp_hdr->syn;          // SYN flag (if set to 1 it identifies a newly opened TCP connection)
-                }
-
+            if (header_parser::parse(p_data, p_hdr->caplen, t)) {
                 pcap_dataset.push_back(t);
-                pushString(t);
-                pushReadableString(t);
             }
         }
 
-        /**
-         * @brief Define the format of the tuple fields for generating the standard csv file.
-         *
-         * @param t packet tuple to add in the csv standard file
-         */
-        void pushString(const wf_tuple_t& t) {
-            /// timestamp (microseconds)
-            pcap_ss << t.ts << ",";
-
-            /// source and destination (IP addresses)
-            pcap_ss << t.ip_src << ",";                 // keep IPv4 address in binary format
-            pcap_ss << t.ip_dst << ",";
-
-            /// transport layer protocol
-            pcap_ss << htons(ntohs(t.protocol)) << ",";
-
-            /// entire packet length
-            pcap_ss << ntohs(t.ip_len) + 18 << ",";      // 14 bytes MAC header (6 src + 6 dst + 2 ethertype) + 4 bytes CRC checksum
-
-            /// IP length (total, header, payload)
-            pcap_ss << ntohs(t.ip_len) << ",";           // convert from network byte order to host byte order (short, 2 bytes)
-            pcap_ss << t.ip_hdrlen << ",";
-            pcap_ss << ntohs(t.ip_len) - t.ip_hdrlen << ",";
-
-            /// TCP length (header, payload)
-            pcap_ss << t.tcp_hdrlen << ",";
-            pcap_ss << ntohs(t.ip_len) - t.ip_hdrlen - t.tcp_hdrlen << ",";
-            pcap_ss << ntohs(t.port_src) << ",";
-            pcap_ss << ntohs(t.port_dst) << ",";
-            pcap_ss << ntohl(t.seq) << ",";         // convert from network byte order to host byte order (long, 4 bytes)
-            pcap_ss << ntohl(t.ack) << ",";
-            pcap_ss << t.win << ",";
-            pcap_ss << t.syn;
-
-            pcap_ss << std::endl;
-        }
-
-        /**
-         * @brief Define the format of the tuple fields for generating the human-readable csv file.
-         *
-         * @param t packet tuple to add in the csv human-readable file
-         */
-        void pushReadableString(const wf_tuple_t& t) {
-            /// timestamp (microseconds)
-            pcap_ss_read << t.ts << ",";
-            
-            /// source and destination (IP addresses)
-            char ipsrc_buf[16], ipdst_buf[16];
-            inet_ntop(AF_INET, reinterpret_cast<const void*>(&t.ip_src), ipsrc_buf, sizeof(ipsrc_buf));  // convert IPv4 address from binary to text form
-            inet_ntop(AF_INET, reinterpret_cast<const void*>(&t.ip_dst), ipdst_buf, sizeof(ipdst_buf));  // convert IPv4 address from binary to text form
-            pcap_ss_read << ipsrc_buf << ",";
-            pcap_ss_read << ipdst_buf << ",";
-
-            /// transport layer protocol
-            pcap_ss_read << htons(ntohs(t.protocol)) << ",";
-            
-            /// entire packet length
-            pcap_ss_read << ntohs(t.ip_len) + 18 << ",";      // 14 bytes MAC header (6 src + 6 dst + 2 ethertype) + 4 bytes CRC checksum
-
-            /// IP length (total, header, payload)
-            pcap_ss_read << ntohs(t.ip_len) << ",";           // convert from network byte order to host byte order (short, 2 bytes)
-            pcap_ss_read << t.ip_hdrlen << ",";
-            pcap_ss_read << ntohs(t.ip_len) - t.ip_hdrlen << ",";
-
-            /// TCP length (header, payload)
-            pcap_ss << t.tcp_hdrlen << ",";
-            pcap_ss << ntohs(t.ip_len) - t.ip_hdrlen - t.tcp_hdrlen << ",";
-            pcap_ss << ntohs(t.port_src) << ",";
-            pcap_ss << ntohs(t.port_dst) << ",";
-            pcap_ss << ntohl(t.seq) << ",";         // convert from network byte order to host byte order (long, 4 bytes)
-            pcap_ss << ntohl(t.ack) << ",";
-            pcap_ss << t.win << ",";
-            pcap_ss << t.syn;
-
-            pcap_ss_read << std::endl;
-        }
-    
     public:
         //--------------------- constructors & methods -------------------------//
 
@@ -260,7 +132,7 @@ private:
          * 
          * @param _pcap_file 
          */
-        PcapParser(const std::string& _pcap_file) {
+        PcapParser(const std::string& _pcap_file) : pcap_file(_pcap_file) {
             /// open pcap dump file
             char errbuf[PCAP_ERRBUF_SIZE];
             pcap_handle = pcap_open_offline(_pcap_file.c_str(), errbuf);
@@ -273,32 +145,30 @@ private:
          * 
          */
         void parseAll() {
+            Pcap_Mmap_Reader reader(pcap_file, BULK_WINDOW);
+            bool mapped = true;
+            try {
+                reader.open();
+            } catch (const std::exception&) {
+                mapped = false;     // not a classic pcap of ethernet frames, let libpcap decode it
+            }
+            if (mapped) {
+                pcap_dataset.reserve(reader.get_size() / 128);
+                while (reader.next_batch(pcap_dataset) > 0) {}
+                return;
+            }
             if (pcap_loop(pcap_handle, -1, userRoutine, reinterpret_cast<u_char*>(this)) == -1) {
                 throw std::runtime_error("[PcapParser] ERR: failure in pcap parsing loop");
             }
         }
 
         /**
-         * @brief Get the string representation of the pcap file relevant content.
-         *        Packet fields are represented in csv format. 
-         *        Packets are separated from each other by a newline character.
-         * 
-         * @return string containing all the packets
-         */
-        std::string getStrContent() {
-            return std::move(pcap_ss.str());
-        }
-
-        /**
-         * @brief Get the string representation of the pcap file relevant content.
-         *        Packet fields are represented in csv format. 
-         *        Packets are separated from each other by a newline character.
-         *        All values are converted in human readable format.
-         * 
-         * @return string containing all the packets in human readable format
+         * @brief Get a read-only view of the dataset of wf tuples generated from the pcap file relevant content.
+         *
+         * @return const std::vector<wf_tuple_t>& set of packet tuples
          */
-        std::string getStrReadableContent() {
-            return std::move(pcap_ss_read.str());
+        const std::vector<wf_tuple_t>& getDataset() const {
+            return pcap_dataset;
         }
 
         /**
@@ -317,9 +187,9 @@ private:
          */
         void printDatasetContent(const long long _n) {
             size_t n = (_n < 0) ? pcap_dataset.size() : _n;
-#ifdef DEBUG_PRINT_PARSER
-            std::cout << "Dataset size: " << pcap_dataset.size() << ", received _n: " << _n << ", new n: " << n << std::endl;
-#endif
+            if (trace::debug()) {
+                std::cout << "Dataset size: " << pcap_dataset.size() << ", received _n: " << _n << ", new n: " << n << std::endl;
+            }
             for (int i = 0; i < n; i++) {
                 std::cout << pcap_dataset.at(i).print() << std::endl;
             }
@@ -352,9 +222,9 @@ public:
         try {
             /// parse pcap file
             pcap_parser.parseAll();
-#ifdef DEBUG_PRINT_PARSER
-            std::cout << "PcapTransformer constructor: pcap file parsed" << std::endl;
-#endif
+            if (trace::debug()) {
+                std::cout << "PcapTransformer constructor: pcap file parsed" << std::endl;
+            }
         } catch(const std::invalid_argument& e) {
             std::cerr << e.what() << std::endl;
             throw e;
@@ -365,30 +235,38 @@ public:
     }
 
     /**
-     * @brief Generate a csv file from the pcap file content.
+     * @brief Generate a csv file from the pcap file content (to be called before toTupleDataset).
      * 
      * @param _csv_file 
      */
     void toCsv(const std::string& _csv_file) {
-        /// generate csv file
-        std::ofstream csv(_csv_file);
-        if (csv.is_open()) {
-            csv << pcap_parser.getStrContent();
-            csv.close();
+        Csv_Writer csv(_csv_file, false);
+        for (const auto& t : pcap_parser.getDataset()) {
+            csv.write(t);
         }
     }
 
     /**
-     * @brief Generate a human-readable csv file from the pcap file content.
+     * @brief Generate a human-readable csv file from the pcap file content (to be called before toTupleDataset).
      * 
      * @param _csv_file 
      */
     void toHumanReadableCsv(const std::string& _csv_file) {
-        /// generate csv file
-        std::ofstream csv(_csv_file);
-        if (csv.is_open()) {
-            csv << pcap_parser.getStrReadableContent();
-            csv.close();
+        Csv_Writer csv(_csv_file, true);
+        for (const auto& t : pcap_parser.getDataset()) {
+            csv.write(t);
+        }
+    }
+
+    /**
+     * @brief Generate a binary trace file from the pcap file content (to be called before toTupleDataset).
+     *
+     * @param _trace_file
+     */
+    void toTrace(const std::string& _trace_file) {
+        trace_file::Trace_Writer trace(_trace_file);
+        for (const auto& t : pcap_parser.getDataset()) {
+            trace.write(t);
         }
     }
 
@@ -402,37 +280,55 @@ public:
      * @return std::vector<wf_tuple_t> dataset of packet tuples
      */
     std::vector<wf_tuple_t> toTupleDataset(const long long _n) {
-#ifdef DEBUG_PRINT_PARSER
-        pcap_parser.printDatasetContent(_n);
-#endif
+        if (trace::debug()) {
+            pcap_parser.printDatasetContent(_n);
+        }
         return pcap_parser.getDatasetContent();
     }
 
     /**
-     * @brief Generate a dataset of wf tuples from a custom csv file representing the content of a pcap dump file.
+     * @brief Generate a dataset of wf tuples from a csv file in the standard format (see Csv_Writer).
      * 
      * @param _csv_file input csv file
      * @return std::vector<wf_tuple_t> dataset of packet tuples
      */
-    std::vector<wf_tuple_t> toTupleDataset(const std::string& _csv_file) {
-        std::vector<wf_tuple_t> dataset;
-        /*
+    static std::vector<wf_tuple_t> toTupleDataset(const std::string& _csv_file) {
         std::ifstream csv(_csv_file);
-        if (csv.is_open()) {
-            std::string packet;
-            tokenized_packet tok_packet;
-            while (getline(csv, packet)) {
-                size_t tok_idx = 0;
-                size_t old_pos = 0;
-                size_t pos = 0;
-                while ((pos = packet.find(",", old_pos)) != std::string::npos) {
-                    //std::get<0>(tok_packet) = packet.substr(old_pos, pos);        TODO complete implementation
-                    old_pos = pos;
-                }
+        if (!csv.is_open())
+            throw std::invalid_argument("[PcapTransformer] ERR: cannot open " + _csv_file);
 
+        std::vector<wf_tuple_t> dataset;
+        std::string packet;
+        unsigned long long fields[16];
+        while (getline(csv, packet)) {
+            if (packet.empty()) continue;
+            const char* p = packet.c_str();
+            size_t n = 0;
+            while (n < 16) {
+                char* end;
+                fields[n++] = strtoull(p, &end, 10);
+                if (*end != ',') break;
+                p = end + 1;
             }
-            csv.close();
-        }*/
+            if (n != 16)
+                throw std::invalid_argument("[PcapTransformer] ERR: malformed line in " + _csv_file + ": " + packet);
+
+            wf_tuple_t t;
+            t.ts = fields[0];
+            t.ip_src = fields[1];
+            t.ip_dst = fields[2];
+            t.protocol = fields[3];
+            t.ip_len = htons(fields[5]);
+            t.ip_hdrlen = fields[6];
+            t.tcp_hdrlen = fields[8];
+            t.port_src = htons(fields[10]);
+            t.port_dst = htons(fields[11]);
+            t.seq = htonl(fields[12]);
+            t.ack = htonl(fields[13]);
+            t.win = fields[14];
+            t.syn = fields[15];
+            dataset.push_back(t);
+        }
         return dataset;
     }
 
@@ -0,0 +1,436 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    trace_file.hpp
+ *
+ *  @brief Binary pre-parsed trace format (.hht files).
+ *
+ *  A trace file holds the TCP packets of a pcap dump already decoded, as an array of fixed size
+ *  packed records which contain exactly the fields of a wf tuple. The layout is little-endian:
+ *
+ *      offset 0   file header (magic "HHTRACE", version, record size, number of records,
+ *                 timestamps of the first and last packet, number of IPv6 pairs)
+ *      offset 64  array of records (40 bytes each)
+ *      then       full addresses of the IPv6 pairs of the records (40 bytes each)
+ *
+ *  The pairs were added with version 2, and their hashes are marked in the source field since version 3
+ *  (see ip6::is_pair): the older files are still read if they only hold IPv4 packets, while the ones
+ *  holding IPv6 pairs have to be converted again from their pcap dump.
+ *  Addresses, ports, IP length, sequence and ack numbers are stored in network representation,
+ *  as in the wf tuple (the address fields of an IPv6 packet hold the hash of its pair, see ip6::hash). The same file is read by the Flink, Storm and Spark variants of the
+ *  application (see Parser/PcapData.java), so that all the engines replay identical inputs.
+ */
+
+#pragma once
+#ifndef HH_TRACE_FILE_HPP
+#define HH_TRACE_FILE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "tuples/wf_tuple.hpp"
+
+namespace trace_file {
+
+    constexpr char MAGIC[8] = {'H', 'H', 'T', 'R', 'A', 'C', 'E', '\0'};
+    constexpr uint32_t VERSION = 3;
+    constexpr uint32_t MIN_VERSION = 1;     // oldest version read (no IPv6 pairs)
+    constexpr uint32_t PAIRS_VERSION = 3;   // oldest version read with IPv6 pairs (marked hashes)
+    constexpr std::size_t DATA_OFFSET = 64;
+
+    /**
+     * @brief Header of a trace file.
+     */
+    struct file_header {
+        char magic[8];              // "HHTRACE"
+        uint32_t version;           // format version
+        uint32_t record_size;       // size in bytes of a record
+        uint64_t records;           // number of records in the file
+        uint64_t first_ts;          // timestamp (microseconds) of the first packet
+        uint64_t last_ts;           // timestamp (microseconds) of the last packet
+        uint64_t pairs;             // number of IPv6 pairs stored after the records (0 in version 1)
+    };
+
+    /**
+     * @brief A packet record (fields in the same representation used by wf_tuple_t).
+     */
+    struct record {
+        uint64_t ts;                // capture timestamp in microseconds (epoch time)
+        uint32_t ip_src, ip_dst;    // IPv4 addresses (network representation)
+        uint32_t seq, ack;          // TCP sequence and ack numbers (network representation)
+        uint16_t port_src, port_dst;// TCP ports (network representation)
+        uint16_t ip_len;            // length of the IP packet (network representation)
+        uint16_t win;               // TCP window
+        uint8_t ip_hdrlen;          // IP header length in bytes
+        uint8_t tcp_hdrlen;         // TCP header length in bytes
+        uint8_t protocol;           // transport protocol
+        uint8_t syn;                // SYN flag
+        uint32_t reserved;
+    };
+
+    /**
+     * @brief Full addresses of an IPv6 pair of the records.
+     */
+    struct pair_record {
+        uint64_t hash;              // hash of the pair (address fields of its records)
+        uint8_t src[16], dst[16];   // full source and destination addresses (network order)
+    };
+    static_assert(sizeof(file_header) == 48, "unexpected trace file header layout");
+    static_assert(sizeof(record) == 40, "unexpected trace record layout");
+    static_assert(sizeof(pair_record) == 40, "unexpected trace pair layout");
+
+    inline record to_record(const wf_tuple_t& t) {
+        record r{};
+        r.ts = t.ts;
+        r.ip_src = t.ip_src;
+        r.ip_dst = t.ip_dst;
+        r.seq = t.seq;
+        r.ack = t.ack;
+        r.port_src = t.port_src;
+        r.port_dst = t.port_dst;
+        r.ip_len = t.ip_len;
+        r.win = t.win;
+        r.ip_hdrlen = t.ip_hdrlen;
+        r.tcp_hdrlen = t.tcp_hdrlen;
+        r.protocol = t.protocol;
+        r.syn = t.syn;
+        return r;
+    }
+
+    inline void from_record(const record& r, wf_tuple_t& t) {
+        t.ts = r.ts;
+        t.ip_src = r.ip_src;
+        t.ip_dst = r.ip_dst;
+        t.seq = r.seq;
+        t.ack = r.ack;
+        t.port_src = r.port_src;
+        t.port_dst = r.port_dst;
+        t.ip_len = r.ip_len;
+        t.win = r.win;
+        t.ip_hdrlen = r.ip_hdrlen;
+        t.tcp_hdrlen = r.tcp_hdrlen;
+        t.protocol = r.protocol;
+        t.syn = r.syn;
+    }
+
+    /**
+     * @brief Gets the number of IPv6 pairs of a trace file (0 if it only holds IPv4 packets).
+     *
+     * @param _file path of the trace file
+     * @return number of IPv6 pairs listed in the header
+     */
+    inline uint64_t ipv6_pairs(const std::string& _file) {
+        std::ifstream in(_file, std::ios::binary);
+        file_header hdr{};
+        in.read(reinterpret_cast<char*>(&hdr), sizeof(hdr));
+        return (in.good()) ? hdr.pairs : 0;
+    }
+
+    /**
+     * @brief Checks whether a file is a trace file (by its magic number).
+     *
+     * @param _file path of the file
+     * @return true if the file starts with the trace file magic number
+     */
+    inline bool is_trace_file(const std::string& _file) {
+        std::ifstream in(_file, std::ios::binary);
+        char magic[sizeof(MAGIC)] = {};
+        in.read(magic, sizeof(magic));
+        return in.good() && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+    }
+
+    /**
+     * @class Trace_Writer
+     *
+     * @brief Class writing a trace file record by record (the header is finalized by close()).
+     */
+    class Trace_Writer {
+    private:
+        std::ofstream out;
+        std::string file;           // path of the trace file
+        file_header hdr;
+        std::unordered_map<uint64_t, ip6::pair_t> pairs;    // full addresses of the IPv6 pairs written
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _file path of the trace file to create
+         */
+        explicit Trace_Writer(const std::string& _file) : out(_file, std::ios::binary | std::ios::trunc), file(_file), hdr{} {
+            if (!out.is_open())
+                throw std::invalid_argument("[Trace_Writer] ERR: cannot create " + _file);
+            std::memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+            hdr.version = VERSION;
+            hdr.record_size = sizeof(record);
+            char zeros[DATA_OFFSET] = {};
+            out.write(zeros, DATA_OFFSET);
+        }
+
+        /**
+         * @brief Appends a packet to the trace.
+         *
+         * @param t packet tuple (timestamp in microseconds)
+         */
+        void write(const wf_tuple_t& t) {
+            const record r = to_record(t);
+            out.write(reinterpret_cast<const char*>(&r), sizeof(r));
+            if (t.ip_version == 6) {
+                const uint64_t h = ip6::hash_of(t.ip_src, t.ip_dst);
+                ip6::pair_t p;
+                if (pairs.count(h) == 0 && ip6::find(t.ip_src, t.ip_dst, p)) pairs.emplace(h, p);    // just registered by the parser
+            }
+            if (hdr.records == 0) hdr.first_ts = t.ts;
+            hdr.last_ts = t.ts;
+            hdr.records++;
+        }
+
+        /**
+         * @brief Gets the number of records written so far.
+         *
+         * @return number of records
+         */
+        uint64_t get_records() const {
+            return hdr.records;
+        }
+
+        /**
+         * @brief Writes the IPv6 pairs of the records and the final header, and closes the file.
+         *
+         * Throws if any record or the header could not be written (e.g. full disk).
+         */
+        void close() {
+            if (!out.is_open()) return;
+            for (const auto& [h, p] : pairs) {
+                pair_record r{};
+                r.hash = h;
+                std::memcpy(r.src, p.src.data(), sizeof(r.src));
+                std::memcpy(r.dst, p.dst.data(), sizeof(r.dst));
+                out.write(reinterpret_cast<const char*>(&r), sizeof(r));
+            }
+            hdr.pairs = pairs.size();
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+            const bool failed = out.fail();
+            out.close();
+            if (failed || out.fail())
+                throw std::runtime_error("[Trace_Writer] ERR: cannot write " + file);
+        }
+
+        /**
+         * @brief Destructor (a writer not closed explicitly is closed here, errors are only reported).
+         */
+        ~Trace_Writer() {
+            try {
+                close();
+            } catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+            }
+        }
+    };
+
+    /**
+     * @class Trace_Mmap_Reader
+     *
+     * @brief Class reading the records of a memory mapped trace file.
+     *
+     * It provides the same interface of Pcap_Mmap_Reader, so that it can feed a Stream_Source_Functor.
+     * A reader object can be freely copied before open() is called.
+     */
+    class Trace_Mmap_Reader {
+    private:
+        static constexpr uint64_t WINDOW_RECORDS = 1 << 18;    // records kept resident ahead of the cursor
+
+        std::string trace;          // path of the trace file
+        const record* records;      // first record of the mapping
+        void* mapping;
+        std::size_t size;           // size in bytes of the mapping
+        uint64_t n_records;
+        uint64_t cursor;            // index of the next record
+        std::size_t page;           // system page size
+        std::size_t released;       // end of the range of the mapping already released
+
+        /**
+         * @brief Releases the pages behind the cursor (not released yet) and prefetches the next window of records.
+         */
+        void advance_window() {
+            const std::size_t pos = DATA_OFFSET + cursor * sizeof(record);
+            const std::size_t behind = (pos / page) * page;
+            char* base = static_cast<char*>(mapping);
+            if (behind > released) madvise(base + released, behind - released, MADV_DONTNEED);
+            released = behind;
+            const std::size_t len = std::min(WINDOW_RECORDS * sizeof(record), size - behind);
+            if (len > 0) madvise(base + behind, len, MADV_WILLNEED);
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _trace path of the trace file
+         */
+        explicit Trace_Mmap_Reader(const std::string& _trace) :
+                trace(_trace), records(nullptr), mapping(nullptr), size(0), n_records(0), cursor(0), page(4096), released(0) {}
+
+        /**
+         * @brief Copy constructor (the copy is not mapped, it has to be opened on its own).
+         */
+        Trace_Mmap_Reader(const Trace_Mmap_Reader& other) : Trace_Mmap_Reader(other.trace) {}
+
+        Trace_Mmap_Reader& operator=(const Trace_Mmap_Reader&) = delete;
+
+        /**
+         * @brief Maps the trace file and validates its header.
+         */
+        void open() {
+            int fd = ::open(trace.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::invalid_argument("[Trace_Mmap_Reader] ERR: cannot open " + trace);
+            struct stat st{};
+            if (fstat(fd, &st) < 0 || static_cast<std::size_t>(st.st_size) < DATA_OFFSET) {
+                ::close(fd);
+                throw std::invalid_argument("[Trace_Mmap_Reader] ERR: " + trace + " is not a trace file");
+            }
+            size = st.st_size;
+            mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                throw std::runtime_error("[Trace_Mmap_Reader] ERR: mmap of " + trace + " failed");
+            }
+
+            file_header hdr{};
+            std::memcpy(&hdr, mapping, sizeof(hdr));
+            if (std::memcmp(hdr.magic, MAGIC, sizeof(MAGIC)) != 0 || hdr.version < MIN_VERSION || hdr.version > VERSION || hdr.record_size != sizeof(record)
+                    || DATA_OFFSET + hdr.records * sizeof(record) + hdr.pairs * sizeof(pair_record) > size) {
+                close();
+                throw std::invalid_argument("[Trace_Mmap_Reader] ERR: " + trace + " has an unsupported format");
+            }
+            if (hdr.pairs > 0 && hdr.version < PAIRS_VERSION) {
+                close();
+                throw std::invalid_argument("[Trace_Mmap_Reader] ERR: " + trace + " holds IPv6 packets in a format older than version "
+                                            + std::to_string(PAIRS_VERSION) + ", convert it again with pcap2trace");
+            }
+            records = reinterpret_cast<const record*>(static_cast<const char*>(mapping) + DATA_OFFSET);
+            n_records = hdr.records;
+            const pair_record* pairs = reinterpret_cast<const pair_record*>(records + n_records);
+            for (uint64_t i = 0; i < hdr.pairs; i++) {
+                ip6::remember(pairs[i].hash, pairs[i].src, pairs[i].dst);   // full addresses printed by the reports
+            }
+            madvise(mapping, size, MADV_SEQUENTIAL);
+            page = sysconf(_SC_PAGESIZE);
+            rewind();
+        }
+
+        /**
+         * @brief Moves the read cursor back to the first record.
+         */
+        void rewind() {
+            cursor = 0;
+            advance_window();
+        }
+
+        /**
+         * @brief Reads the next packet of the trace.
+         *
+         * @param t wf tuple filled with the content of the packet
+         * @return false when the end of the trace is reached, true otherwise
+         */
+        bool next(wf_tuple_t& t) {
+            if (cursor == n_records) return false;
+            from_record(records[cursor++], t);
+            if ((cursor % (WINDOW_RECORDS / 2)) == 0) advance_window();
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of packets in the trace.
+         *
+         * @return number of records
+         */
+        uint64_t get_records() const {
+            return n_records;
+        }
+
+        /**
+         * @brief Gets the records of the trace as a contiguous array.
+         *
+         * @return pointer to the first record
+         */
+        const record* data() const {
+            return records;
+        }
+
+        /**
+         * @brief Unmaps the file.
+         */
+        void close() {
+            if (mapping != nullptr) {
+                munmap(mapping, size);
+                mapping = nullptr;
+                records = nullptr;
+            }
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~Trace_Mmap_Reader() {
+            close();
+        }
+    };
+
+    /**
+     * @brief Loads the whole trace file in memory as a dataset of wf tuples.
+     *
+     * @param _trace path of the trace file
+     * @return std::vector<wf_tuple_t> dataset of packet tuples
+     */
+    inline std::vector<wf_tuple_t> load(const std::string& _trace) {
+        Trace_Mmap_Reader reader(_trace);
+        reader.open();
+        std::vector<wf_tuple_t> dataset(reader.get_records());
+        const record* r = reader.data();
+        for (std::size_t i = 0; i < dataset.size(); i++) {
+            from_record(r[i], dataset[i]);
+        }
+        return dataset;
+    }
+}
+
+#endif //HH_TRACE_FILE_HPP
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    hh_tuples.hpp
+ *
+ *  @brief Structure of the tuples exchanged by the operators of the application.
+ *
+ *  Each stage of the pipeline only forwards the fields used downstream, packed without padding:
+ *  - packet_t (24 bytes): packets emitted by the sources, read by the FlowId operator;
+ *  - flow_len_t (32 bytes): packets keyed by flow, accumulated in the windows;
+ *  - hh_result_t (32 bytes): per-flow window results, read by the Detector and the Sink;
+ *  - hh_partial_t (40 bytes): partial top-K of the window results of a TopK replica, merged by TopKMerge.
+ *  The complete packet record produced by the parsers is still wf_tuple_t.
+ */
+
+#pragma once
+#ifndef HH_TUPLES_HPP
+#define HH_TUPLES_HPP
+
+#include <string>
+#include <sstream>
+#include <arpa/inet.h>
+#include "tuples/wf_tuple.hpp"
+#include "util/arena.hpp"
+#include "util/device.hpp"
+
+/**
+ * @brief Packet emitted by the sources.
+ */
+struct packet_t
+{
+    uint64_t ts;                   // timestamp (capture time in the dataset, generation time once emitted)
+    uint32_t ip_src, ip_dst;       // source/destination IP address (binary representation)
+    uint16_t port_src, port_dst;   // source/destination port (network representation)
+    uint16_t ip_len;               // length of the entire IP packet in bytes (network representation)
+    uint8_t protocol;              // transport protocol
+    uint8_t syn;                   // SYN flag of a connection request (not set on the SYN-ACK answers)
+
+    packet_t() : ts(0), ip_src(0), ip_dst(0), port_src(0), port_dst(0), ip_len(0), protocol(0), syn(0) {}
+
+    /**
+     * @brief Extracts the packet fields from a parsed wf tuple.
+     */
+    explicit packet_t(const wf_tuple_t& t) :
+            ts(t.ts), ip_src(t.ip_src), ip_dst(t.ip_dst),
+            port_src(t.port_src), port_dst(t.port_dst),
+            ip_len(t.ip_len), protocol(t.protocol), syn(t.syn && !t.ack) {}   // the ack number is only set with the ACK flag
+
+    /**
+     * @brief Prints the content of the packet.
+     *
+     * @return string representing the tuple content
+     */
+    [[nodiscard]] std::string print() const {
+        std::stringstream ss;
+        ss << "ts: " << ts << ", src: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 0) << ":" << ntohs(port_src)
+           << ", dst: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 1) << ":" << ntohs(port_dst)
+           << ", proto: " << (unsigned)protocol << ", length: " << ntohs(ip_len) + 18 << ", syn: " << (unsigned)syn;
+        return ss.str();
+    }
+};
+
+/**
+ * @brief Packet keyed by flow, with its total length.
+ */
+struct flow_len_t
+{
+    uint64_t ts;                   // timestamp (tuple generation time set in the source)
+    uint64_t flow_key;             // flow identifier (computed and set in the FlowId operator)
+    uint32_t ip_src, ip_dst;       // source/destination IP address (binary representation)
+    uint32_t total_len;            // total length in bytes of the packet
+    uint32_t port_syn;             // destination port (host order) in the low 16 bits, SYN flag in bit 16 (read by the queries), query branch above
+
+    flow_len_t() : ts(0), flow_key(0), ip_src(0), ip_dst(0), total_len(0), port_syn(0) {}
+
+    /**
+     * @brief Prints the content of the tuple essential for the application.
+     *
+     * @return string representing the tuple content
+     */
+    [[nodiscard]] std::string print() const {
+        std::stringstream ss;
+        ss << "ts: " << ts << ", src: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 0) << ", dst: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 1)
+           << ", flow: " << flow_key << ", len: " << total_len;
+        return ss.str();
+    }
+};
+
+/**
+ * @brief Per-flow result of a window.
+ */
+struct hh_result_t
+{
+    uint64_t ts;                   // timestamp of the last packet of the window (0 for empty windows)
+    uint64_t flow_key;             // flow identifier
+    uint64_t acc_len;              // total length in bytes of the packets of this flow in the window (0: the flow stopped being heavy, see Detector_Change_Functor)
+    uint32_t ip_src, ip_dst;       // source/destination IP address (binary representation)
+
+    HH_HD hh_result_t() : ts(0), flow_key(0), acc_len(0), ip_src(0), ip_dst(0) {}
+
+    /**
+     * @brief Prints the content of the tuple essential for the application.
+     *
+     * @return string representing the tuple content
+     */
+    [[nodiscard]] std::string print() const {
+        std::stringstream ss;
+        ss << "ts: " << ts << ", src: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 0) << ", dst: " << wf_tuple_t::addr_to_string(ip_src, ip_dst, 1)
+           << ", flow: " << flow_key << ", flow_len: " << acc_len;
+        return ss.str();
+    }
+};
+
+/**
+ * @brief Window result in the partial top-K of a replica of the TopK operator (or end of its window, with no result).
+ */
+struct hh_partial_t
+{
+    hh_result_t result;            // window result among the K largest of the replica (ts 0: end of the window)
+    uint64_t epoch;                // identifier of the window (timestamp of its results)
+
+    hh_partial_t() : epoch(0) {}
+};
+
+/// packets of a dataset (in the arena, a multi-GB dataset is cycled through on hugepages)
+using packets_t = arena::vector<packet_t>;
+
+static_assert(sizeof(packet_t) == 24, "unexpected packet_t layout");
+static_assert(sizeof(flow_len_t) == 32, "unexpected flow_len_t layout");
+static_assert(sizeof(hh_result_t) == 32, "unexpected hh_result_t layout");
+
+#endif //HH_TUPLES_HPP
@@ -39,20 +39,141 @@
 #ifndef HH_WF_TUPLE_HPP
 #define HH_WF_TUPLE_HPP
 
+#include <array>
+#include <atomic>
 #include <string>
+#include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <mutex>
+#include <unordered_map>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <windflow.hpp>
 
+/**
+ * @brief IPv6 flows, identified by a hash of their full addresses.
+ *
+ * The parser hashes the two full addresses of an IPv6 packet into 64 bits and stores the hash in the
+ * 32-bit address fields of the tuple (high half in ip_src, low half in ip_dst), so that the flow keys,
+ * the sketches and the tuples exchanged along the pipeline keep their IPv4 layout: the 2-tuple and the
+ * 5-tuple keys of two IPv6 flows are only shared if their hashes collide on all their 60 bits. The
+ * source field of a hash is marked with the reserved block 240.0.0.0/4, which no TCP packet comes from,
+ * so every tuple, trace record and result tells an IPv6 pair from an IPv4 one. The single
+ * addresses are not kept, so the analyses by address (-f src|dst, -m hhh|topk-dst and the queries)
+ * cannot run on IPv6 packets. The parser registers the full addresses of each hash with remember(),
+ * so that the reports can print them back in text form: they are kept in a table of fixed size, where
+ * a pair takes the slot of an older one colliding with it, so the pairs of the active flows stay
+ * registered during a long capture while the memory stays bounded. A pair no longer registered is
+ * printed as its hash (ipv6#<hash>).
+ */
+namespace ip6 {
+    /// full source and destination addresses of a hashed IPv6 pair
+    struct pair_t {
+        std::array<uint8_t, 16> src, dst;
+    };
+
+    /// slots of the table of the full addresses (a power of two), and locks protecting them
+    constexpr std::size_t NAME_SLOTS = 1 << 18;
+    constexpr std::size_t NAME_LOCKS = 64;
+
+    /// a registered pair (hash 0: empty slot)
+    struct name_t {
+        std::atomic<uint64_t> hash{0};
+        pair_t pair;
+    };
+
+    /// full addresses of the hashed pairs (written by the parsers of the source replicas, read by the reports)
+    inline name_t names[NAME_SLOTS];
+    inline std::mutex names_mutex[NAME_LOCKS];
+
+    /// an IPv6 pair has been registered
+    inline std::atomic<bool> seen{false};
+
+    /// IPv6 packets are decoded by the parser (reset when the analyses by address are selected)
+    inline bool accepted = true;
+
+    /**
+     * @brief Checks if the address fields of a tuple hold the hash of an IPv6 pair.
+     *
+     * @param ip_src source address field (network order)
+     * @return true if the field is in 240.0.0.0/4, the mark of a hashed pair
+     */
+    inline bool is_pair(const uint32_t ip_src) {
+        return (ntohl(ip_src) >> 28) == 0xf;
+    }
+
+    /**
+     * @brief Hashes the full source and destination addresses of an IPv6 packet.
+     *
+     * @param src the 16 bytes of the source address (network order)
+     * @param dst the 16 bytes of the destination address (network order)
+     * @return 64-bit hash of the pair, marked in its source field (see is_pair)
+     */
+    inline uint64_t hash(const uint8_t* src, const uint8_t* dst) {
+        uint64_t w[4];
+        std::memcpy(w, src, 16);
+        std::memcpy(w + 2, dst, 16);
+        uint64_t h = 0x9e3779b97f4a7c15ULL;
+        for (const uint64_t x : w) {
+            h = (h ^ x) * 0xbf58476d1ce4e5b9ULL;
+            h ^= h >> 31;
+        }
+        h *= 0x94d049bb133111ebULL;
+        h ^= h >> 29;
+        return h | static_cast<uint64_t>(htonl(0xf0000000u)) << 32;
+    }
+
+    /**
+     * @brief Gets the hash of a pair back from the address fields of a tuple.
+     */
+    inline uint64_t hash_of(const uint32_t ip_src, const uint32_t ip_dst) {
+        return static_cast<uint64_t>(ip_src) << 32 | ip_dst;
+    }
+
+    /**
+     * @brief Registers the full addresses of a hashed pair.
+     *
+     * A pair already in its slot is found without taking the lock, so the packets of a flow do not take it.
+     */
+    inline void remember(const uint64_t h, const uint8_t* src, const uint8_t* dst) {
+        const std::size_t slot = h & (NAME_SLOTS - 1);
+        name_t& n = names[slot];
+        if (n.hash.load(std::memory_order_acquire) == h) return;
+        std::lock_guard<std::mutex> lock(names_mutex[slot % NAME_LOCKS]);
+        std::memcpy(n.pair.src.data(), src, 16);
+        std::memcpy(n.pair.dst.data(), dst, 16);
+        n.hash.store(h, std::memory_order_release);
+        if (!seen.load(std::memory_order_relaxed)) seen.store(true);
+    }
+
+    /**
+     * @brief Looks up the full addresses of the address fields of a tuple.
+     *
+     * @param pair filled with the full addresses, if the fields hold a registered hash
+     * @return true if the fields hold a registered IPv6 pair, false for an IPv4 pair (or a pair replaced in its slot)
+     */
+    inline bool find(const uint32_t ip_src, const uint32_t ip_dst, pair_t& pair) {
+        if (!is_pair(ip_src)) return false;
+        const uint64_t h = hash_of(ip_src, ip_dst);
+        const std::size_t slot = h & (NAME_SLOTS - 1);
+        const name_t& n = names[slot];
+        if (n.hash.load(std::memory_order_acquire) != h) return false;
+        std::lock_guard<std::mutex> lock(names_mutex[slot % NAME_LOCKS]);
+        if (n.hash.load(std::memory_order_relaxed) != h) return false;
+        pair = n.pair;
+        return true;
+    }
+}
+
 struct wf_tuple_t
 {
     /* general fields */
-    uint32_t ip_src, ip_dst;       // identifies the source/destination IP address (binary representation)
+    uint32_t ip_src, ip_dst;       // identifies the source/destination IP address (binary representation, hash of the IPv6 addresses, see ip6::hash)
     uint16_t port_src, port_dst;   // identifies the source/destination port (network representation)
     uint8_t protocol;              // contains the protocol field (17 UDP, 6 TCP)
+    uint8_t ip_version;            // IP version of the packet (4 or 6)
 
     /* IP */
     uint16_t ip_hdrlen;            // length of the IP header in bytes
@@ -68,13 +189,13 @@ struct wf_tuple_t
     /* metadata fields (application specific) */
     uint64_t ts;                   // timestamp (tuple generation time set in the source)
     uint64_t flow_key;             // flow identifier (computed and set in the FlowId operator)
-    uint16_t total_len;            // total length in bytes of the IPv4 packet
-    uint64_t acc_len;              // total length in bytes of the IPv4 packets belonging to this flow in the current time window
+    uint16_t total_len;            // total length in bytes of the IP packet
+    uint64_t acc_len;              // total length in bytes of the IP packets belonging to this flow in the current time window
 
     /**
      * @brief Constructor I.
      */
-    wf_tuple_t() : ip_src(0), ip_dst(0), port_src(0), port_dst(0), protocol(0),
+    wf_tuple_t() : ip_src(0), ip_dst(0), port_src(0), port_dst(0), protocol(0), ip_version(4),
                    ip_hdrlen(0), ip_len(0),
                    tcp_hdrlen(0), seq(0), ack(0), win(0), syn(0),
                    ts(0), flow_key(0), total_len(0), acc_len(0) {}
@@ -85,7 +206,7 @@ struct wf_tuple_t
     wf_tuple_t(uint32_t _ip_src, uint32_t _ip_dst, uint16_t _port_src, uint16_t _port_dst, uint8_t _protocol) :
             ip_src(_ip_src), ip_dst(_ip_dst),
             port_src(_port_src), port_dst(_port_dst),
-            protocol(_protocol),
+            protocol(_protocol), ip_version(4),
             ip_hdrlen(0), ip_len(0),
             tcp_hdrlen(0), seq(0), ack(0), win(0), syn(0),
             ts(0), flow_key(0), total_len(0), acc_len(0) {}
@@ -94,7 +215,7 @@ struct wf_tuple_t
     * @brief Constructor III.
     */
     wf_tuple_t(uint64_t _key, uint64_t _id) :
-            ip_src(0), ip_dst(0), port_src(0), port_dst(0), protocol(0),
+            ip_src(0), ip_dst(0), port_src(0), port_dst(0), protocol(0), ip_version(4),
             ip_hdrlen(0), ip_len(0),
             tcp_hdrlen(0), seq(0), ack(0), win(0), syn(0),
             ts(0), flow_key(_key), total_len(0), acc_len(_id) {}
@@ -132,6 +253,30 @@ struct wf_tuple_t
         return std::string{buf};
     }
 
+    /**
+     * @brief Translates an address of a pair from binary to text form.
+     *
+     * The address of an IPv6 pair is printed in full if the pair is still registered, and as the hash of
+     * the pair (ipv6#<hash>) otherwise.
+     *
+     * @param ip_src source address field
+     * @param ip_dst destination address field
+     * @param addr_field flag used to select between ip_src (0) and ip_dst (1)
+     * @return the address as a string
+     */
+    static std::string addr_to_string(const uint32_t& ip_src, const uint32_t& ip_dst, const int& addr_field) {
+        if (!ip6::is_pair(ip_src)) return addr_to_string((!addr_field) ? ip_src : ip_dst);
+        ip6::pair_t pair;
+        if (ip6::find(ip_src, ip_dst, pair)) {
+            char buf6[INET6_ADDRSTRLEN];
+            inet_ntop(AF_INET6, ((!addr_field) ? pair.src : pair.dst).data(), buf6, sizeof(buf6));
+            return std::string{buf6};
+        }
+        char hash[24];
+        std::snprintf(hash, sizeof(hash), "ipv6#%016llx", static_cast<unsigned long long>(ip6::hash_of(ip_src, ip_dst)));
+        return std::string{hash};
+    }
+
     /**
      * @brief Prints the content of a wf tuple on stdout.
      *
@@ -144,7 +289,7 @@ struct wf_tuple_t
         ss << "ts: " << ts << ", ";
 
         /// source and destination (IP addresses)
-        ss << "src: " << addr_to_string(ip_src) << ", dst: " << addr_to_string(ip_dst) << ", ";
+        ss << "src: " << addr_to_string(ip_src, ip_dst, 0) << ", dst: " << addr_to_string(ip_src, ip_dst, 1) << ", ";
 
         /// transport layer protocol
         ss << "proto: " << htons(ntohs(protocol)) << ", ";
@@ -183,7 +328,7 @@ struct wf_tuple_t
         ss << "ts: " << ts << ", ";
 
         /// source and destination (IP addresses)
-        ss << "src: " << addr_to_string(ip_src) << ", dst: " << addr_to_string(ip_dst) << ", ";
+        ss << "src: " << addr_to_string(ip_src, ip_dst, 0) << ", dst: " << addr_to_string(ip_src, ip_dst, 1) << ", ";
 
         /// flow
         ss << "flow: " << flow_key << ", ";
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    adaptive_batch.hpp
+ *
+ *  @brief Batch sizes adapted at run time to the input rate and to a target on the 99th percentile of the latency.
+ *
+ *  A monitor thread reads the latency counters of the sinks at a fixed interval and keeps the p99
+ *  of the last interval. The controller of each batching replica measures its own input rate and
+ *  bounds its batch to the tuples received in a fraction of the target (so that filling a batch
+ *  never costs more than that fraction at the current rate), while an additive-increase,
+ *  multiplicative-decrease limit follows the observed p99: halved whenever the target is missed,
+ *  grown again while the latency stays well below it. A partial batch older than the flush
+ *  timeout is forwarded at the next arrival; the flow identifier also forwards its partial batch
+ *  when a source stays idle for the flush timeout, and all the partial batches are forwarded at
+ *  the end of the stream (see eos.hpp).
+ */
+
+#pragma once
+#ifndef HH_ADAPTIVE_BATCH_HPP
+#define HH_ADAPTIVE_BATCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "util/registry.hpp"
+#include "util/tsc_clock.hpp"
+
+namespace adaptive {
+
+    /// target of the adaptive batching
+    struct slo_t {
+        uint64_t p99_ns = 0;            // target on the 99th percentile of the latency (0 if disabled)
+        std::size_t max_batch = 4096;   // largest batch
+        uint64_t flush_ns = 0;          // age of a partial batch forwarded at the next arrival (or idle time of a source)
+
+        bool enabled() const {
+            return p99_ns > 0;
+        }
+    };
+
+    /**
+     * @brief Parses a target in the form p99_ms[,max_batch[,flush_ms]] (the flush timeout is 1/8 of the target by default).
+     */
+    inline slo_t parse_slo(const std::string& spec) {
+        std::vector<std::string> fields;
+        std::stringstream ss(spec);
+        std::string f;
+        while (std::getline(ss, f, ',')) fields.push_back(f);
+        slo_t slo;
+        try {
+            if (fields.empty() || fields.size() > 3) throw std::invalid_argument(spec);
+            const double p99_ms = std::stod(fields[0]);
+            if (p99_ms <= 0) throw std::invalid_argument(spec);
+            slo.p99_ns = (uint64_t)(p99_ms * 1e6);
+            if (fields.size() > 1) slo.max_batch = std::stoul(fields[1]);
+            slo.flush_ns = (fields.size() > 2) ? (uint64_t)(std::stod(fields[2]) * 1e6) : slo.p99_ns / 8;
+        } catch (const std::exception&) {
+            throw std::invalid_argument("[adaptive] ERR: invalid latency target " + spec + " (expected p99_ms[,max_batch[,flush_ms]])");
+        }
+        if (slo.max_batch == 0) throw std::invalid_argument("[adaptive] ERR: the largest batch must be positive");
+        return slo;
+    }
+
+    /**
+     * @class Slo_Monitor
+     * @brief Thread keeping the 99th percentile of the latency of the sinks over the last interval.
+     */
+    class Slo_Monitor {
+    public:
+        static constexpr long INTERVAL_MS = 50;
+
+    private:
+        std::atomic<uint64_t> last_p99;     // nanoseconds (0 before the first samples)
+        std::vector<uint64_t> prev;         // latency buckets of all the sinks at the previous reading
+        std::mutex m;
+        std::condition_variable cv;
+        bool running;
+        std::thread monitor;
+
+        void read() {
+            std::vector<uint64_t> cur(metrics::Log2_Histogram::BUCKETS, 0);
+            for (const metrics::Replica_Stats* s : metrics::registry.list()) {
+                if (s->op != "Sink") continue;
+                for (std::size_t b = 0; b < cur.size(); b++) cur[b] += s->latency.buckets[b].get();
+            }
+            uint64_t n = 0;
+            for (std::size_t b = 0; b < cur.size(); b++) n += cur[b] - prev[b];
+            if (n > 0) {
+                const uint64_t rank = (uint64_t)(0.99 * (n - 1)) + 1;
+                uint64_t seen = 0;
+                for (std::size_t b = 0; b < cur.size(); b++) {
+                    seen += cur[b] - prev[b];
+                    if (seen >= rank) {
+                        last_p99.store((uint64_t)(1.5 * (double)(1ULL << b)), std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            }
+            prev.swap(cur);
+        }
+
+    public:
+        Slo_Monitor() : last_p99(0), prev(metrics::Log2_Histogram::BUCKETS, 0), running(false) {}
+
+        ~Slo_Monitor() {
+            stop();
+        }
+
+        void start() {
+            running = true;
+            monitor = std::thread([this] {
+                std::unique_lock<std::mutex> lock(m);
+                while (running) {
+                    cv.wait_for(lock, std::chrono::milliseconds(INTERVAL_MS), [this] { return !running; });
+                    read();
+                }
+            });
+        }
+
+        void stop() {
+            {
+                std::unique_lock<std::mutex> lock(m);
+                if (!running) return;
+                running = false;
+            }
+            cv.notify_all();
+            if (monitor.joinable()) monitor.join();
+        }
+
+        /// 99th percentile of the latency in the last interval with samples (nanoseconds, within a factor of two)
+        uint64_t p99() const {
+            return last_p99.load(std::memory_order_relaxed);
+        }
+    };
+
+    /// monitor of the run
+    inline Slo_Monitor monitor;
+
+    /**
+     * @class Batch_Controller
+     * @brief Batch size of one replica (fixed, or adapted to the input rate and to the latency target).
+     */
+    class Batch_Controller {
+    public:
+        static constexpr uint64_t PERIOD_NS = 10000000;     // interval between two adjustments
+        static constexpr uint64_t FILL_SHARE = 8;           // a batch is filled in at most 1/FILL_SHARE of the target
+
+    private:
+        slo_t slo;
+        std::size_t current;            // batch size in use
+        std::size_t limit;              // bound following the observed latency
+        uint64_t period_start;
+        uint64_t arrivals;              // tuples received in the current period
+        uint64_t first_ts;              // arrival of the first tuple of the partial batch (0 if empty)
+
+        void adjust(const uint64_t now) {
+            const uint64_t p99 = monitor.p99();
+            if (p99 > slo.p99_ns) {
+                limit = std::max<std::size_t>(limit / 2, 1);
+            } else if (p99 * 10 < slo.p99_ns * 7) {
+                limit = std::min(slo.max_batch, limit + std::max<std::size_t>(limit / 4, 1));
+            }
+            const double rate = (double)arrivals / (double)(now - period_start);   // tuples per nanosecond
+            const std::size_t by_rate = std::max<std::size_t>((std::size_t)(rate * (double)(slo.p99_ns / FILL_SHARE)), 1);
+            current = std::clamp<std::size_t>(std::min(by_rate, limit), 1, slo.max_batch);
+            period_start = now;
+            arrivals = 0;
+        }
+
+    public:
+        /**
+         * @brief Constructor of a fixed batch size.
+         */
+        explicit Batch_Controller(const std::size_t batch) :
+                current(std::max<std::size_t>(batch, 1)), limit(current), period_start(0), arrivals(0), first_ts(0) {
+            slo.max_batch = current;
+        }
+
+        /**
+         * @brief Constructor of an adaptive batch size (starting from the largest one).
+         */
+        explicit Batch_Controller(const slo_t& _slo) :
+                slo(_slo), current(_slo.max_batch), limit(_slo.max_batch), period_start(0), arrivals(0), first_ts(0) {}
+
+        bool is_adaptive() const {
+            return slo.enabled();
+        }
+
+        /// capacity needed by the buffers of the batches
+        std::size_t capacity() const {
+            return slo.max_batch;
+        }
+
+        /// batch size in use
+        std::size_t size() const {
+            return current;
+        }
+
+        /**
+         * @brief Accounts a new tuple of the batch.
+         *
+         * @param buffered tuples in the batch, including the new one
+         * @return true if the batch has to be forwarded (complete, or older than the flush timeout)
+         */
+        bool add(const std::size_t buffered) {
+            if (!slo.enabled()) return buffered >= current;
+            const uint64_t now = tsc::now();
+            if (period_start == 0) period_start = now;
+            arrivals++;
+            if (now - period_start >= PERIOD_NS) adjust(now);
+            if (buffered == 1) first_ts = now;
+            return buffered >= current || (slo.flush_ns > 0 && now - first_ts >= slo.flush_ns);
+        }
+    };
+}
+
+#endif //HH_ADAPTIVE_BATCH_HPP
@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    alerts.hpp
+ *
+ *  @brief Streaming output of the heavy hitters while the application runs.
+ *
+ *  Each sink replica hands every new heavy hitter, and every increase of the peak of a known one,
+ *  to its own single-producer/single-consumer ring (see bare/ring.hpp): the push never blocks, and
+ *  an alert is dropped (and counted) if the ring is full. A dedicated writer thread drains the rings,
+ *  formats the alerts as json lines and writes them in batches to the target:
+ *  - a file (path, or file:path), appended and flushed at each batch;
+ *  - udp://host:port, one datagram per alert, a batch sent with a single sendmmsg call;
+ *  - syslog://host:port, the same with an RFC 5424 header (facility local0, severity warning);
+ *  - tcp://host:port, a stream of json lines, for collectors that forward to a message broker.
+ */
+
+#pragma once
+#ifndef HH_ALERTS_HPP
+#define HH_ALERTS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <netdb.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "bare/ring.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "util/hh_stats.hpp"
+#include "util/tsc_clock.hpp"
+
+extern volatile unsigned long app_start_time;
+
+namespace alerts {
+
+    /**
+     * @brief Heavy hitter reported by a sink.
+     */
+    struct alert_t {
+        uint64_t detected;          // detection time (ns on the clock of the run)
+        uint64_t flow_key;
+        uint64_t acc_len;           // peak bytes of the flow in a window (0 when it stopped being heavy)
+        uint32_t ip_src, ip_dst;
+        uint32_t is_new;            // first report of the flow
+    };
+
+    /**
+     * @class Alert_Writer
+     * @brief Rings of the sink replicas and thread writing the alerts to the target.
+     */
+    class Alert_Writer {
+    private:
+        enum class kind_t { FILE, UDP, SYSLOG, TCP };
+        static constexpr std::size_t BATCH = 64;                // alerts per write
+        static constexpr std::size_t RING_ENTRIES = 4096;       // per sink replica
+        static constexpr uint64_t FLUSH_NS = 10000000;          // a partial batch is written after 10 ms
+
+        std::string target;
+        kind_t kind = kind_t::FILE;
+        std::string host, path;
+        int port = 0;
+        int fd = -1;
+        std::ofstream file;
+        std::string hostname;
+
+        std::vector<std::unique_ptr<bare::Ring<alert_t>>> rings;   // one per sink replica
+        std::vector<std::atomic<uint64_t>> dropped;                // alerts lost to a full ring, per replica (written by its sink only)
+        std::thread writer;
+        std::atomic<bool> stopping{false};
+        uint64_t written = 0;
+        uint64_t failed = 0;
+
+        int connect_to(const int socktype) const {
+            addrinfo hints{}, *res = nullptr;
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = socktype;
+            if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &res) != 0 || res == nullptr) return -1;
+            int s = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+            if (s >= 0 && connect(s, res->ai_addr, res->ai_addrlen) != 0) {
+                close(s);
+                s = -1;
+            }
+            freeaddrinfo(res);
+            return s;
+        }
+
+        std::string format(const alert_t& a) const {
+            const hh_stats::Results_Table::entry_t e{a.flow_key, a.acc_len, a.ip_src, a.ip_dst, 1};
+            std::stringstream ss;
+            ss << "{\"event\":\"" << ((a.acc_len == 0) ? "cleared" : (a.is_new) ? "new" : "update") << "\""
+               << ",\"t_s\":" << (double)(a.detected - app_start_time) / 1e9
+               << ",\"dst\":\"" << hh_stats::to_string(e, prefix::dim_t::DST) << "\""
+               << ",\"src\":\"" << hh_stats::to_string(e, prefix::dim_t::SRC) << "\""
+               << ",\"flow\":" << a.flow_key
+               << ",\"bytes\":" << a.acc_len << "}";
+            return ss.str();
+        }
+
+        std::string syslog_header() const {
+            char stamp[32];
+            const std::time_t now = std::time(nullptr);
+            std::tm tm{};
+            gmtime_r(&now, &tm);
+            std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &tm);
+            return "<132>1 " + std::string(stamp) + " " + hostname + " hh - heavy-hitter - ";
+        }
+
+        void write_batch(const std::vector<std::string>& lines) {
+            if (lines.empty()) return;
+            if (kind == kind_t::FILE) {
+                for (const auto& l : lines) file << l << '\n';
+                file.flush();
+                if (file) written += lines.size();
+                else failed += lines.size();
+                return;
+            }
+            if (kind == kind_t::TCP) {
+                std::string buf;
+                for (const auto& l : lines) buf += l + '\n';
+                if (fd < 0) fd = connect_to(SOCK_STREAM);      // reconnect after an error
+                std::size_t off = 0;
+                while (fd >= 0 && off < buf.size()) {
+                    const ssize_t w = ::send(fd, buf.data() + off, buf.size() - off, MSG_NOSIGNAL);
+                    if (w <= 0) {
+                        close(fd);
+                        fd = -1;
+                        break;
+                    }
+                    off += w;
+                }
+                if (off == buf.size()) written += lines.size();
+                else failed += lines.size();
+                return;
+            }
+            std::vector<std::string> msgs;
+            const std::string header = (kind == kind_t::SYSLOG) ? syslog_header() : "";
+            for (const auto& l : lines) msgs.push_back(header + l);
+            std::vector<iovec> iov(msgs.size());
+            std::vector<mmsghdr> hdr(msgs.size());
+            for (std::size_t i = 0; i < msgs.size(); i++) {
+                iov[i].iov_base = const_cast<char*>(msgs[i].data());
+                iov[i].iov_len = msgs[i].size();
+                std::memset(&hdr[i], 0, sizeof(mmsghdr));
+                hdr[i].msg_hdr.msg_iov = &iov[i];
+                hdr[i].msg_hdr.msg_iovlen = 1;
+            }
+            std::size_t sent = 0;
+            while (fd >= 0 && sent < msgs.size()) {
+                const int n = sendmmsg(fd, hdr.data() + sent, msgs.size() - sent, 0);
+                if (n <= 0) break;
+                sent += n;
+            }
+            written += sent;
+            failed += msgs.size() - sent;
+        }
+
+        void run() {
+            std::vector<std::string> lines;
+            uint64_t last_flush = tsc::now();
+            alert_t a;
+            for (;;) {
+                const bool last = stopping.load(std::memory_order_acquire);     // drain once more after the sinks have stopped
+                std::size_t got = 0;
+                for (auto& r : rings) {
+                    for (std::size_t i = 0; i < BATCH && r->try_pop(a); i++, got++) lines.push_back(format(a));
+                }
+                const uint64_t now = tsc::now();
+                if (lines.size() >= BATCH || (!lines.empty() && (now - last_flush >= FLUSH_NS || last))) {
+                    write_batch(lines);
+                    lines.clear();
+                    last_flush = now;
+                }
+                if (last && got == 0) break;
+                if (got == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+
+    public:
+        /**
+         * @brief Sets the target and the rings of the sink replicas (before the run).
+         *
+         * @param _target file, udp://host:port, syslog://host:port or tcp://host:port
+         * @param sinks number of sink replicas
+         */
+        void configure(const std::string& _target, const std::size_t sinks) {
+            target = _target;
+            const std::size_t sep = target.find("://");
+            if (sep == std::string::npos) {
+                kind = kind_t::FILE;
+                path = (target.rfind("file:", 0) == 0) ? target.substr(5) : target;
+            } else {
+                const std::string scheme = target.substr(0, sep);
+                const std::string rest = target.substr(sep + 3);
+                const std::size_t colon = rest.rfind(':');
+                if (scheme == "udp") kind = kind_t::UDP;
+                else if (scheme == "syslog") kind = kind_t::SYSLOG;
+                else if (scheme == "tcp") kind = kind_t::TCP;
+                else throw std::invalid_argument("[Alert_Writer] ERR: unknown alert target " + target);
+                if (colon == std::string::npos) throw std::invalid_argument("[Alert_Writer] ERR: the alert target must be " + scheme + "://host:port");
+                host = rest.substr(0, colon);
+                try {
+                    port = std::stoi(rest.substr(colon + 1));
+                } catch (const std::exception&) {
+                    throw std::invalid_argument("[Alert_Writer] ERR: invalid port in " + target);
+                }
+            }
+            rings.clear();
+            for (std::size_t i = 0; i < sinks; i++) rings.push_back(std::make_unique<bare::Ring<alert_t>>(RING_ENTRIES));
+            dropped = std::vector<std::atomic<uint64_t>>(sinks);
+        }
+
+        bool enabled() const {
+            return !rings.empty();
+        }
+
+        std::string describe() const {
+            return target + " (batches of " + std::to_string(BATCH) + " alerts, at most " + std::to_string(FLUSH_NS / 1000000) + " ms late)";
+        }
+
+        /**
+         * @brief Opens the target and starts the writer thread.
+         */
+        void start() {
+            if (kind == kind_t::FILE) {
+                file.open(path, std::ios::app);
+                if (!file.is_open()) throw std::runtime_error("[Alert_Writer] ERR: cannot open the alert file " + path);
+            } else {
+                fd = connect_to((kind == kind_t::TCP) ? SOCK_STREAM : SOCK_DGRAM);
+                if (fd < 0) throw std::runtime_error("[Alert_Writer] ERR: cannot connect to " + target);
+                char name[256] = "-";
+                gethostname(name, sizeof(name) - 1);
+                hostname = name;
+            }
+            stopping = false;
+            writer = std::thread(&Alert_Writer::run, this);
+        }
+
+        /**
+         * @brief Writes the alerts still queued and stops the writer thread (after the run).
+         */
+        void stop() {
+            if (!writer.joinable()) return;
+            stopping.store(true, std::memory_order_release);
+            writer.join();
+            if (fd >= 0) close(fd);
+            fd = -1;
+            if (file.is_open()) file.close();
+        }
+
+        /**
+         * @brief Queues an alert from a sink replica (never blocks: the alert is dropped if the ring is full).
+         *
+         * @param sink index of the sink replica
+         * @param a alert
+         */
+        void publish(const std::size_t sink, const alert_t& a) {
+            if (!rings[sink]->try_push(a)) dropped[sink].store(dropped[sink].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        uint64_t sent() const {
+            return written;
+        }
+
+        uint64_t lost() const {
+            uint64_t n = failed;
+            for (const auto& d : dropped) n += d.load(std::memory_order_relaxed);
+            return n;
+        }
+
+        ~Alert_Writer() {
+            stop();
+        }
+    };
+
+    /// writer of the whole application (disabled unless configured)
+    inline Alert_Writer writer;
+}
+
+#endif //HH_ALERTS_HPP
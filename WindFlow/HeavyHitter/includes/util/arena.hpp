@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    arena.hpp
+ *
+ *  @brief Arena of the large structures of the run (datasets, per-flow state, result tables), optionally backed by hugepages.
+ *
+ *  The blocks of at least MIN_BLOCK bytes (the dataset, the arrays of the flow and the result tables,
+ *  the buckets of the hash maps) are mapped directly from the kernel: with the thp backing on regular
+ *  pages aligned to 2 MB and advised as transparent hugepages, with the 2m and 1g backings on the
+ *  reserved hugepages of that size (the 1 GB pages only for the blocks of at least 1 GB), falling back
+ *  to transparent hugepages when no reserved page is left. The nodes of the hash maps of the per-flow
+ *  state come from node pools, per thread and per node size, carved from 2 MB chunks of the arena and
+ *  recycled through a free list, so that inserting a flow on the hot path does not reach the heap
+ *  allocator. The chunks of the pools are only released at exit: a pool is first touched by the thread
+ *  of the replica that uses it, on the node of its placement.
+ *
+ *  With the heap backing (the default) the blocks and the nodes come from the heap as usual, and the
+ *  arena only counts the blocks. The backing is chosen before the structures of the run are created.
+ */
+
+#pragma once
+#ifndef HH_ARENA_HPP
+#define HH_ARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/mman.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace arena {
+
+    /// backing of the blocks
+    enum class pages_t { HEAP, THP, HUGE_2M, HUGE_1G };
+
+    inline const char* to_string(const pages_t p) {
+        switch (p) {
+            case pages_t::THP: return "thp";
+            case pages_t::HUGE_2M: return "2m";
+            case pages_t::HUGE_1G: return "1g";
+            default: return "heap";
+        }
+    }
+
+    /// parses heap, thp, 2m or 1g
+    inline bool parse_pages(const std::string& s, pages_t& p) {
+        for (const pages_t c : {pages_t::HEAP, pages_t::THP, pages_t::HUGE_2M, pages_t::HUGE_1G}) {
+            if (s == to_string(c)) {
+                p = c;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    constexpr std::size_t MIN_BLOCK = 1 << 20;          // smaller blocks always come from the heap
+    constexpr std::size_t CHUNK_BYTES = 2 << 20;        // chunk of a node pool
+    constexpr std::size_t PAGE_2M = 2 << 20;
+    constexpr std::size_t PAGE_1G = 1 << 30;
+
+    /// bytes of the process on transparent hugepages (0 if the kernel does not report them)
+    inline uint64_t thp_bytes() {
+        std::ifstream smaps("/proc/self/smaps_rollup");
+        std::string key;
+        uint64_t kb = 0;
+        while (smaps >> key) {
+            if (key == "AnonHugePages:" && smaps >> kb) return kb * 1024;
+            smaps.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        return 0;
+    }
+
+    /**
+     * @class Arena
+     * @brief Allocator of the large blocks and of the chunks of the node pools, with its statistics.
+     */
+    class Arena {
+    private:
+        struct mapping_t {
+            std::size_t bytes;      // mapped (a multiple of the page)
+            pages_t pages;          // pages actually obtained
+        };
+
+        pages_t backing;
+        mutable std::mutex m;
+        std::unordered_map<void*, mapping_t> mappings;      // live mapped blocks
+        std::atomic<uint64_t> blocks, live_bytes, peak_bytes, requested_bytes;
+        std::atomic<uint64_t> huge_2m_bytes, huge_1g_bytes, thp_mapped_bytes;  // live mapped bytes by page
+        std::atomic<uint64_t> fallbacks;                   // hugepage blocks mapped on transparent hugepages
+        std::atomic<uint64_t> chunks;
+
+        static std::size_t round_up(const std::size_t bytes, const std::size_t page) {
+            return (bytes + page - 1) / page * page;
+        }
+
+        /// regular pages aligned to 2 MB, advised as transparent hugepages
+        static void* map_thp(const std::size_t bytes) {
+            void* p = mmap(nullptr, bytes + PAGE_2M, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) return nullptr;
+            const uintptr_t base = (uintptr_t)p, aligned = round_up(base, PAGE_2M);
+            if (aligned > base) munmap(p, aligned - base);
+            munmap((void*)(aligned + bytes), base + PAGE_2M - aligned);     // the tail is never empty
+            madvise((void*)aligned, bytes, MADV_HUGEPAGE);
+            return (void*)aligned;
+        }
+
+        static void* map_huge(const std::size_t bytes, const std::size_t page) {
+            const int log2 = __builtin_ctzll(page);
+            void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (log2 << MAP_HUGE_SHIFT), -1, 0);
+            return (p == MAP_FAILED) ? nullptr : p;
+        }
+
+        std::atomic<uint64_t>& by_page(const pages_t p) {
+            return (p == pages_t::HUGE_1G) ? huge_1g_bytes : (p == pages_t::HUGE_2M) ? huge_2m_bytes : thp_mapped_bytes;
+        }
+
+        void* map(const std::size_t bytes) {
+            pages_t got = backing;
+            std::size_t size = 0;
+            void* p = nullptr;
+            if (backing == pages_t::HUGE_1G && bytes >= PAGE_1G) {
+                size = round_up(bytes, PAGE_1G);
+                p = map_huge(size, PAGE_1G);
+            }
+            if (p == nullptr && backing != pages_t::THP) {     // 2m backing, or a 1g block without a reserved page left
+                got = pages_t::HUGE_2M;
+                size = round_up(bytes, PAGE_2M);
+                p = map_huge(size, PAGE_2M);
+            }
+            if (p == nullptr) {
+                if (backing != pages_t::THP) fallbacks.fetch_add(1, std::memory_order_relaxed);
+                got = pages_t::THP;
+                size = round_up(bytes, PAGE_2M);
+                p = map_thp(size);
+            }
+            if (p == nullptr) throw std::bad_alloc();
+            {
+                std::lock_guard<std::mutex> lock(m);
+                mappings.emplace(p, mapping_t{size, got});
+            }
+            by_page(got).fetch_add(size, std::memory_order_relaxed);
+            account(size);
+            return p;
+        }
+
+        void account(const uint64_t bytes) {
+            const uint64_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            uint64_t peak = peak_bytes.load(std::memory_order_relaxed);
+            while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+        }
+
+    public:
+        Arena() : backing(pages_t::HEAP), blocks(0), live_bytes(0), peak_bytes(0), requested_bytes(0),
+                  huge_2m_bytes(0), huge_1g_bytes(0), thp_mapped_bytes(0), fallbacks(0), chunks(0) {}
+
+        /// sets the backing of the blocks (before the structures of the run are created)
+        void configure(const pages_t _backing) {
+            backing = _backing;
+        }
+
+        pages_t pages() const {
+            return backing;
+        }
+
+        /// whether the blocks and the pool chunks are mapped from the kernel
+        bool mapped() const {
+            return backing != pages_t::HEAP;
+        }
+
+        /// allocates a block of at least MIN_BLOCK bytes
+        void* allocate(const std::size_t bytes) {
+            blocks.fetch_add(1, std::memory_order_relaxed);
+            requested_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            if (mapped()) return map(bytes);
+            void* p = ::operator new(bytes);
+            account(bytes);
+            return p;
+        }
+
+        void deallocate(void* p, const std::size_t bytes) {
+            if (mapped()) {
+                mapping_t mapping{0, pages_t::HEAP};
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    auto it = mappings.find(p);
+                    if (it != mappings.end()) {
+                        mapping = it->second;
+                        mappings.erase(it);
+                    }
+                }
+                if (mapping.bytes > 0) {
+                    munmap(p, mapping.bytes);
+                    by_page(mapping.pages).fetch_sub(mapping.bytes, std::memory_order_relaxed);
+                    live_bytes.fetch_sub(mapping.bytes, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            ::operator delete(p);       // allocated from the heap
+            live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        /// chunk of CHUNK_BYTES bytes of a node pool (released at exit)
+        void* chunk() {
+            chunks.fetch_add(1, std::memory_order_relaxed);
+            return map(CHUNK_BYTES);
+        }
+
+        /**
+         * @brief Writes the statistics of the arena.
+         *
+         * @param out output stream
+         */
+        void write_summary(std::ostream& out) const {
+            const auto flags = out.flags();
+            const auto precision = out.precision();
+            out << std::fixed << std::setprecision(3);
+            out << "[ARENA] " << to_string(backing) << " backing: " << blocks.load(std::memory_order_relaxed) << " blocks of at least "
+                << MIN_BLOCK / 1048576 << " MB (" << requested_bytes.load(std::memory_order_relaxed) / 1048576.0 << " MB requested), peak "
+                << peak_mb() << " MB, " << live_bytes.load(std::memory_order_relaxed) / 1048576.0 << " MB at the end of the run\n";
+            if (mapped()) {
+                out << "[ARENA] at the end of the run: " << huge_1g_bytes.load(std::memory_order_relaxed) / 1048576.0 << " MB on 1 GB pages, "
+                    << huge_2m_bytes.load(std::memory_order_relaxed) / 1048576.0 << " MB on 2 MB pages, "
+                    << thp_mapped_bytes.load(std::memory_order_relaxed) / 1048576.0 << " MB advised as transparent hugepages ("
+                    << fallbacks.load(std::memory_order_relaxed) << " mappings without a reserved hugepage left), "
+                    << chunks.load(std::memory_order_relaxed) << " node pool chunks\n";
+            }
+            out << "[ARENA] transparent hugepages of the process: " << thp_bytes() / 1048576.0 << " MB\n";
+            out.flags(flags);
+            out.precision(precision);
+        }
+
+        /// peak of the bytes held by the blocks (MB)
+        double peak_mb() const {
+            return peak_bytes.load(std::memory_order_relaxed) / 1048576.0;
+        }
+
+        /// blocks that did not find a reserved hugepage
+        uint64_t fallback_blocks() const {
+            return fallbacks.load(std::memory_order_relaxed);
+        }
+    };
+
+    /// arena of the run
+    inline Arena blocks;
+
+    /**
+     * @class Node_Pool
+     * @brief Free list of the nodes of a size, per thread, carved from the chunks of the arena.
+     */
+    template<std::size_t Size, std::size_t Align>
+    class Node_Pool {
+    private:
+        static constexpr std::size_t ALIGN = (Align > alignof(void*)) ? Align : alignof(void*);
+        static constexpr std::size_t BYTES = (Size > sizeof(void*)) ? Size : sizeof(void*);     // a free node holds the next one
+        static constexpr std::size_t NODE = (BYTES + ALIGN - 1) / ALIGN * ALIGN;
+
+        struct free_t {
+            free_t* next;
+        };
+
+        free_t* head = nullptr;
+        char* next = nullptr;       // carving position in the current chunk
+        char* end = nullptr;
+
+    public:
+        static Node_Pool& local() {
+            thread_local Node_Pool pool;
+            return pool;
+        }
+
+        void* get() {
+            if (head != nullptr) {
+                free_t* n = head;
+                head = n->next;
+                return n;
+            }
+            if (next == end) {
+                next = (char*)blocks.chunk();
+                end = next + CHUNK_BYTES / NODE * NODE;
+            }
+            void* p = next;
+            next += NODE;
+            return p;
+        }
+
+        void put(void* p) {
+            free_t* n = (free_t*)p;
+            n->next = head;
+            head = n;
+        }
+    };
+
+    /**
+     * @class Allocator
+     * @brief Allocator of the containers in the arena: single nodes from the node pools, large blocks from the arena.
+     */
+    template<typename T>
+    class Allocator {
+    public:
+        using value_type = T;
+
+        Allocator() noexcept = default;
+
+        template<typename U>
+        Allocator(const Allocator<U>&) noexcept {}
+
+        T* allocate(const std::size_t n) {
+            if (n == 1 && blocks.mapped()) return (T*)Node_Pool<sizeof(T), alignof(T)>::local().get();
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes >= MIN_BLOCK) return (T*)blocks.allocate(bytes);
+            return (T*)::operator new(bytes);
+        }
+
+        void deallocate(T* p, const std::size_t n) noexcept {
+            if (n == 1 && blocks.mapped()) {
+                Node_Pool<sizeof(T), alignof(T)>::local().put(p);
+                return;
+            }
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes >= MIN_BLOCK) blocks.deallocate(p, bytes);
+            else ::operator delete(p);
+        }
+
+        template<typename U>
+        bool operator==(const Allocator<U>&) const noexcept {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!=(const Allocator<U>&) const noexcept {
+            return false;
+        }
+    };
+
+    /// containers in the arena
+    template<typename T>
+    using vector = std::vector<T, Allocator<T>>;
+
+    template<typename K, typename V>
+    using unordered_map = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, Allocator<std::pair<const K, V>>>;
+}
+
+#endif //HH_ARENA_HPP
@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    calibrator.hpp
+ *
+ *  @brief Calibration of the parallelism degrees of the detection pipeline on a sample of the input.
+ *
+ *  Each functor of the exact detection pipeline (source stamping, flow identifier, incremental
+ *  accumulator, detector and sink) runs alone, back to back on a thread of its own, over the first
+ *  packets of the dataset: the time of the loop gives its service time per input tuple and the ratio
+ *  of its outputs to its inputs its selectivity. The windows of the accumulator are kept as in the
+ *  bare runtime, on the capture times of the packets (so their fan-out is that of a replay at the
+ *  original speed). The cost of a queue hop is measured by a producer and a consumer on a ring.
+ *
+ *  The work of each operator per packet entering the pipeline (its service time scaled by the
+ *  selectivity of the operators before it, plus half a hop for each of its input and output tuples) decides
+ *  how the cores are shared: every operator gets one replica, then each remaining core goes to the
+ *  operator with the largest work per replica. The output batch is the power of two that brings the
+ *  cost of a hop under a tenth of the cheapest service time, and the detector is chained to the
+ *  sink when the merged operator predicts a throughput at least as high.
+ */
+
+#pragma once
+#ifndef HH_CALIBRATOR_HPP
+#define HH_CALIBRATOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <optional>
+#include <ostream>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "bare/ring.hpp"
+#include "nodes/flow_identifier.hpp"
+#include "nodes/accumulator.hpp"
+#include "nodes/detector.hpp"
+#include "nodes/sink.hpp"
+#include "util/tsc_clock.hpp"
+
+namespace calibrate {
+
+    /// operators of the pipeline, in order
+    enum op_t {SOURCE, FLOWID, ACC, DETECTOR, SINK, NUM_OPS};
+
+    inline const char* op_name(const op_t op) {
+        static const char* names[NUM_OPS] = {"Source", "FlowIdentifier", "ByteLenAccumulator", "HeavyHitterDetector", "Sink"};
+        return names[op];
+    }
+
+    /// core budget of the calibration and launch of the run with the proposed settings
+    struct spec_t {
+        std::size_t cores = 0;      // 0 disables the calibration
+        bool run = false;
+
+        bool enabled() const {
+            return cores > 0;
+        }
+    };
+
+    /**
+     * @brief Parses a calibration request in the form cores[,run].
+     */
+    inline spec_t parse(const std::string& spec) {
+        const std::size_t comma = spec.find(',');
+        spec_t s;
+        try {
+            std::size_t end = 0;
+            const std::string cores = spec.substr(0, comma);
+            s.cores = std::stoul(cores, &end);
+            if (end != cores.size()) throw std::invalid_argument(spec);
+        } catch (const std::exception&) {
+            throw std::invalid_argument("[calibrate] ERR: invalid core budget in " + spec + " (expected cores[,run])");
+        }
+        if (comma != std::string::npos) {
+            if (spec.substr(comma + 1) != "run") throw std::invalid_argument("[calibrate] ERR: unknown flag " + spec.substr(comma + 1) + " (expected cores[,run])");
+            s.run = true;
+        }
+        if (s.cores < NUM_OPS - 1) throw std::invalid_argument("[calibrate] ERR: the pipeline needs at least " + std::to_string(NUM_OPS - 1) + " cores");
+        return s;
+    }
+
+    /// measures taken on the sample
+    struct profile_t {
+        std::size_t packets = 0;        // size of the sample
+        double service_ns[NUM_OPS] = {};    // per input tuple
+        double selectivity[NUM_OPS] = {};   // output tuples per input tuple
+        double hop_ns = 0;              // transfer of a tuple between two threads
+    };
+
+    /// proposed settings
+    struct plan_t {
+        std::size_t pardeg[NUM_OPS] = {};
+        double work_ns[NUM_OPS] = {};   // per packet entering the pipeline (the detector includes the sink when chained)
+        std::size_t batch = 0;          // output batch size (0 disables the batching)
+        bool chaining = false;
+        std::size_t threads = 0;
+        double throughput = 0;          // packets per second
+        op_t bottleneck = SOURCE;
+
+        /// command line options giving the settings
+        std::string options() const {
+            std::string o = "-p ";
+            for (int i = 0; i < NUM_OPS; i++) o += ((i > 0) ? "," : "") + std::to_string(pardeg[i]);
+            if (batch > 0) o += " -b " + std::to_string(batch);
+            if (chaining) o += " -c";
+            return o;
+        }
+    };
+
+    /// largest number of packets of the sample
+    inline constexpr std::size_t SAMPLE = 200000;
+
+    /**
+     * @brief Times a loop of the calibration (nanoseconds per iteration).
+     */
+    template<typename F>
+    double per_item(const std::size_t items, F&& loop) {
+        if (items == 0) return 0;
+        const uint64_t t0 = tsc::now();
+        loop();
+        return (double)(tsc::now() - t0) / items;
+    }
+
+    /**
+     * @brief Cost of a tuple crossing a ring between two threads.
+     */
+    inline double measure_hop(const std::size_t items) {
+        bare::Ring<flow_len_t> ring(4096);
+        flow_len_t t{};
+        const uint64_t t0 = tsc::now();
+        std::thread producer([&ring, items, t] {
+            for (std::size_t i = 0; i < items; i++) ring.push(t);
+            ring.close();
+        });
+        flow_len_t r;
+        std::size_t received = 0;
+        while (received < items) {
+            if (ring.try_pop(r)) received++;
+            else bare::cpu_relax();
+        }
+        producer.join();
+        return (double)(tsc::now() - t0) / items;
+    }
+
+    /**
+     * @brief Measures the service time and the selectivity of the operators on the first packets of the dataset.
+     *
+     * The functors run on a thread of their own, so that the placement of their replica 0, if any,
+     * does not bind the calling thread. Their counters are left in the registry (see metrics::Registry::clear).
+     *
+     * @param dataset tuples of the input
+     * @param flowid flow identifier functor, any specialisation
+     * @param win_ns window length (nanoseconds)
+     * @param slide_ns window slide (nanoseconds)
+     * @return measures of the operators
+     */
+    template<typename flowid_t>
+    profile_t measure(const packets_t& dataset, flowid_t flowid, const uint64_t win_ns, const uint64_t slide_ns) {
+        if (dataset.empty()) throw std::invalid_argument("[calibrate] ERR: the input has no packets");
+        if (slide_ns == 0 || win_ns < slide_ns) throw std::invalid_argument("[calibrate] ERR: the window slide must be positive and not longer than the window");
+        profile_t p;
+        p.packets = std::min(dataset.size(), SAMPLE);
+        std::thread worker([&] {
+            wf::RuntimeContext rc(1, 0);
+            const std::size_t n = p.packets;
+
+            /// source: copy and timestamp of the packets
+            std::vector<packet_t> packets(n);
+            tsc::Stamper stamper;
+            stamper.start();
+            p.service_ns[SOURCE] = per_item(n, [&] {
+                for (std::size_t i = 0; i < n; i++) {
+                    packets[i] = dataset[i];
+                    packets[i].ts = stamper.stamp();
+                }
+            });
+            p.selectivity[SOURCE] = 1;
+
+            /// flow identifier
+            std::vector<flow_len_t> keyed(n);
+            p.service_ns[FLOWID] = per_item(n, [&] {
+                for (std::size_t i = 0; i < n; i++) keyed[i] = flowid(packets[i], rc);
+            });
+            p.selectivity[FLOWID] = 1;
+
+            /// accumulator: sliding windows of each flow on the capture times, fired as the capture time advances
+            WinAcc_Inc_Functor acc;
+            std::vector<hh_result_t> results;
+            std::unordered_map<uint64_t, std::deque<std::pair<uint64_t, hh_result_t>>> windows;
+            using closing_t = std::tuple<uint64_t, uint64_t, uint64_t>;      // end, flow, window
+            std::priority_queue<closing_t, std::vector<closing_t>, std::greater<closing_t>> closing;
+            auto fire = [&](const uint64_t watermark) {
+                while (!closing.empty() && std::get<0>(closing.top()) <= watermark) {
+                    const auto [end, key, w] = closing.top();
+                    closing.pop();
+                    auto& open = windows[key];
+                    auto it = std::lower_bound(open.begin(), open.end(), w, [](const auto& e, const uint64_t v) { return e.first < v; });
+                    results.push_back(it->second);
+                    open.erase(it);
+                    if (open.empty()) windows.erase(key);
+                }
+            };
+            const uint64_t origin = dataset[0].ts;
+            p.service_ns[ACC] = per_item(n, [&] {
+                for (std::size_t i = 0; i < n; i++) {
+                    const uint64_t ts = (dataset[i].ts - std::min(origin, dataset[i].ts)) * 1000;     // capture time since the first packet (nanoseconds)
+                    auto& open = windows[keyed[i].flow_key];
+                    const uint64_t first = (ts < win_ns) ? 0 : (ts - win_ns) / slide_ns + 1;
+                    for (uint64_t w = first; w <= ts / slide_ns; w++) {
+                        auto it = std::lower_bound(open.begin(), open.end(), w, [](const auto& e, const uint64_t v) { return e.first < v; });
+                        if (it == open.end() || it->first != w) {
+                            it = open.insert(it, {w, hh_result_t()});
+                            closing.emplace(w * slide_ns + win_ns, keyed[i].flow_key, w);
+                        }
+                        acc(keyed[i], it->second, rc);
+                    }
+                    fire(ts);
+                }
+                fire(UINT64_MAX);
+            });
+            p.selectivity[ACC] = (double)results.size() / n;
+
+            /// detector
+            Detector_Functor detector;
+            std::vector<hh_result_t> heavy;
+            p.service_ns[DETECTOR] = per_item(results.size(), [&] {
+                for (const auto& r : results) {
+                    hh_result_t t(r);
+                    if (detector(t, rc)) heavy.push_back(t);
+                }
+            });
+            p.selectivity[DETECTOR] = (results.empty()) ? 0 : (double)heavy.size() / results.size();
+
+            /// sink (no end of the stream: its results do not reach the aggregators)
+            Sink_Functor<hh_result_t> sink;
+            std::optional<hh_result_t> t;
+            p.service_ns[SINK] = per_item(heavy.size(), [&] {
+                for (const auto& h : heavy) {
+                    t = h;
+                    sink(t, rc);
+                }
+            });
+        });
+        worker.join();
+        p.hop_ns = measure_hop(p.packets);
+        return p;
+    }
+
+    /**
+     * @brief Shares the cores among the operators.
+     *
+     * @param prof measures of the operators
+     * @param cores threads of the run
+     * @param batch output batch size
+     * @param chaining detector chained to the sink (same parallelism, one thread per replica)
+     * @return settings, with their predicted throughput
+     */
+    inline plan_t allocate(const profile_t& prof, const std::size_t cores, const std::size_t batch, const bool chaining) {
+        plan_t plan;
+        plan.batch = batch;
+        plan.chaining = chaining;
+        const double hop = prof.hop_ns / std::max<std::size_t>(batch, 1) / 2;     // paid by the producer and by the consumer of a tuple
+        double in[NUM_OPS];     // tuples received per packet entering the pipeline
+        in[SOURCE] = 1;
+        for (int i = 0; i < NUM_OPS; i++) {
+            const double out = in[i] * prof.selectivity[i];
+            plan.work_ns[i] = in[i] * prof.service_ns[i] + ((i > SOURCE) ? in[i] * hop : 0) + ((i < SINK) ? out * hop : 0);
+            if (i < SINK) in[i + 1] = out;
+        }
+        const int units = (chaining) ? NUM_OPS - 1 : NUM_OPS;      // the chained sink runs in the threads of the detector
+        if (chaining) plan.work_ns[DETECTOR] += plan.work_ns[SINK] - 2 * in[SINK] * hop;    // no hop between the detector and the sink
+        for (int i = 0; i < units; i++) plan.pardeg[i] = 1;
+        for (std::size_t c = units; c < cores; c++) {
+            int next = 0;
+            for (int i = 1; i < units; i++) {
+                if (plan.work_ns[i] / plan.pardeg[i] > plan.work_ns[next] / plan.pardeg[next]) next = i;
+            }
+            plan.pardeg[next]++;
+        }
+        plan.threads = std::max<std::size_t>(cores, units);
+        double slowest = 0;
+        for (int i = 0; i < units; i++) {
+            if (plan.work_ns[i] / plan.pardeg[i] > slowest) {
+                slowest = plan.work_ns[i] / plan.pardeg[i];
+                plan.bottleneck = (op_t)i;
+            }
+        }
+        if (chaining) {
+            plan.pardeg[SINK] = plan.pardeg[DETECTOR];
+            plan.work_ns[SINK] = 0;
+        }
+        plan.throughput = (slowest > 0) ? 1e9 / slowest : 0;
+        return plan;
+    }
+
+    /**
+     * @brief Proposes the settings of the run for a core budget.
+     *
+     * @param prof measures of the operators
+     * @param cores threads of the run
+     * @param tuning the runtime has output batches and chaining (WindFlow), otherwise only the parallelism is set
+     * @return settings with the highest predicted throughput
+     */
+    inline plan_t propose(const profile_t& prof, const std::size_t cores, const bool tuning) {
+        std::size_t batch = 0;
+        if (tuning) {
+            double cheapest = 0;      // service time of the cheapest operator receiving or emitting tuples
+            for (int i = 0; i < NUM_OPS; i++) {
+                if (prof.service_ns[i] > 0 && (cheapest == 0 || prof.service_ns[i] < cheapest)) cheapest = prof.service_ns[i];
+            }
+            batch = 1;
+            while (batch < 256 && prof.hop_ns / batch > 0.1 * cheapest) batch *= 2;
+            if (batch == 1) batch = 0;
+        }
+        if (!tuning) return allocate(prof, std::max<std::size_t>(cores, NUM_OPS), 0, false);
+        const plan_t chained = allocate(prof, cores, batch, true);
+        if (cores < NUM_OPS) return chained;
+        const plan_t plain = allocate(prof, cores, batch, false);
+        return (chained.throughput >= plain.throughput) ? chained : plain;
+    }
+
+    /**
+     * @brief Writes the measures and the proposed settings.
+     *
+     * @param out output stream
+     * @param prof measures of the operators
+     * @param plan proposed settings
+     */
+    inline void write_summary(std::ostream& out, const profile_t& prof, const plan_t& plan) {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(1);
+        out << "[CALIBRATE] sample of " << prof.packets << " packets, queue hop " << prof.hop_ns << " ns\n";
+        out << "[CALIBRATE] " << std::left << std::setw(20) << "operator" << std::right << std::setw(12) << "service ns" << std::setw(13) << "selectivity"
+            << std::setw(16) << "work ns/packet" << std::setw(10) << "replicas" << "\n";
+        for (int i = 0; i < NUM_OPS; i++) {
+            out << "[CALIBRATE] " << std::left << std::setw(20) << op_name((op_t)i) << std::right << std::setw(12) << prof.service_ns[i]
+                << std::setw(13) << std::setprecision(4) << prof.selectivity[i] << std::setprecision(1) << std::setw(16) << plan.work_ns[i]
+                << std::setw(10) << plan.pardeg[i] << ((plan.chaining && i == SINK) ? " (chained)" : "") << "\n";
+        }
+        out << "[CALIBRATE] predicted throughput: " << std::setprecision(3) << plan.throughput / 1e6 << " Mpps on " << plan.threads
+            << " threads (bottleneck: " << op_name(plan.bottleneck) << ")\n";
+        out << "[CALIBRATE] proposed settings: " << plan.options() << "\n";
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif //HH_CALIBRATOR_HPP
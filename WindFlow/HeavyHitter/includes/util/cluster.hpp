@@ -0,0 +1,446 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    cluster.hpp
+ *
+ *  @brief Multi-node runs: each node processes its own share of the traffic and ships its summary to a coordinator.
+ *
+ *  A node (-N id/nodes@host:port) runs the whole pipeline on its share of the traffic and, at the end
+ *  of the run, sends to the coordinator a compact binary summary over TCP: the measures of the run,
+ *  the latency histogram of its sinks and the table of its heavy hitters. The coordinator (-C nodes@port)
+ *  waits for all the nodes and merges the summaries with the same aggregators used to merge the sink
+ *  replicas of a single process, so that the reports have the same format.
+ *
+ *  Message: magic "HHN1", payload length (u32), then the payload fields in little endian.
+ */
+
+#pragma once
+#ifndef HH_CLUSTER_HPP
+#define HH_CLUSTER_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "tuples/wf_tuple.hpp"
+#include "util/flow.hpp"
+#include "util/histogram.hpp"
+#include "util/hh_stats.hpp"
+#include "util/trace.hpp"
+
+namespace cluster {
+
+    constexpr uint32_t MAGIC = 0x314e4848;      // "HHN1"
+    constexpr uint32_t MAX_MESSAGE = 1u << 30;
+
+    /**
+     * @brief Node of a multi-node run (nodes is 0 in a single-node run).
+     */
+    struct node_spec_t {
+        std::size_t id = 0;
+        std::size_t nodes = 0;
+        std::string host;           // coordinator
+        int port = 0;
+
+        bool enabled() const {
+            return nodes > 0;
+        }
+
+        /// true if a flow (or prefix) key belongs to the share of this node
+        bool owns(const uint64_t key) const {
+            return (flow::mix64(key ^ 0x5bd1e995ULL) >> 32) % nodes == id;    // independent of the sharding among the replicas
+        }
+    };
+
+    /**
+     * @brief Parses the description of a node (id/nodes@host:port).
+     */
+    inline node_spec_t parse_node(const std::string& s) {
+        node_spec_t n;
+        const std::size_t slash = s.find('/'), at = s.find('@'), colon = s.rfind(':');
+        if (slash == std::string::npos || at == std::string::npos || colon == std::string::npos || !(slash < at && at < colon))
+            throw std::invalid_argument("[cluster] ERR: the node must be given as id/nodes@host:port (" + s + ")");
+        try {
+            n.id = std::stoul(s.substr(0, slash));
+            n.nodes = std::stoul(s.substr(slash + 1, at - slash - 1));
+            n.port = std::stoi(s.substr(colon + 1));
+        } catch (const std::exception&) {
+            throw std::invalid_argument("[cluster] ERR: the node must be given as id/nodes@host:port (" + s + ")");
+        }
+        n.host = s.substr(at + 1, colon - at - 1);
+        if (n.nodes == 0 || n.id >= n.nodes || n.port <= 0 || n.port > 65535 || n.host.empty())
+            throw std::invalid_argument("[cluster] ERR: invalid node " + s);
+        return n;
+    }
+
+    /**
+     * @brief Parses the description of the coordinator (nodes@port[:timeout s]).
+     */
+    inline void parse_coordinator(const std::string& s, std::size_t& nodes, int& port, int& timeout_s) {
+        const std::size_t at = s.find('@'), colon = s.find(':');
+        try {
+            if (at == std::string::npos || (colon != std::string::npos && colon < at)) throw std::invalid_argument(s);
+            std::size_t used = 0;
+            nodes = std::stoul(s.substr(0, at), &used);
+            if (used != at) throw std::invalid_argument(s);
+            const std::string p = s.substr(at + 1, (colon == std::string::npos) ? std::string::npos : colon - at - 1);
+            port = std::stoi(p, &used);
+            if (used != p.size()) throw std::invalid_argument(s);
+            if (colon != std::string::npos) {
+                const std::string t = s.substr(colon + 1);
+                timeout_s = std::stoi(t, &used);
+                if (used != t.size()) throw std::invalid_argument(s);
+            }
+        } catch (const std::exception&) {
+            throw std::invalid_argument("[cluster] ERR: the coordinator must be given as nodes@port[:timeout s] (" + s + ")");
+        }
+        if (nodes == 0 || port <= 0 || port > 65535 || timeout_s <= 0)
+            throw std::invalid_argument("[cluster] ERR: invalid coordinator " + s);
+    }
+
+    /**
+     * @brief Encoder of the messages.
+     */
+    class Writer {
+    public:
+        std::vector<uint8_t> buf;
+
+        void u64(uint64_t v) {
+            for (int i = 0; i < 8; i++, v >>= 8) buf.push_back((uint8_t)v);
+        }
+
+        void u32(uint32_t v) {
+            for (int i = 0; i < 4; i++, v >>= 8) buf.push_back((uint8_t)v);
+        }
+
+        void f64(const double v) {
+            uint64_t b;
+            std::memcpy(&b, &v, sizeof(b));
+            u64(b);
+        }
+
+        void bytes(const uint8_t* p, const std::size_t n) {
+            buf.insert(buf.end(), p, p + n);
+        }
+    };
+
+    /**
+     * @brief Decoder of the messages (throws on truncated messages).
+     */
+    class Reader {
+    private:
+        const uint8_t* p;
+        const uint8_t* end;
+
+        void need(const std::size_t n) const {
+            if ((std::size_t)(end - p) < n) throw std::runtime_error("[cluster] ERR: truncated message");
+        }
+
+    public:
+        Reader(const uint8_t* _p, const std::size_t _n) : p(_p), end(_p + _n) {}
+
+        uint64_t u64() {
+            need(8);
+            uint64_t v = 0;
+            for (int i = 7; i >= 0; i--) v = v << 8 | p[i];
+            p += 8;
+            return v;
+        }
+
+        uint32_t u32() {
+            need(4);
+            const uint32_t v = (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+            p += 4;
+            return v;
+        }
+
+        double f64() {
+            const uint64_t b = u64();
+            double v;
+            std::memcpy(&v, &b, sizeof(v));
+            return v;
+        }
+
+        void bytes(uint8_t* out, const std::size_t n) {
+            need(n);
+            std::memcpy(out, p, n);
+            p += n;
+        }
+    };
+
+    /**
+     * @brief Summary of the run of a node.
+     */
+    struct node_report_t {
+        uint32_t node = 0;
+        uint64_t sent = 0, received = 0;    // tuples emitted by the sources and received by the sinks
+        double measured_s = 0;              // length of the measurement interval
+        double throughput = 0;              // tuples/second
+        double cpu_util = 0;                // busy cores on average
+        uint64_t threads = 0;
+        bool prefix_results = false;        // the keys of the results are IP prefixes (see hh_stats::prefix_results)
+        metrics::Histogram latencies;       // latency of the marked tuples received by the sinks (nanoseconds)
+        hh_stats::Results_Table results;    // heavy hitters of the node (max window volume of each flow)
+        std::vector<std::pair<uint64_t, ip6::pair_t>> ip6_names;    // full addresses of the IPv6 results
+
+        void encode(Writer& w) const {
+            w.u32(node);
+            w.u64(sent);
+            w.u64(received);
+            w.f64(measured_s);
+            w.f64(throughput);
+            w.f64(cpu_util);
+            w.u64(threads);
+            w.u32(prefix_results);
+            latencies.encode(w);
+            w.u64(results.size());
+            results.for_each([&w](const hh_stats::Results_Table::entry_t& e) {
+                w.u64(e.flow_key);
+                w.u64(e.acc_len);
+                w.u32(e.ip_src);
+                w.u32(e.ip_dst);
+            });
+            w.u64(ip6_names.size());
+            for (const auto& [h, pair] : ip6_names) {
+                w.u64(h);
+                w.bytes(pair.src.data(), pair.src.size());
+                w.bytes(pair.dst.data(), pair.dst.size());
+            }
+        }
+
+        void decode(Reader& r) {
+            node = r.u32();
+            sent = r.u64();
+            received = r.u64();
+            measured_s = r.f64();
+            throughput = r.f64();
+            cpu_util = r.f64();
+            threads = r.u64();
+            prefix_results = r.u32() != 0;
+            latencies.decode(r);
+            for (uint64_t n = r.u64(); n > 0; n--) {
+                const uint64_t key = r.u64(), acc_len = r.u64();
+                const uint32_t ip_src = r.u32(), ip_dst = r.u32();
+                results.upsert(key, ip_src, ip_dst, acc_len);
+            }
+            for (uint64_t n = r.u64(); n > 0; n--) {
+                std::pair<uint64_t, ip6::pair_t> name;
+                name.first = r.u64();
+                r.bytes(name.second.src.data(), name.second.src.size());
+                r.bytes(name.second.dst.data(), name.second.dst.size());
+                ip6_names.push_back(name);
+            }
+        }
+
+        /// collects the full addresses of the IPv6 pairs of the results
+        void add_ip6_names() {
+            if (prefix_results) return;
+            results.for_each([this](const hh_stats::Results_Table::entry_t& e) {
+                ip6::pair_t pair;
+                if (ip6::find(e.ip_src, e.ip_dst, pair)) ip6_names.emplace_back(ip6::hash_of(e.ip_src, e.ip_dst), pair);
+            });
+        }
+    };
+
+    inline void write_all(const int fd, const uint8_t* p, std::size_t n) {
+        while (n > 0) {
+            const ssize_t w = ::send(fd, p, n, MSG_NOSIGNAL);
+            if (w <= 0) throw std::runtime_error("[cluster] ERR: " + std::string(strerror(errno)));
+            p += w;
+            n -= w;
+        }
+    }
+
+    inline bool read_all(const int fd, uint8_t* p, std::size_t n) {
+        while (n > 0) {
+            const ssize_t r = ::recv(fd, p, n, 0);
+            if (r <= 0) return false;
+            p += r;
+            n -= r;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Sends the summary of a node to the coordinator (retrying the connection while it is not listening yet).
+     *
+     * @param spec node
+     * @param report summary of the run of the node
+     * @param timeout_s how long to retry the connection
+     */
+    inline void send_report(const node_spec_t& spec, const node_report_t& report, const int timeout_s = 30) {
+        Writer w;
+        w.u32(MAGIC);
+        w.u32(0);
+        report.encode(w);
+        const uint32_t len = w.buf.size() - 8;
+        for (int i = 0; i < 4; i++) w.buf[4 + i] = (uint8_t)(len >> (8 * i));
+
+        addrinfo hints{}, *res = nullptr;
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(spec.host.c_str(), std::to_string(spec.port).c_str(), &hints, &res) != 0 || res == nullptr)
+            throw std::runtime_error("[cluster] ERR: cannot resolve the coordinator " + spec.host);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s);
+        int fd = -1;
+        while (true) {
+            for (const addrinfo* a = res; a != nullptr && fd < 0; a = a->ai_next) {   // every address of the host (IPv6 and IPv4)
+                fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+                if (fd >= 0 && connect(fd, a->ai_addr, a->ai_addrlen) != 0) {
+                    close(fd);
+                    fd = -1;
+                }
+            }
+            if (fd >= 0 || std::chrono::steady_clock::now() > deadline) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        freeaddrinfo(res);
+        if (fd < 0) throw std::runtime_error("[cluster] ERR: cannot connect to the coordinator " + spec.host + ":" + std::to_string(spec.port));
+        try {
+            write_all(fd, w.buf.data(), w.buf.size());
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+    }
+
+    /// listening socket of the coordinator, dual stack (IPv4 clients are mapped) or IPv4 only if IPv6 is not available
+    inline int listen_on(const int port, const int backlog) {
+        const int one = 1, zero = 0;
+        int ls = socket(AF_INET6, SOCK_STREAM, 0);
+        if (ls >= 0) {
+            setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            setsockopt(ls, IPPROTO_IPV6, IPV6_V6ONLY, &zero, sizeof(zero));
+            sockaddr_in6 addr{};
+            addr.sin6_family = AF_INET6;
+            addr.sin6_addr = in6addr_any;
+            addr.sin6_port = htons(port);
+            if (bind(ls, (sockaddr*)&addr, sizeof(addr)) == 0 && listen(ls, backlog) == 0) return ls;
+            close(ls);
+        }
+        ls = socket(AF_INET, SOCK_STREAM, 0);
+        if (ls < 0) throw std::runtime_error("[cluster] ERR: cannot create the coordinator socket");
+        setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        if (bind(ls, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(ls, backlog) != 0) {
+            close(ls);
+            throw std::runtime_error("[cluster] ERR: cannot listen on port " + std::to_string(port));
+        }
+        return ls;
+    }
+
+    /**
+     * @brief Waits for the summaries of the nodes (coordinator side).
+     *
+     * The coordinator waits for the first summary as long as needed (it does not know the duration of
+     * the runs), then at most timeout_s seconds for each of the next ones: the nodes run for the same
+     * time, so a node silent for longer has failed, and the summaries received are merged without it.
+     *
+     * @param nodes number of nodes of the run
+     * @param port TCP port of the coordinator
+     * @param timeout_s longest wait for the next summary, after the first one
+     * @return summaries received, in order of node id
+     */
+    inline std::vector<node_report_t> collect_reports(const std::size_t nodes, const int port, const int timeout_s = 60) {
+        const int ls = listen_on(port, (int)nodes);
+        std::vector<node_report_t> reports(nodes);
+        std::vector<bool> received(nodes, false);
+        std::size_t pending = nodes;
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        while (pending > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) break;
+            const int wait_ms = (deadline == std::chrono::steady_clock::time_point::max()) ? 1000
+                                : (int)std::min<long>(1000, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1);
+            struct pollfd pfd = {ls, POLLIN, 0};
+            if (poll(&pfd, 1, wait_ms) <= 0) continue;
+            const int fd = accept(ls, nullptr, nullptr);
+            if (fd < 0) continue;
+            struct timeval rcv_timeout = {timeout_s, 0};   // a node stalled in the middle of its summary is dropped too
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &rcv_timeout, sizeof(rcv_timeout));
+            uint8_t header[8];
+            std::vector<uint8_t> payload;
+            bool ok = read_all(fd, header, sizeof(header));
+            if (ok) {
+                Reader h(header, sizeof(header));
+                const uint32_t magic = h.u32(), len = h.u32();
+                ok = (magic == MAGIC && len <= MAX_MESSAGE);
+                if (ok) {
+                    payload.resize(len);
+                    ok = read_all(fd, payload.data(), len);
+                }
+            }
+            close(fd);
+            node_report_t r;
+            try {
+                if (!ok) throw std::runtime_error("[cluster] ERR: invalid message");
+                Reader rd(payload.data(), payload.size());
+                r.decode(rd);
+            } catch (const std::runtime_error& e) {
+                std::cout << e.what() << " (connection ignored)" << std::endl;
+                continue;
+            }
+            if (r.node >= nodes || received[r.node]) {
+                std::cout << "[cluster] ERR: unexpected summary of node " << r.node << " (ignored)" << std::endl;
+                continue;
+            }
+            received[r.node] = true;
+            pending--;
+            deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s);
+            if (trace::summary()) {
+                std::cout << "[cluster] summary of node " << r.node << " received (" << pending << " pending)" << std::endl;
+            }
+            reports[r.node] = std::move(r);
+        }
+        close(ls);
+        std::vector<node_report_t> got;
+        for (std::size_t n = 0; n < nodes; n++) {
+            if (received[n]) got.push_back(std::move(reports[n]));
+            else std::cout << "[cluster] ERR: no summary from node " << n << " within " << timeout_s << " s of the previous one (merged without it)" << std::endl;
+        }
+        return got;
+    }
+}
+
+#endif //HH_CLUSTER_HPP
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    count_min.hpp
+ *
+ *  @brief Count-Min sketch over a sliding window.
+ *
+ *  The window of length win is divided into win/slide panes: each pane has its own sketch and a
+ *  further sketch holds the sum of the panes in the window. A packet updates the sketches of the
+ *  current pane and of the window, and when the window slides the sketch of the expired pane is
+ *  subtracted from the window sketch and reused for the new pane. The memory is fixed and equal
+ *  to (win/slide + 1) * depth * width counters.
+ *
+ *  The estimate of the bytes of a flow never underestimates the true value, and it exceeds it by
+ *  more than eps * N (N total bytes in the window) with probability at most delta, where
+ *  eps = e / width and delta = e^(-depth).
+ */
+
+#pragma once
+#ifndef HH_COUNT_MIN_HPP
+#define HH_COUNT_MIN_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+#include "util/flow.hpp"
+
+namespace sketch {
+
+    /**
+     * @class Window_Count_Min
+     * @brief Count-Min sketch of the byte counts of the flows in a sliding window.
+     */
+    class Window_Count_Min {
+    private:
+        std::size_t width;                  // counters per row (power of two)
+        std::size_t depth;                  // number of rows (independent hash functions)
+        std::size_t panes;                  // panes per window
+        std::vector<uint64_t> window;       // depth x width counters of the window
+        std::vector<uint64_t> ring;         // panes x depth x width counters of the single panes
+        std::vector<uint64_t> pane_bytes;   // total bytes of each pane
+        std::size_t current;                // pane receiving the updates
+        uint64_t window_bytes;              // total bytes in the window
+
+        std::size_t column(const uint64_t key, const std::size_t row) const {
+            return flow::mix64(key + (row + 1) * 0x9e3779b97f4a7c15ULL) & (width - 1);
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _width counters per row (rounded up to a power of two)
+         * @param _depth number of rows
+         * @param _panes number of panes in the window (win / slide)
+         */
+        Window_Count_Min(const std::size_t _width, const std::size_t _depth, const std::size_t _panes) :
+                width(0), depth(_depth), panes(std::max<std::size_t>(_panes, 1)), current(0), window_bytes(0) {
+            if (_width == 0 || _depth == 0)
+                throw std::invalid_argument("[Window_Count_Min] ERR: width and depth must be positive");
+            width = round_width(_width);
+            window.assign(depth * width, 0);
+            ring.assign(panes * depth * width, 0);
+            pane_bytes.assign(panes, 0);
+        }
+
+        /**
+         * @brief Adds the bytes of a packet to its flow.
+         *
+         * @param key flow key
+         * @param bytes packet length
+         * @return estimate of the bytes of the flow in the window (packet included)
+         */
+        uint64_t update(const uint64_t key, const uint64_t bytes) {
+            uint64_t* pane = ring.data() + current * depth * width;
+            uint64_t estimate = UINT64_MAX;
+            for (std::size_t r = 0; r < depth; r++) {
+                const std::size_t c = r * width + column(key, r);
+                pane[c] += bytes;
+                window[c] += bytes;
+                estimate = std::min(estimate, window[c]);
+            }
+            pane_bytes[current] += bytes;
+            window_bytes += bytes;
+            return estimate;
+        }
+
+        /**
+         * @brief Estimates the bytes of a flow in the window.
+         *
+         * @param key flow key
+         * @return estimated bytes
+         */
+        uint64_t estimate(const uint64_t key) const {
+            uint64_t estimate = UINT64_MAX;
+            for (std::size_t r = 0; r < depth; r++) {
+                estimate = std::min(estimate, window[r * width + column(key, r)]);
+            }
+            return estimate;
+        }
+
+        /**
+         * @brief Slides the window by one pane (the oldest pane expires).
+         */
+        void slide() {
+            current = (current + 1) % panes;
+            uint64_t* pane = ring.data() + current * depth * width;
+            for (std::size_t i = 0; i < depth * width; i++) {
+                window[i] -= pane[i];
+                pane[i] = 0;
+            }
+            window_bytes -= pane_bytes[current];
+            pane_bytes[current] = 0;
+        }
+
+        /**
+         * @brief Empties the window.
+         */
+        void clear() {
+            std::fill(window.begin(), window.end(), 0);
+            std::fill(ring.begin(), ring.end(), 0);
+            std::fill(pane_bytes.begin(), pane_bytes.end(), 0);
+            window_bytes = 0;
+        }
+
+        /**
+         * @brief Gets the total bytes in the window (N in the error bound).
+         */
+        uint64_t get_window_bytes() const {
+            return window_bytes;
+        }
+
+        std::size_t get_width() const {
+            return width;
+        }
+
+        std::size_t get_depth() const {
+            return depth;
+        }
+
+        std::size_t get_panes() const {
+            return panes;
+        }
+
+        /**
+         * @brief Gets the memory used by the counters.
+         *
+         * @return size in bytes
+         */
+        std::size_t get_memory() const {
+            return (window.size() + ring.size() + pane_bytes.size()) * sizeof(uint64_t);
+        }
+
+        /**
+         * @brief Gets the relative error eps of the estimates (with respect to the window volume).
+         */
+        double get_epsilon() const {
+            return epsilon(width);
+        }
+
+        /**
+         * @brief Gets the probability delta that an estimate exceeds the error bound.
+         */
+        double get_delta() const {
+            return delta(depth);
+        }
+
+        static std::size_t round_width(const std::size_t _width) {
+            std::size_t w = 1;
+            while (w < _width) w <<= 1;
+            return w;
+        }
+
+        static double epsilon(const std::size_t _width) {
+            return std::exp(1.0) / round_width(_width);
+        }
+
+        static double delta(const std::size_t _depth) {
+            return std::exp(-(double)_depth);
+        }
+
+        /**
+         * @brief Gets the memory used by the counters of a sketch with the given parameters.
+         *
+         * @return size in bytes
+         */
+        static std::size_t memory(const std::size_t _width, const std::size_t _depth, const std::size_t _panes) {
+            const std::size_t p = std::max<std::size_t>(_panes, 1);
+            return ((p + 1) * _depth * round_width(_width) + p) * sizeof(uint64_t);
+        }
+    };
+}
+
+#endif //HH_COUNT_MIN_HPP
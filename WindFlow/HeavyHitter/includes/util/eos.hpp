@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    eos.hpp
+ *
+ *  @brief End of the stream in the operators which keep tuples or windows across their inputs.
+ *
+ *  The FlatMap operators are not called at the end of the stream, so what their replicas still
+ *  hold would be lost. It is delivered in two ways:
+ *  - markers, in front of the windows of WindFlow: when it ends each source replica sends a marker
+ *    packet to each replica of the flow identifier, for each replica of the keyed stage behind it
+ *    (Sketch, HierarchicalHeavyHitterDetector or the flow table), if any. The flow identifier is
+ *    then partitioned on a key spreading the packets evenly, and each marker is routed by its pair
+ *    of replicas (the keyBy of WindFlow sends the key k to the replica std::hash(k) % n, that is,
+ *    k % n for an integer key). The batch flow identifier and the pre-aggregation flush what they
+ *    hold at each marker, and forward it to the pre-aggregation or the keyed stage, whose replicas flush their windows
+ *    once they have received the markers of all the sources through all the flow identifiers;
+ *  - drains, behind the windows of WindFlow, which do not forward the markers: the replicas of the
+ *    operators register a drain of what they hold, run by the last sink replica receiving the end
+ *    of the stream (all the other operators have terminated by then), which takes the results.
+ *  The markers never reach the windows of WindFlow, the queries or the sinks. With a flush timeout of the
+ *  adaptive batches, a source idle for that long also sends flush markers, which only make the flow
+ *  identifiers forward their partial batch (they are not passed on).
+ */
+
+#pragma once
+#ifndef HH_EOS_HPP
+#define HH_EOS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/hh_tuples.hpp"
+#include "util/event_time.hpp"
+#include "util/flow.hpp"
+
+namespace eos {
+
+    /// transport protocol of a marker packet (reserved value, never carried by a parsed or generated packet)
+    constexpr uint8_t MARKER = 0xff;
+
+    /// markers sent by the sources (set before the topology is built)
+    struct plan_t {
+        std::size_t sources = 1;        // source replicas
+        std::size_t flowid = 0;         // flow identifier replicas (0: no markers are sent)
+        std::size_t keyed = 0;          // replicas of the keyed stage receiving the markers (0: none, they stop before)
+        bool preagg = false;            // the pre-aggregation chained to the flow identifier receives the markers
+        uint64_t idle_ns = 0;           // idle time of a source sending the flush markers (0: never)
+
+        bool enabled() const {
+            return flowid > 0;
+        }
+
+        /// the flow identifier passes the markers on
+        bool forwarded() const {
+            return keyed > 0 || preagg;
+        }
+
+        /// markers received by a replica of the keyed stage before the end of its stream
+        std::size_t expected() const {
+            return sources * flowid;
+        }
+    };
+    inline plan_t plan;
+
+    /// port_dst of a flush marker (the source is idle, the stream goes on)
+    constexpr uint16_t FLUSH = 1;
+
+    inline bool is_marker(const packet_t& t) {
+        return t.protocol == MARKER;
+    }
+
+    inline bool is_flush(const packet_t& t) {
+        return t.port_dst == FLUSH;
+    }
+
+    /// a packet keyed by flow is a marker if it has no bytes (the packets and the partial sums have at least a frame)
+    inline bool is_marker(const flow_len_t& t) {
+        return t.total_len == 0;
+    }
+
+    /**
+     * @brief Key partitioning the packets on the flow identifier replicas: a marker goes to its replica,
+     *        the other packets are spread on all the replicas whatever their flow.
+     */
+    inline unsigned long flowid_key(const packet_t& t) {
+        if (is_marker(t)) return t.ip_src;
+        return flow::mix64(t.ts ^ ((uint64_t)t.ip_src << 32 | t.ip_dst));
+    }
+
+    /**
+     * @brief Marker of a flow identifier replica forwarded to the keyed stage (its key is the replica of the stage).
+     */
+    inline flow_len_t forward(const packet_t& t) {
+        flow_len_t m;
+        m.flow_key = t.ip_dst;
+        return m;
+    }
+
+    /**
+     * @brief Sends the markers of a source replica (called when its generation ends).
+     *
+     * @param shipper Source_Shipper object of the replica
+     * @param clock emission logic of the replica (the markers carry its last event timestamp)
+     */
+    inline void send(wf::Source_Shipper<packet_t>& shipper, event_time::Event_Clock& clock) {
+        for (std::size_t f = 0; f < plan.flowid; f++) {
+            for (std::size_t k = 0; k < std::max<std::size_t>(plan.keyed, 1); k++) {
+                packet_t m;
+                m.protocol = MARKER;
+                m.ip_src = f;
+                m.ip_dst = k;
+                clock.push_last(shipper, std::move(m));
+            }
+        }
+    }
+
+    /**
+     * @class Idle_Flush
+     * @brief Flush markers of an idle source replica (a hook of its pacer, see pacer::Source_Pacer::pace).
+     */
+    class Idle_Flush {
+    private:
+        wf::Source_Shipper<packet_t>& shipper;
+        event_time::Event_Clock& clock;
+        bool pending;                   // packets sent since the last flush
+        uint64_t since;                 // start of the current wait (0: not waiting)
+
+    public:
+        Idle_Flush(wf::Source_Shipper<packet_t>& _shipper, event_time::Event_Clock& _clock) :
+                shipper(_shipper), clock(_clock), pending(false), since(0) {}
+
+        /// called after each packet sent
+        void sent() {
+            pending = true;
+            since = 0;
+        }
+
+        /// called with the clock while the replica waits
+        void operator()(const uint64_t now) {
+            if (!pending || plan.idle_ns == 0) return;
+            if (since == 0) {
+                since = now;
+            } else if (now - since >= plan.idle_ns) {
+                for (std::size_t f = 0; f < plan.flowid; f++) {
+                    packet_t m;
+                    m.protocol = MARKER;
+                    m.port_dst = FLUSH;
+                    m.ip_src = f;
+                    clock.push_last(shipper, std::move(m));
+                }
+                pending = false;
+            }
+        }
+    };
+
+    /**
+     * @class Markers
+     * @brief Markers received by a replica of the keyed stage.
+     */
+    class Markers {
+    private:
+        std::size_t received = 0;
+
+    public:
+        /// counts a marker, true when it is the last one expected
+        bool last() {
+            return ++received == plan.expected();
+        }
+    };
+
+    /// results still held by a replica, handed to the sink
+    using emit_t = std::function<void(const hh_result_t&)>;
+    using drain_t = std::function<void(const emit_t&)>;
+
+    inline std::mutex drains_mutex;
+    inline std::vector<drain_t> drains;         // in the order of registration (first results of each replica)
+    inline std::atomic<std::size_t> ended_sinks{0};
+
+    /**
+     * @brief Registers the drain of a replica (called with its first input, the replica stays alive until the end of the run).
+     */
+    inline void at_end(drain_t drain) {
+        std::lock_guard<std::mutex> lock(drains_mutex);
+        drains.push_back(std::move(drain));
+    }
+
+    /**
+     * @brief Called by each sink replica at the end of its stream: the last one runs the drains.
+     *
+     * @param sinks parallelism of the sink
+     * @param emit receives the results of the drains
+     */
+    inline void sink_ended(const std::size_t sinks, const emit_t& emit) {
+        if (ended_sinks.fetch_add(1) + 1 != sinks) return;
+        std::lock_guard<std::mutex> lock(drains_mutex);
+        for (const auto& drain : drains) drain(emit);
+        drains.clear();
+    }
+}
+
+#endif //HH_EOS_HPP
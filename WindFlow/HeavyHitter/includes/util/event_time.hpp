@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    event_time.hpp
+ *
+ *  @brief Utility file defining the emission of tuples in event-time mode.
+ *
+ *  In event-time mode the windows are driven by the capture timestamps of the packets instead
+ *  of the time at which the source emits them, so that the content of each window (and thus the
+ *  heavy hitters detected) does not depend on the speed of the host. The tuple field ts keeps
+ *  the ingress time used for latency measurements, while the event timestamp is given to the
+ *  runtime with the tuple. Each source replica advances its own watermark, which trails the
+ *  largest timestamp emitted by the allowed lateness. When a trace is replayed more than once,
+ *  the timestamps of each generation are shifted after the end of the previous one, by the span of
+ *  the whole trace, so that the replicas replaying different shares of it stay aligned.
+ */
+
+#pragma once
+#ifndef HH_EVENT_TIME_HPP
+#define HH_EVENT_TIME_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <windflow.hpp>
+
+namespace event_time {
+
+    /**
+     * @class Event_Clock
+     * @brief Emission logic of a source replica (ingress time or event time).
+     */
+    class Event_Clock {
+    private:
+        bool enabled;               // emit the tuples with their capture timestamp
+        uint64_t lateness;          // allowed lateness (us) of the tuples with respect to the watermark
+        uint64_t span;              // duration (us) of the whole trace (0: span of the tuples of the replica)
+        uint64_t origin;            // capture timestamp (us) of the first tuple of the current generation
+        uint64_t max_ts;            // largest capture timestamp of the current generation
+        uint64_t gen_base;          // shift (us) applied to the timestamps of the current generation
+        uint64_t watermark;         // last watermark emitted
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _enabled true to emit the tuples in event time
+         * @param _lateness allowed lateness in microseconds
+         * @param _span duration (us) of the trace replayed by all the replicas (0 to measure it on the tuples of each replica)
+         */
+        explicit Event_Clock(const bool _enabled = false, const uint64_t _lateness = 0, const uint64_t _span = 0) :
+                enabled(_enabled), lateness(_lateness), span(_span), origin(0), max_ts(0), gen_base(0), watermark(0) {}
+
+        /**
+         * @brief Checks if the tuples are emitted in event time.
+         */
+        bool is_enabled() const {
+            return enabled;
+        }
+
+        /**
+         * @brief Gets the allowed lateness.
+         *
+         * @return lateness in microseconds
+         */
+        uint64_t get_lateness() const {
+            return lateness;
+        }
+
+        /**
+         * @brief Emits a tuple, with its event timestamp and the watermark of the replica in event-time mode.
+         *
+         * @param shipper Source_Shipper object of the replica
+         * @param t tuple to emit (its ts field holds the ingress time)
+         * @param capture_ts capture timestamp of the packet in microseconds
+         */
+        template<typename tuple_t>
+        inline void push(wf::Source_Shipper<tuple_t>& shipper, tuple_t&& t, const uint64_t capture_ts) {
+            if (!enabled) {
+                shipper.push(std::move(t));
+                return;
+            }
+            if (origin == 0) origin = capture_ts;
+            max_ts = std::max(max_ts, capture_ts);
+            const uint64_t ts = capture_ts + gen_base;
+            shipper.pushWithTimestamp(std::move(t), ts);
+
+            const uint64_t wm = max_ts + gen_base - std::min(max_ts + gen_base, lateness);
+            if (wm > watermark) {
+                watermark = wm;
+                shipper.setNextWatermark(watermark);
+            }
+        }
+
+        /**
+         * @brief Emits a tuple with the largest event timestamp of the replica (the end-of-stream markers, see eos.hpp).
+         *
+         * @param shipper Source_Shipper object of the replica
+         * @param t tuple to emit
+         */
+        template<typename tuple_t>
+        inline void push_last(wf::Source_Shipper<tuple_t>& shipper, tuple_t&& t) {
+            if (!enabled) {
+                shipper.push(std::move(t));
+                return;
+            }
+            shipper.pushWithTimestamp(std::move(t), max_ts + gen_base);
+        }
+
+        /**
+         * @brief Called by the replica when the trace is replayed again from the beginning.
+         */
+        void next_generation() {
+            if (enabled && origin != 0) {
+                gen_base += ((span > 0) ? span : max_ts - origin) + 1;     // the same shift in all the replicas
+                origin = 0;
+                max_ts = 0;
+            }
+        }
+    };
+}
+
+#endif //HH_EVENT_TIME_HPP
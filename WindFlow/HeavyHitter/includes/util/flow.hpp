@@ -35,50 +35,130 @@
  *  A flow is identified by its 5-tuple, which contains complete source and destination addresses, 
  *  source and destination ports, and the transport layer protocol identifier.
  *  A relaxed flow is only identified by the couple of values source and destination IP addresses.
+ *  Flows can also be defined on the source or on the destination address only.
+ *
+ *  Flow keys are computed with a multiply-xorshift mixer (the finalizer of MurmurHash3), so that
+ *  the two directions of a connection and adjacent addresses give unrelated keys, and the keys
+ *  are evenly spread over the replicas of the keyed operators. The mixer is branch-free and only
+ *  uses 64-bit multiplications and shifts, so the batch version is auto-vectorized, and the same
+ *  functions compute the keys in the GPU operators.
  */
 
 #pragma once
 #ifndef HH_FLOW_HPP
 #define HH_FLOW_HPP
 
-#include <tuple>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "util/device.hpp"
 
 namespace flow {
 
     /**
-     * @brief Flow definition.
-     * Flow fields are: source IP address, destination IP address, source port, destination port and protocol.
+     * @brief Flow definitions.
      */
-    typedef std::tuple<uint32_t, uint32_t, uint16_t, uint16_t, uint8_t> flow_t;
+    enum class flow_def_t {
+        TWO_TUPLE,      // source IP address, destination IP address (relaxed flow)
+        FIVE_TUPLE,     // source/destination IP address, source/destination port, protocol
+        SRC,            // source IP address
+        DST             // destination IP address
+    };
 
     /**
-     * @brief Hashing function defined for a flow tuple.
+     * @brief Parses the name of a flow definition (2tuple, 5tuple, src, dst).
+     *
+     * @param _name name of the flow definition
+     * @param _def parsed flow definition
+     * @return false if the name is not valid
      */
-    struct key_hash : public std::unary_function<flow_t, size_t> {
-        size_t operator()(const flow_t& k) const {
-            return std::get<0>(k) ^ std::get<1>(k) ^ std::get<2>(k) ^ std::get<3>(k) ^ std::get<4>(k);
-        }
-    };
+    inline bool parse_def(const std::string& _name, flow_def_t& _def) {
+        if (_name == "2tuple") _def = flow_def_t::TWO_TUPLE;
+        else if (_name == "5tuple") _def = flow_def_t::FIVE_TUPLE;
+        else if (_name == "src") _def = flow_def_t::SRC;
+        else if (_name == "dst") _def = flow_def_t::DST;
+        else return false;
+        return true;
+    }
 
-}
+    /**
+     * @brief Gets the name of a flow definition.
+     */
+    inline std::string def_to_string(const flow_def_t _def) {
+        switch (_def) {
+            case flow_def_t::FIVE_TUPLE: return "5-tuple";
+            case flow_def_t::SRC: return "source address";
+            case flow_def_t::DST: return "destination address";
+            default: return "2-tuple (source and destination address)";
+        }
+    }
 
-namespace relaxed_flow {
+    /**
+     * @brief 64-bit mixing function (MurmurHash3 finalizer).
+     */
+    HH_HD inline uint64_t mix64(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
 
     /**
-     * @brief RelaxedFlow definition.
-     * RelaxedFlow fields are: source IP address, destination IP address.
+     * @brief Computes the key of a flow (addresses and ports in network representation).
+     *
+     * @tparam def flow definition
      */
-    typedef std::tuple<uint32_t, uint32_t> relaxed_flow_t;
+    template<flow_def_t def>
+    HH_HD inline uint64_t key(const uint32_t ip_src, const uint32_t ip_dst, const uint16_t port_src, const uint16_t port_dst, const uint8_t protocol) {
+        if constexpr (def == flow_def_t::SRC) {
+            return mix64(ip_src);
+        } else if constexpr (def == flow_def_t::DST) {
+            return mix64((uint64_t)ip_dst << 32);
+        } else if constexpr (def == flow_def_t::TWO_TUPLE) {
+            return mix64((uint64_t)ip_src << 32 | ip_dst);
+        } else {
+            const uint64_t l4 = (uint64_t)port_src << 24 | (uint64_t)port_dst << 8 | protocol;
+            return mix64(((uint64_t)ip_src << 32 | ip_dst) ^ (l4 * 0x9e3779b97f4a7c15ULL));
+        }
+    }
 
     /**
-     * @brief Hashing function defined for a relaxed_flow tuple.
+     * @brief Calls a function with the flow definition selected at run time as a compile-time constant.
+     *
+     * The operators computing the flow keys are specialised on the flow definition: the selection is
+     * made once, when the topology is built, instead of at every packet.
+     *
+     * @param def flow definition
+     * @param f generic function receiving a std::integral_constant<flow_def_t, def>
      */
-    struct key_hash : public std::unary_function<relaxed_flow_t, size_t> {
-        size_t operator()(const relaxed_flow_t& k) const {
-            return std::get<0>(k) ^ std::get<1>(k);
+    template<typename F>
+    inline void with_def(const flow_def_t def, F&& f) {
+        switch (def) {
+            case flow_def_t::FIVE_TUPLE: f(std::integral_constant<flow_def_t, flow_def_t::FIVE_TUPLE>{}); break;
+            case flow_def_t::SRC: f(std::integral_constant<flow_def_t, flow_def_t::SRC>{}); break;
+            case flow_def_t::DST: f(std::integral_constant<flow_def_t, flow_def_t::DST>{}); break;
+            default: f(std::integral_constant<flow_def_t, flow_def_t::TWO_TUPLE>{}); break;
         }
-    };
+    }
 
+    /**
+     * @brief Computes the keys of a batch of packets (structure of arrays layout, vectorizable loop).
+     *
+     * @tparam def flow definition
+     * @param n number of packets
+     * @param keys output array of flow keys
+     */
+    template<flow_def_t def>
+    inline void key_batch(const std::size_t n, const uint32_t* __restrict ip_src, const uint32_t* __restrict ip_dst,
+                          const uint16_t* __restrict port_src, const uint16_t* __restrict port_dst,
+                          const uint8_t* __restrict protocol, uint64_t* __restrict keys) {
+        for (std::size_t i = 0; i < n; i++) {
+            keys[i] = key<def>(ip_src[i], ip_dst[i], port_src[i], port_dst[i], protocol[i]);
+        }
+    }
 }
 
 #endif //HH_FLOW_HPP
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    flow_table.hpp
+ *
+ *  @brief Flat open-addressing table of the per-flow state, with robin-hood probing and eviction of the idle flows.
+ *
+ *  The table is laid out as a structure of arrays: the probe sequence only reads the keys and the
+ *  probe distances, two dense arrays, and the state of a flow (last packet, addresses, window sum
+ *  and the byte counters of its panes) is only touched once its slot is found. Robin-hood insertion
+ *  keeps the probe distances short and even up to a high load, and deletions shift the following
+ *  entries back instead of leaving tombstones, so a table under flow churn does not degrade.
+ *  The capacity is a power of two, pre-sized from the expected number of flows.
+ */
+
+#pragma once
+#ifndef HH_FLOW_TABLE_HPP
+#define HH_FLOW_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "util/arena.hpp"
+
+namespace flow_table {
+
+    /**
+     * @class Flow_Table
+     * @brief Per-flow state of the windows (lanes byte counters per flow, one per pane).
+     */
+    class Flow_Table {
+    private:
+        static constexpr uint16_t EMPTY = 0;            // probe distance of an empty slot (the home slot has distance 1)
+        static constexpr uint16_t MAX_DIST = 0xffff;
+
+        std::size_t capacity;       // power of two (slot capacity is the scratch slot used to move the entries)
+        std::size_t mask;
+        unsigned shift;             // 64 - log2(capacity)
+        std::size_t lanes;
+        std::size_t used;
+        std::size_t peak;
+        uint64_t evicted;
+        uint16_t longest;           // longest probe distance so far
+
+        /// structure of arrays (capacity + 1 entries)
+        arena::vector<uint64_t> keys;
+        arena::vector<uint16_t> dist;
+        arena::vector<uint64_t> last_seen;  // slide of the last packet
+        arena::vector<uint64_t> ts;         // timestamp of the last packet
+        arena::vector<uint32_t> ip_src, ip_dst;
+        arena::vector<uint64_t> sum;        // bytes in the window
+        arena::vector<uint64_t> panes;      // lanes counters per slot
+
+        std::size_t home(const uint64_t key) const {
+            return (key * 0x9e3779b97f4a7c15ULL) >> shift;     // the keys of a keyed replica share their low bits
+        }
+
+        void allocate(const std::size_t _capacity) {
+            capacity = _capacity;
+            mask = capacity - 1;
+            shift = 64 - __builtin_ctzll(capacity);
+            keys.assign(capacity + 1, 0);
+            dist.assign(capacity + 1, EMPTY);
+            last_seen.assign(capacity + 1, 0);
+            ts.assign(capacity + 1, 0);
+            ip_src.assign(capacity + 1, 0);
+            ip_dst.assign(capacity + 1, 0);
+            sum.assign(capacity + 1, 0);
+            panes.assign((capacity + 1) * lanes, 0);
+        }
+
+        void swap_slots(const std::size_t a, const std::size_t b) {
+            std::swap(keys[a], keys[b]);
+            std::swap(dist[a], dist[b]);
+            std::swap(last_seen[a], last_seen[b]);
+            std::swap(ts[a], ts[b]);
+            std::swap(ip_src[a], ip_src[b]);
+            std::swap(ip_dst[a], ip_dst[b]);
+            std::swap(sum[a], sum[b]);
+            std::swap_ranges(panes.begin() + a * lanes, panes.begin() + (a + 1) * lanes, panes.begin() + b * lanes);
+        }
+
+        void move_slot(const std::size_t to, const std::size_t from) {
+            keys[to] = keys[from];
+            dist[to] = dist[from];
+            last_seen[to] = last_seen[from];
+            ts[to] = ts[from];
+            ip_src[to] = ip_src[from];
+            ip_dst[to] = ip_dst[from];
+            sum[to] = sum[from];
+            std::copy_n(panes.begin() + from * lanes, lanes, panes.begin() + to * lanes);
+        }
+
+        void clear_slot(const std::size_t i) {
+            dist[i] = EMPTY;
+            sum[i] = 0;
+            std::fill_n(panes.begin() + i * lanes, lanes, 0);
+        }
+
+        void grow() {
+            Flow_Table bigger(capacity * 2 * 3 / 4, lanes);     // same load, twice the slots
+            for (std::size_t i = 0; i < capacity; i++) {
+                if (dist[i] == EMPTY) continue;
+                const std::size_t j = bigger.insert(keys[i], last_seen[i]);
+                bigger.ts[j] = ts[i];
+                bigger.ip_src[j] = ip_src[i];
+                bigger.ip_dst[j] = ip_dst[i];
+                bigger.sum[j] = sum[i];
+                std::copy_n(panes.begin() + i * lanes, lanes, bigger.panes.begin() + j * lanes);
+            }
+            bigger.peak = std::max(peak, bigger.peak);
+            bigger.evicted = evicted;
+            *this = std::move(bigger);
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param expected expected number of flows (the table is sized to hold them at a load of at most 3/4)
+         * @param _lanes byte counters of each flow (panes of a window)
+         */
+        Flow_Table(const std::size_t expected, const std::size_t _lanes) :
+                lanes(std::max<std::size_t>(_lanes, 1)), used(0), peak(0), evicted(0), longest(0) {
+            std::size_t c = 16;
+            while (c * 3 < expected * 4) c <<= 1;
+            allocate(c);
+        }
+
+        /**
+         * @brief Finds the slot of a flow, inserting it if it is not in the table.
+         *
+         * The slot of a flow is valid until the next insertion or eviction.
+         *
+         * @param key flow key
+         * @param now slide of the packet
+         * @return slot of the flow
+         */
+        std::size_t insert(const uint64_t key, const uint64_t now) {
+            std::size_t i = home(key);
+            uint16_t d = 1;
+            for (;; i = (i + 1) & mask, d++) {     // the key is not in the table past an entry nearer to its home
+                if (dist[i] == EMPTY || dist[i] < d) break;
+                if (keys[i] == key) {
+                    last_seen[i] = now;
+                    return i;
+                }
+            }
+            if ((used + 1) * 8 > capacity * 7 || d == MAX_DIST) {     // load at most 7/8
+                grow();
+                return insert(key, now);
+            }
+            const std::size_t scratch = capacity;
+            const std::size_t slot = i;
+            clear_slot(scratch);
+            keys[scratch] = key;
+            dist[scratch] = d;
+            last_seen[scratch] = now;
+            ts[scratch] = 0;
+            ip_src[scratch] = ip_dst[scratch] = 0;
+            for (;; i = (i + 1) & mask) {           // robin hood: the new entry takes the slot, the displaced ones move on
+                if (dist[i] == EMPTY || dist[i] < dist[scratch]) {
+                    swap_slots(i, scratch);
+                    longest = std::max(longest, dist[i]);
+                    if (dist[scratch] == EMPTY) break;
+                }
+                dist[scratch]++;
+            }
+            used++;
+            peak = std::max(peak, used);
+            return slot;
+        }
+
+        /**
+         * @brief Removes the flow of a slot (the next entries of its cluster are shifted back).
+         *
+         * @param i slot
+         */
+        void erase(std::size_t i) {
+            for (std::size_t j = (i + 1) & mask; dist[j] > 1; i = j, j = (j + 1) & mask) {
+                move_slot(i, j);
+                dist[i]--;
+            }
+            clear_slot(i);
+            used--;
+        }
+
+        /**
+         * @brief Calls a function on every flow, erasing those for which it returns true.
+         *
+         * @param f function receiving the slot of a flow, returns true to evict it
+         */
+        template<typename F>
+        void sweep(F&& f) {
+            /// starting from an empty slot, the entries shifted back by an erase are never visited twice
+            std::size_t start = 0;
+            while (start < capacity && dist[start] != EMPTY) start++;
+            if (start == capacity) start = 0;       // only with a full table, which grow() prevents
+            std::size_t i = (start + 1) & mask;
+            for (std::size_t n = 0; n < capacity;) {
+                if (dist[i] != EMPTY && f(i)) {
+                    erase(i);
+                    evicted++;
+                    continue;                       // the slot now holds the next entry of the cluster (or is empty)
+                }
+                i = (i + 1) & mask;
+                n++;
+            }
+        }
+
+        /// state of a slot
+        uint64_t key(const std::size_t i) const { return keys[i]; }
+        uint64_t last(const std::size_t i) const { return last_seen[i]; }
+        uint64_t& timestamp(const std::size_t i) { return ts[i]; }
+        uint32_t& source(const std::size_t i) { return ip_src[i]; }
+        uint32_t& destination(const std::size_t i) { return ip_dst[i]; }
+        uint64_t& window(const std::size_t i) { return sum[i]; }
+        uint64_t& pane(const std::size_t i, const std::size_t p) { return panes[i * lanes + p]; }
+
+        /// load of the table
+        std::size_t size() const { return used; }
+        std::size_t slots() const { return capacity; }
+        std::size_t peak_size() const { return peak; }
+        uint64_t evictions() const { return evicted; }
+        uint16_t longest_probe() const { return longest; }
+        double load() const { return (double)used / capacity; }
+        std::size_t memory() const {
+            return (capacity + 1) * (sizeof(uint64_t) * (4 + lanes) + sizeof(uint16_t) + 2 * sizeof(uint32_t));
+        }
+    };
+}
+
+#endif //HH_FLOW_TABLE_HPP
@@ -43,14 +43,124 @@
 #include <string>
 #include <sstream>
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <set>
-#include <mutex>
-#include <atomic>
-#include "tuples/wf_tuple.hpp"
+#include <memory>
+#include <stdexcept>
+#include "tuples/hh_tuples.hpp"
+#include "util/arena.hpp"
+#include "util/prefix.hpp"
+#include "util/sampling.hpp"
+#include "util/flow.hpp"
+#include "util/trace.hpp"
 
 namespace hh_stats {
 
-    using hh_map = std::unordered_map<std::size_t, std::tuple<std::string, std::string, std::size_t>>;
+    /// results are hierarchical heavy hitters (the flow keys identify IP prefixes, see util/prefix.hpp)
+    inline bool prefix_results = false;
+
+    /**
+     * @class Results_Table
+     * @brief Flat open-addressing table (linear probing) of the heavy hitters, keyed by flow.
+     *
+     * The entries only hold binary values, so inserting a flow allocates nothing but the table growth:
+     * the addresses are converted to text form when the reports are written.
+     */
+    class Results_Table {
+    public:
+        /**
+         * Single entry of the table:
+         * - flow id key
+         * - IPv4 source and destination addresses (binary representation)
+         * - total bytes carried (this is the max byte sum experienced in a given window of time)
+         */
+        struct entry_t {
+            uint64_t flow_key;
+            uint64_t acc_len;
+            uint32_t ip_src, ip_dst;
+            uint64_t used;
+        };
+
+    private:
+        arena::vector<entry_t> entries;     // capacity is zero or a power of two
+        std::size_t used_entries;
+
+        void grow() {
+            arena::vector<entry_t> old(std::max<std::size_t>(entries.size() * 2, 1024), entry_t{0, 0, 0, 0, 0});
+            old.swap(entries);
+            used_entries = 0;
+            for (const auto& e : old) {
+                if (e.used) upsert(e.flow_key, e.ip_src, e.ip_dst, e.acc_len);
+            }
+        }
+
+    public:
+        Results_Table() : used_entries(0) {}
+
+        /// outcome of an upsert
+        enum class upsert_t { UNCHANGED, INSERTED, RAISED };
+
+        /**
+         * @brief Inserts a flow, or updates its byte sum if the new one is higher than the one saved.
+         *
+         * @return whether the flow is new, its byte sum has been raised, or nothing changed
+         */
+        upsert_t upsert(const uint64_t key, const uint32_t ip_src, const uint32_t ip_dst, const uint64_t acc_len) {
+            if ((used_entries + 1) * 4 > entries.size() * 3) grow();      // load factor at most 0.75
+            const std::size_t mask = entries.size() - 1;
+            for (std::size_t i = flow::mix64(key) & mask;; i = (i + 1) & mask) {
+                entry_t& e = entries[i];
+                if (!e.used) {
+                    e = entry_t{key, acc_len, ip_src, ip_dst, 1};
+                    used_entries++;
+                    return upsert_t::INSERTED;
+                }
+                if (e.flow_key == key) {
+                    if (e.acc_len >= acc_len) return upsert_t::UNCHANGED;
+                    e.acc_len = acc_len;
+                    return upsert_t::RAISED;
+                }
+            }
+        }
+
+        /**
+         * @brief Merges the entries of another table into this one.
+         */
+        void merge(const Results_Table& other) {
+            for (const auto& e : other.entries) {
+                if (e.used) upsert(e.flow_key, e.ip_src, e.ip_dst, e.acc_len);
+            }
+        }
+
+        template<typename F>
+        void for_each(F&& f) const {
+            for (const auto& e : entries) {
+                if (e.used) f(e);
+            }
+        }
+
+        std::size_t size() const {
+            return used_entries;
+        }
+
+        /// bytes held by the table
+        std::size_t memory() const {
+            return entries.capacity() * sizeof(entry_t);
+        }
+
+        bool empty() const {
+            return used_entries == 0;
+        }
+    };
+
+    /**
+     * @brief Text form of an address of a result (the prefix, or * for the other address of a prefix result).
+     */
+    inline std::string to_string(const Results_Table::entry_t& e, const prefix::dim_t d) {
+        if (prefix_results) return (prefix::dim(e.flow_key) == d) ? prefix::to_string(e.flow_key) : "*";
+        return wf_tuple_t::addr_to_string(e.ip_src, e.ip_dst, (d == prefix::dim_t::SRC) ? 0 : 1);
+    }
 
     /**
      * @class Result_Collector
@@ -61,13 +171,7 @@ namespace hh_stats {
      */
     class Results_Collector {
     private:
-        /**
-         * Structure of a single entry in the heavy_hitters map:
-         * - key: flow id key
-         * - value: IPv4 source address (string repr.), IPv4 destination address (string repr.), total bytes carried
-         *  (this is the max byte sum experienced in a given window of time)
-         */
-        hh_map heavy_hitters;
+        Results_Table heavy_hitters;
         std::size_t sink_id;
 
     public:
@@ -98,22 +202,10 @@ namespace hh_stats {
          * @brief Updates the internal collection of results for this sink replica.
          *
          * @param result_tuple a new result tuple from the detector operator
+         * @return whether the flow is a new heavy hitter, its peak has been raised, or nothing changed
          */
-        void update(const wf_tuple_t& result_tuple) {
-            if (heavy_hitters.find(result_tuple.flow_key) == heavy_hitters.end()) {     // create new entry (new flow!)
-                heavy_hitters.insert(
-                        std::make_pair(result_tuple.flow_key,
-                                       std::make_tuple(
-                                               result_tuple.local_addr_to_string(0),    // IPv4 source address
-                                               result_tuple.local_addr_to_string(1),    // IPv4 destination address
-                                               result_tuple.acc_len)
-                        ));
-            } else {   // existing entry found (known flow)
-                /// update byte sum if the new one computed is higher than the one saved
-                if (std::get<2>(heavy_hitters.at(result_tuple.flow_key)) < result_tuple.acc_len) {
-                    std::get<2>(heavy_hitters.at(result_tuple.flow_key)) = result_tuple.acc_len;
-                }
-            }
+        Results_Table::upsert_t update(const hh_result_t& result_tuple) {
+            return heavy_hitters.upsert(result_tuple.flow_key, result_tuple.ip_src, result_tuple.ip_dst, result_tuple.acc_len);
         }
 
         /**
@@ -121,16 +213,29 @@ namespace hh_stats {
          *
          * @return result collection size
          */
-        std::size_t get_collection_size() {
+        std::size_t get_collection_size() const {
             return heavy_hitters.size();
         }
 
+        /**
+         * @brief Gets the bytes held by the result collection.
+         *
+         * @return result collection memory (bytes)
+         */
+        std::size_t get_collection_memory() const {
+            return heavy_hitters.memory();
+        }
+
         /**
          * @brief Gets the result collection.
          *
          * @return result collection
          */
-         hh_map get_collection() {
+        const Results_Table& get_collection() const {
+            return heavy_hitters;
+        }
+
+        Results_Table& get_collection() {
             return heavy_hitters;
         }
 
@@ -139,7 +244,7 @@ namespace hh_stats {
          *
          * @return result collection size
          */
-        std::size_t dump_sink_results() {
+        std::size_t dump_sink_results() const {
             if (heavy_hitters.empty()) {
                 std::cout << "[Results_Collector] no heavy hitters found." << std::endl;
                 return 0;
@@ -150,12 +255,16 @@ namespace hh_stats {
             out_file << "report_sink" << sink_id << ".txt";
             std::ofstream out(out_file.str());
             out << "[Sink" << sink_id << "-REPORT]" << std::endl;
-            for (const auto& res_item : heavy_hitters) {
-                out << std::get<1>(res_item.second)   // ipv4 dst address
-                    << " from " << std::get<0>(res_item.second)   // ipv4 src address
-                    << " : max peak " << std::get<2>(res_item.second)  // total bytes
-                    << " exchanged bytes" << std::endl;
-            }
+            heavy_hitters.for_each([&out](const Results_Table::entry_t& e) {
+                out << to_string(e, prefix::dim_t::DST)      // ipv4 dst address
+                    << " from " << to_string(e, prefix::dim_t::SRC)      // ipv4 src address
+                    << " : max peak " << e.acc_len      // total bytes
+                    << " exchanged bytes";
+                if (sampling::spec.mode == sampling::mode_t::PACKET) {     // scaled estimate
+                    out << " (estimated, +/-" << (uint64_t)sampling::outcome.bound(e.acc_len) << " bytes at 95%)";
+                }
+                out << '\n';
+            });
             out.close();
 
             return get_collection_size();
@@ -177,43 +286,46 @@ namespace hh_stats {
      */
     class Results_Aggregator {
     private:
-        std::size_t sink_replicas;                  // sink parallelism degree
-        std::vector<Results_Collector> aggregator;  // aggregator of all the collected heavy hitter results
-        std::atomic_size_t sink_zero_processed;     // number of sink's replicas that processed zero tuples
-        std::mutex m;                               // mutex
-        hh_map aggregated_hh_results;               // map containing all the heavy hitter results
-        std::set<std::string> hh_hosts;             // set containing the targeted hosts (no duplicates)
+        std::vector<std::unique_ptr<Results_Collector>> slots;  // collector of each sink replica (empty if it processed zero tuples)
+        std::vector<Results_Collector*> aggregator;             // collectors of the sinks with results (filled by the dumps)
+        Results_Table* aggregated_hh_results;                   // table containing all the heavy hitter results (the largest collector table)
+        std::set<std::string> hh_hosts;                         // set containing the targeted hosts (no duplicates)
+
+        void collect() {
+            aggregator.clear();
+            for (auto& s : slots) {
+                if (s) aggregator.push_back(s.get());
+            }
+        }
 
     public:
         /**
          * @brief Default constructor.
          */
-        Results_Aggregator() : sink_replicas(0), sink_zero_processed(0) {}
+        Results_Aggregator() : aggregated_hh_results(nullptr) {}
 
         /**
-         * @brief Set the number of sink replicas in the topology.
+         * @brief Set the number of sink replicas in the topology (before it runs).
          *
          * @param _sink_replicas the number of sink replicas
          */
         void set_sink_replicas(const std::size_t& _sink_replicas) {
-            sink_replicas = _sink_replicas;
-        }
-
-        /**
-         * @brief Increments the number of sink replicas which processed zero tuples.
-         */
-        void add_empty_sink() {
-            sink_zero_processed.fetch_add(1);
+            slots.clear();
+            slots.resize(_sink_replicas);
         }
 
         /**
          * @brief Adds the Results_Collector related to a sink replica.
          *
+         * Each replica writes its own slot, so no synchronization is needed among the sinks.
+         *
+         * @param sink index of the sink replica
          * @param rc the results collector of a sink
          */
-        void add_res_collector(Results_Collector&& rc) {
-            std::unique_lock<std::mutex> lock(m);
-            aggregator.emplace_back(std::move(rc));
+        void add_res_collector(const std::size_t sink, Results_Collector&& rc) {
+            if (sink >= slots.size())
+                throw std::out_of_range("[Results_Aggregator] ERR: sink replica " + std::to_string(sink) + " out of range");
+            slots[sink] = std::make_unique<Results_Collector>(std::move(rc));
         }
 
         /**
@@ -221,8 +333,17 @@ namespace hh_stats {
          *
          * @return the number of sink replicas with heavy hitter results
          */
-        std::size_t get_hh_sinks() {
-            return sink_replicas - sink_zero_processed;
+        std::size_t get_hh_sinks() const {
+            return std::count_if(slots.begin(), slots.end(), [](const auto& s) { return s != nullptr; });
+        }
+
+        /**
+         * @brief Gets the table of all the heavy hitter results (valid after dump_aggregated()).
+         *
+         * @return merged table, or nullptr if there are no results
+         */
+        const Results_Table* get_aggregated() const {
+            return aggregated_hh_results;
         }
 
         /**
@@ -231,20 +352,17 @@ namespace hh_stats {
          * @return the number of hh sinks
          */
         std::size_t dump_per_sink() {
-#ifdef DEBUG_PRINT_METRIC
-            std::cout << "[Aggregator] dumping heavy hitter results from " << get_hh_sinks() << " sinks..." << std::endl;
-#endif
+            if (trace::debug()) {
+                std::cout << "[Aggregator] dumping heavy hitter results from " << get_hh_sinks() << " sinks..." << std::endl;
+            }
+            collect();
             if (aggregator.empty()) {
                 std::cout << "[Aggregator] no heavy hitter results available." << std::endl;
                 return 0;
             }
 
-            if (aggregator.size() == (sink_replicas - sink_zero_processed)) {
-                for (auto& coll: aggregator) {
-                    coll.dump_sink_results();
-                }
-            } else {
-                std::cout << "[Aggregator] waiting for some sink replica to terminate." << std::endl;
+            for (auto* coll: aggregator) {
+                coll->dump_sink_results();
             }
 
             return get_hh_sinks();
@@ -256,32 +374,38 @@ namespace hh_stats {
          * @return the global number of heavy hitters (no duplicates)
          */
         std::size_t dump_aggregated() {
-#ifdef DEBUG_PRINT_METRIC
-            std::cout << "[Aggregator] dumping heavy hitter aggregated results for " << get_hh_sinks() << " sinks..." << std::endl;
-#endif
+            if (trace::debug()) {
+                std::cout << "[Aggregator] dumping heavy hitter aggregated results for " << get_hh_sinks() << " sinks..." << std::endl;
+            }
+            collect();
             if (aggregator.empty()) {
                 std::cout << "[Aggregator] no heavy hitter results available." << std::endl;
                 return 0;
             }
 
-            // there will be no duplicated flows after the merge in the aggregated_hh_results map
-            if (aggregator.size() == (sink_replicas - sink_zero_processed)) {
-                for (auto& coll: aggregator) {
-                    aggregated_hh_results.merge(coll.get_collection());     // heavy hitter items are moved into the aggregated map
-                }
-            } else {
-                std::cout << "[Aggregator] waiting for some sink replica to terminate." << std::endl;
+            // there will be no duplicated flows after the merge in the aggregated_hh_results table:
+            // the other tables are merged in place into the largest one (the collectors are not copied)
+            auto largest = std::max_element(aggregator.begin(), aggregator.end(), [](const Results_Collector* a, const Results_Collector* b) {
+                return a->get_collection_size() < b->get_collection_size();
+            });
+            aggregated_hh_results = &(*largest)->get_collection();
+            for (auto it = aggregator.begin(); it != aggregator.end(); it++) {
+                if (it != largest) aggregated_hh_results->merge((*it)->get_collection());
             }
 
             // however, since we simply print a list of destination hosts, there can be duplicated hosts if, for example,
             // the same destination address is targeted by more heavy hitter flows (same destination but several sources starting different flows)
-            for (const auto& res_item : aggregated_hh_results) {
-                hh_hosts.insert(std::get<1>(res_item.second));          // duplicated hosts are removed in the set
-            }
+            // (the hosts are compared in text form: the address fields of an IPv6 flow hold the hash of its pair, see ip6::hash)
+            // prefix results are formatted in the dimension of their own hierarchy (-H src lists source prefixes)
+            prefix::dim_t dim = prefix::dim_t::DST;
+            aggregated_hh_results->for_each([this, &dim](const Results_Table::entry_t& e) {
+                if (prefix_results) dim = prefix::dim(e.flow_key);
+                hh_hosts.insert(to_string(e, dim));     // duplicated hosts are removed in the set
+            });
 
             // write global heavy hitter summary to output file (with no duplicates)
             std::ofstream out("heavy_hitters.txt");
-            out << "[Heavy Hitters - GLOBAL REPORT]\nList of destination hosts targeted:\n";
+            out << "[Heavy Hitters - GLOBAL REPORT]\nList of " << ((dim == prefix::dim_t::SRC) ? "source prefixes" : "destination hosts targeted") << ":\n";
             for (const auto& host : hh_hosts) {
                 out << host << std::endl;
             }
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    histogram.hpp
+ *
+ *  @brief Fixed-size log-linear histogram of latency values (HDR-style).
+ *
+ *  The values (nanoseconds) are counted in buckets whose width doubles with every power of two,
+ *  each power of two being split in 64 linear sub-buckets: recording a value is O(1) and the
+ *  relative error of the percentiles is below 1/64 (1.6%), over the range from 1 ns to about 73
+ *  minutes. The min, max and mean values are exact. Histograms are merged by adding the counts,
+ *  so the percentiles of the merged histogram are those of the union of the recorded values.
+ */
+
+#pragma once
+#ifndef HH_HISTOGRAM_HPP
+#define HH_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace metrics {
+
+    /**
+     * @class Histogram
+     * @brief Log-linear histogram of non-negative integer values.
+     */
+    class Histogram {
+    private:
+        static constexpr unsigned SUB_BITS = 7;                     // values below 2^SUB_BITS are counted exactly
+        static constexpr uint64_t HALF = 1ULL << (SUB_BITS - 1);    // linear sub-buckets per power of two
+        static constexpr unsigned MAX_EXP = 41;                     // largest power of two (larger values are clamped)
+        static constexpr std::size_t BUCKETS = (MAX_EXP - SUB_BITS + 3) * HALF;
+
+        std::array<uint64_t, BUCKETS> counts;
+        uint64_t total;
+        uint64_t min_value, max_value;
+        long double sum;
+
+        static std::size_t index_of(uint64_t v) {
+            if (v < 2 * HALF) return v;
+            const unsigned e = std::min<unsigned>(63 - __builtin_clzll(v), MAX_EXP);
+            if (e == MAX_EXP) v = (1ULL << (MAX_EXP + 1)) - 1;
+            return (e - SUB_BITS + 2) * HALF + ((v >> (e - SUB_BITS + 1)) - HALF);
+        }
+
+        /// central value of a bucket
+        static double value_of(const std::size_t idx) {
+            if (idx < 2 * HALF) return (double)idx;
+            const unsigned e = idx / HALF + SUB_BITS - 2;
+            const uint64_t low = (HALF + idx % HALF) << (e - SUB_BITS + 1);
+            return (double)low + (double)(1ULL << (e - SUB_BITS + 1)) / 2.0;
+        }
+
+    public:
+        Histogram() : total(0), min_value(UINT64_MAX), max_value(0), sum(0) {
+            counts.fill(0);
+        }
+
+        /// records a value
+        void record(const uint64_t v) {
+            counts[index_of(v)]++;
+            total++;
+            sum += v;
+            if (v < min_value) min_value = v;
+            if (v > max_value) max_value = v;
+        }
+
+        /// adds the values recorded in another histogram
+        void merge(const Histogram& other) {
+            for (std::size_t i = 0; i < BUCKETS; i++) counts[i] += other.counts[i];
+            total += other.total;
+            sum += other.sum;
+            min_value = std::min(min_value, other.min_value);
+            max_value = std::max(max_value, other.max_value);
+        }
+
+        /**
+         * @brief Gets a percentile of the recorded values.
+         *
+         * @param p percentile (between 0 and 1)
+         * @return value below which a fraction p of the values fall
+         */
+        double percentile(const double p) const {
+            if (total == 0) return 0;
+            const uint64_t rank = std::max<uint64_t>((uint64_t)std::ceil(p * (double)total), 1);
+            uint64_t seen = 0;
+            for (std::size_t i = 0; i < BUCKETS; i++) {
+                seen += counts[i];
+                if (seen >= rank) return std::clamp(value_of(i), (double)min_value, (double)max_value);
+            }
+            return (double)max_value;
+        }
+
+        /// writes the histogram to an encoder (only the non-empty buckets, see cluster::Writer)
+        template<typename W>
+        void encode(W& w) const {
+            w.u64(total);
+            w.u64(min_value);
+            w.u64(max_value);
+            w.f64((double)sum);
+            w.u32((uint32_t)std::count_if(counts.begin(), counts.end(), [](const uint64_t c) { return c > 0; }));
+            for (std::size_t i = 0; i < BUCKETS; i++) {
+                if (counts[i] == 0) continue;
+                w.u32((uint32_t)i);
+                w.u64(counts[i]);
+            }
+        }
+
+        /// reads a histogram written by encode (see cluster::Reader)
+        template<typename R>
+        void decode(R& r) {
+            counts.fill(0);
+            total = r.u64();
+            min_value = r.u64();
+            max_value = r.u64();
+            sum = r.f64();
+            for (uint32_t n = r.u32(); n > 0; n--) {
+                const uint32_t i = r.u32();
+                const uint64_t c = r.u64();
+                if (i < BUCKETS) counts[i] = c;
+            }
+        }
+
+        uint64_t count() const {
+            return total;
+        }
+
+        double mean() const {
+            return (total == 0) ? 0 : (double)(sum / total);
+        }
+
+        uint64_t min() const {
+            return (total == 0) ? 0 : min_value;
+        }
+
+        uint64_t max() const {
+            return max_value;
+        }
+    };
+}
+
+#endif //HH_HISTOGRAM_HPP
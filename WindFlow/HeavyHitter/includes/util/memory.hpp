@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    memory.hpp
+ *
+ *  @brief Memory footprint of the run: resident set size of the process and bytes held by its main structures.
+ *
+ *  The structures shared by the whole run (the dataset, the latency histograms) are charged to named
+ *  accounts, while the per-replica state of the stateful operators is published in the registry
+ *  (state_bytes and live_flows), so that the live reporter can follow it during the run. The sizes of
+ *  the hash maps are estimates: their nodes and buckets, without the overhead of the allocator.
+ */
+
+#pragma once
+#ifndef HH_MEMORY_HPP
+#define HH_MEMORY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <vector>
+#include "util/registry.hpp"
+
+namespace memory {
+
+    /// resident set size of the process (bytes)
+    inline uint64_t rss_bytes() {
+        std::ifstream statm("/proc/self/statm");
+        uint64_t pages = 0, resident = 0;
+        if (!(statm >> pages >> resident)) return 0;
+        return resident * (uint64_t)sysconf(_SC_PAGESIZE);
+    }
+
+    /// peak resident set size of the process (bytes)
+    inline uint64_t peak_rss_bytes() {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+        return (uint64_t)usage.ru_maxrss * 1024;
+    }
+
+    /// bytes held by a vector
+    template<typename T, typename A>
+    std::size_t bytes_of(const std::vector<T, A>& v) {
+        return v.capacity() * sizeof(T);
+    }
+
+    /// estimated bytes held by an unordered map (a node per entry, with its next pointer and cached hash, and the buckets)
+    template<typename Map>
+    std::size_t bytes_of_map(const Map& m) {
+        return m.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*)) + m.bucket_count() * sizeof(void*);
+    }
+
+    /**
+     * @class Accounts
+     * @brief Bytes held by the structures shared by the whole run, by name.
+     */
+    class Accounts {
+    public:
+        struct account_t {
+            std::string name;
+            std::atomic<uint64_t> bytes;
+
+            explicit account_t(const std::string& _name) : name(_name), bytes(0) {}
+        };
+
+    private:
+        std::deque<account_t> items;        // stable addresses
+        mutable std::mutex m;
+
+    public:
+        /// sets the bytes of an account (created on its first use)
+        void set(const std::string& name, const uint64_t bytes) {
+            std::lock_guard<std::mutex> lock(m);
+            for (auto& a : items) {
+                if (a.name == name) {
+                    a.bytes.store(bytes, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            items.emplace_back(name);
+            items.back().bytes.store(bytes, std::memory_order_relaxed);
+        }
+
+        /// accounts, in the order of their creation
+        std::vector<std::pair<std::string, uint64_t>> list() const {
+            std::lock_guard<std::mutex> lock(m);
+            std::vector<std::pair<std::string, uint64_t>> v;
+            for (const auto& a : items) v.emplace_back(a.name, a.bytes.load(std::memory_order_relaxed));
+            return v;
+        }
+    };
+
+    /// accounts of the run
+    inline Accounts accounts;
+
+    /// total bytes held by the state of the stateful replicas
+    inline uint64_t state_bytes(const metrics::Registry& reg) {
+        uint64_t bytes = 0;
+        for (const metrics::Replica_Stats* s : reg.list()) bytes += s->state_bytes.get();
+        return bytes;
+    }
+
+    /**
+     * @brief Writes the memory footprint of the run (the state of each replica is in the operator summary).
+     *
+     * @param out output stream
+     * @param reg registry of the counters
+     */
+    inline void write_summary(std::ostream& out, const metrics::Registry& reg) {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+        const uint64_t rss = rss_bytes();
+        out << "[MEMORY] peak RSS: " << std::max(peak_rss_bytes(), rss) / 1048576.0 << " MB (" << rss / 1048576.0 << " MB at the end of the run)\n";
+        for (const auto& a : accounts.list()) out << "[MEMORY] " << a.first << ": " << a.second / 1048576.0 << " MB\n";
+        out << "[MEMORY] state of the operators: " << state_bytes(reg) / 1048576.0 << " MB\n";
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif //HH_MEMORY_HPP
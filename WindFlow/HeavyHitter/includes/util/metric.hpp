@@ -37,90 +37,69 @@
 #ifndef HH_METRIC_HPP
 #define HH_METRIC_HPP
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <sstream>
-#include <util/alglib/src/statistics.h>
-#include <mutex>
-#include <atomic>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include "util/histogram.hpp"
+#include "util/registry.hpp"
+#include "util/steady_state.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
 
 namespace metrics {
 
     /**
-     * @class Atomic_Double
-     * @brief Class implementing atomic fetch and add operation on a double.
+     * @brief Writes the latency statistics of a histogram.
      *
-     * The class is used to evaluate the average execution time (milliseconds) of source and sink operators.
-     * All the replicas of the source node update an Atomic_Double value by adding the execution time of the
-     * replica. At the end, an average of all these values is computed to extract the operator bandwidth.
-     * All the replicas of the sink node do the same.
+     * @param out output stream
+     * @param h latency histogram (nanoseconds)
      */
-    class Atomic_Double {
-    private:
-        double value;           // sum of the execution time values measured in each of the operator's replicas
-        std::mutex m;           // mutex
-
-    public:
-        /**
-         * @brief Default constructor.
-         */
-        Atomic_Double() : value(0) {}
-
-        /**
-         * @brief Implements atomic fetch and add operation on the internal state.
-         *
-         * @param _value new value to be added atomically
-         * @return old state value
-         */
-        double fetch_add(double _value) {
-            std::unique_lock<std::mutex> lock(m);
-            double old_value = value;
-            value = value + _value;
-
-            return old_value;
-        }
-
-        double get() {
-            std::unique_lock<std::mutex> lock(m);
-            return value;
-        }
-
-        /**
-         * @brief Destructor.
-         */
-        ~Atomic_Double() = default;
-    };
+    inline void write_latency_statistics(std::ostream& out, const Histogram& h) {
+        const double ms = 1000000.0;
+        out << h.mean() / ms << " (mean) "
+            << h.min() / ms << " (min) "
+            << h.percentile(0.05) / ms << " (5th) "
+            << h.percentile(0.25) / ms << " (25th) "
+            << h.percentile(0.5) / ms << " (50th) "
+            << h.percentile(0.75) / ms << " (75th) "
+            << h.percentile(0.95) / ms << " (95th) "
+            << h.percentile(0.99) / ms << " (99th) "
+            << h.percentile(0.999) / ms << " (99.9th) "
+            << h.max() / ms << " (max)";
+    }
 
     /**
      * @class Metrics_Collector
-     * @brief Class maintaining a collection of the tuples sampled in a single sink replica for evaluating latency.
+     * @brief Class maintaining the latency histogram of the tuples received by a single sink replica.
      *
      * An object of type Metrics_Collector is updated by each of the sink replicas.
-     * Metrics are then evaluated and aggregated in the Results_Aggregator object.
+     * Metrics are then evaluated and aggregated in the Metrics_Aggregator object.
      *
      * NOTE: to have accurate values for evaluating latency ypu need to compile with FF_BOUNDED_BUFFER MACRO set
      */
     class Metrics_Collector {
     private:
-        std::vector<double> tuple_latencies;
+        Histogram tuple_latencies;      // latency of the received tuples carrying a latency marker (nanoseconds)
         std::size_t sink_id;
-        long tuples;
-        long samples;
 
     public:
         /**
          * @brief Default constructor.
          */
-        Metrics_Collector() : sink_id(0), tuples(0), samples(0) {}
+        Metrics_Collector() : sink_id(0) {}
 
         /**
          * @brief Gets ID of the sink replica.
          *
          * @return sink ID
          */
-        std::size_t get_sink() {
+        std::size_t get_sink() const {
             return sink_id;
         }
 
@@ -134,30 +113,37 @@ namespace metrics {
         }
 
         /**
-         * @brief Moves the vector of samples gathered from a sink replica to the internal collection.
+         * @brief Records the latency of a marked tuple received by this sink replica (see tsc::Stamper).
          *
-         * @param tuple_latencies the vector of latency values in milliseconds
+         * Only the tuples generated in the measurement interval are kept in the histogram.
+         *
+         * @param _tuple a new tuple received by the sink (its ts field holds the generation time)
+         * @return latency of the tuple (nanoseconds)
          */
-        void add(std::vector<double>&& _tuple_latencies) {
-             tuple_latencies = std::move(_tuple_latencies);
-#ifdef DEBUG_PRINT_METRIC
-             std::cout << "[Collector_Sink" << sink_id << "] stored " << tuple_latencies.size() << " samples." << std::endl;
-#endif
+        template<typename tuple_t>
+        uint64_t update(const tuple_t& _tuple) {
+            const uint64_t now = tsc::now();
+            const uint64_t latency = (now > _tuple.ts) ? now - _tuple.ts : 0;    // nanoseconds
+            if (measure::contains(_tuple.ts)) tuple_latencies.record(latency);
+            return latency;
         }
 
         /**
-         * @brief Updates the internal collection of latency samples for this sink replica.
+         * @brief Gets the latency histogram of this sink replica.
          *
-         * @param result_tuple a new result tuple from the detector operator
+         * @return latency histogram (nanoseconds)
          */
-        void update(const wf_tuple_t& _tuple) {
-            /// sample 1M tuples for computing latency statistics
-            if ((tuples % 16) == 0 && samples < 1000000) {
-                unsigned long tuple_latency = wf::current_time_nsecs() - _tuple.ts;  // nanoseconds
-                tuple_latencies.insert(tuple_latencies.end(), ((double) tuple_latency / 1000000L)); // milliseconds
-                samples++;
-            }
-            tuples++;
+        const Histogram& get_histogram() const {
+            return tuple_latencies;
+        }
+
+        /**
+         * @brief Adds the latencies recorded by the sinks of another node (multi-node runs).
+         *
+         * @param h latency histogram (nanoseconds)
+         */
+        void merge(const Histogram& h) {
+            tuple_latencies.merge(h);
         }
 
         /**
@@ -165,65 +151,28 @@ namespace metrics {
          *
          * @return mean latency value
          *
-         * Evaluate latency statistics:
+         * Evaluate latency statistics (milliseconds):
          * - mean value (average time needed by a tuple in order to traverse the whole pipeline),
-         * - 5th, 25th, 50th, 75th, 95th percentiles,
+         * - 5th, 25th, 50th, 75th, 95th, 99th, 99.9th percentiles,
          * - minimum value,
          * - maximum value.
          */
-        double compute_latency_statistics() {
-            if (tuple_latencies.empty()) {
+        double compute_latency_statistics() const {
+            if (tuple_latencies.count() == 0) {
                 std::cout << "[Metrics_Collector] no latency statistics available." << std::endl;
                 return 0;
             }
 
-            /// vector containing all latency values
-            alglib::real_1d_array tuple_lat_array;
-            tuple_lat_array.setcontent(tuple_latencies.size(), &(tuple_latencies.at(0)));
-
-            /// percentiles
-            double perc_5 = 0.05;
-            double perc_25 = 0.25;
-            double perc_50 = 0.5;
-            double perc_75 = 0.75;
-            double perc_95 = 0.95;
-
-            /// statistics
-            double mean;
-            double min;
-            double perc_5_val;
-            double perc_25_val;
-            double perc_50_val;
-            double perc_75_val;
-            double perc_95_val;
-            double max;
-
-            /// statistics computation
-            mean = alglib::samplemean(tuple_lat_array);
-            alglib::samplepercentile(tuple_lat_array, perc_5, perc_5_val);
-            alglib::samplepercentile(tuple_lat_array, perc_25, perc_25_val);
-            alglib::samplepercentile(tuple_lat_array, perc_50, perc_50_val);
-            alglib::samplepercentile(tuple_lat_array, perc_75, perc_75_val);
-            alglib::samplepercentile(tuple_lat_array, perc_95, perc_95_val);
-            min = *min_element(tuple_latencies.begin(), tuple_latencies.end());
-            max = *max_element(tuple_latencies.begin(), tuple_latencies.end());
-
             /// write latency summary to output file
             std::stringstream out_file;
             out_file << "latency_sink" << sink_id << ".txt";
             std::ofstream out(out_file.str());
-            out << "[Sink" << sink_id << "] latency (ms): "
-                  << mean << " (mean) "
-                  << min << " (min) "
-                  << perc_5_val << " (5th) "
-                  << perc_25_val << " (25th) "
-                  << perc_50_val << " (50th) "
-                  << perc_75_val << " (75th) "
-                  << perc_95_val << " (95th) "
-                  << max << " (max)." << std::endl;
+            out << "[Sink" << sink_id << "] latency (ms): ";
+            write_latency_statistics(out, tuple_latencies);
+            out << "." << std::endl;
             out.close();
 
-            return mean;
+            return tuple_latencies.mean() / 1000000.0;
         }
 
         /**
@@ -234,60 +183,64 @@ namespace metrics {
 
     /**
      * @class Metrics_Aggregator
-     * @brief Class aggregating the collected latency samples from all the sink replicas.
+     * @brief Class aggregating the latency histograms of all the sink replicas.
      *
-     * There is a single Results_Aggregator object for the entire application. It collects all the Metrics_Collector
-     * objects from the sink replicas and then evaluates the latency statistics for the entire topology.
-     * Detailed reports are exported as files for each replica, while the average latency value is returned to the caller
-     * of the dump() method.
+     * There is a single Metrics_Aggregator object for the entire application. It collects all the Metrics_Collector
+     * objects from the sink replicas and then evaluates the latency statistics for the entire topology, by merging
+     * their histograms. Detailed reports are exported as files for each replica and for the whole topology, while
+     * the global average latency value is returned to the caller of the dump() method.
      */
     class Metrics_Aggregator {
     private:
-        std::size_t sink_replicas;                  // sink parallelism degree
-        std::vector<Metrics_Collector> aggregator;  // aggregator of all the collected latency samples
-        std::atomic_size_t sink_zero_processed;     // number of sink's replicas that processed zero tuples
-        std::mutex m;                               // mutex
-        double average_latency_sum;                 // sum of the average latency values measured in each of the sink's replicas
+        std::vector<std::unique_ptr<Metrics_Collector>> slots;  // collector of each sink replica (empty if it processed zero tuples)
+        Histogram global_latencies;                             // latency of all the marked tuples received by the sinks
 
     public:
         /**
          * @brief Default constructor.
          */
-        Metrics_Aggregator() : sink_replicas(0), sink_zero_processed(0), average_latency_sum(0) {}
+        Metrics_Aggregator() = default;
 
         /**
-         * @brief Set the number of sink replicas in the topology.
+         * @brief Set the number of sink replicas in the topology (before it runs).
          *
          * @param _sink_replicas the number of sink replicas
          */
         void set_sink_replicas(const std::size_t& _sink_replicas) {
-            sink_replicas = _sink_replicas;
+            slots.clear();
+            slots.resize(_sink_replicas);
         }
 
         /**
-         * @brief Increments the number of sink replicas which processed zero tuples.
+         * @brief Adds the Metrics_Collector related to a sink replica.
+         *
+         * Each replica writes its own slot, so no synchronization is needed among the sinks.
+         *
+         * @param sink index of the sink replica
+         * @param mc the metrics collector of a sink
          */
-        void add_empty_sink() {
-            sink_zero_processed.fetch_add(1);
+        void add_collector(const std::size_t sink, Metrics_Collector&& mc) {
+            if (sink >= slots.size())
+                throw std::out_of_range("[Metrics_Aggregator] ERR: sink replica " + std::to_string(sink) + " out of range");
+            slots[sink] = std::make_unique<Metrics_Collector>(std::move(mc));
         }
 
         /**
-         * @brief Adds the Metrics_Collector related to a sink replica.
+         * @brief Evaluates the number of sink replicas which processed more than zero tuples.
          *
-         * @param tuple_latency the latency value in milliseconds
+         * @return the number of active sink replicas
          */
-        void add_collector(Metrics_Collector&& mc) {
-            std::unique_lock<std::mutex> lock(m);
-            aggregator.emplace_back(std::move(mc));
+        std::size_t get_active_sinks() const {
+            return std::count_if(slots.begin(), slots.end(), [](const auto& s) { return s != nullptr; });
         }
 
         /**
-         * @brief Evaluates the number of sink replicas which processed more than zero tuples.
+         * @brief Gets the latency histogram of all the sink replicas (valid after dump()).
          *
-         * @return the number of active sink replicas
+         * @return latency histogram (nanoseconds)
          */
-        std::size_t get_active_sinks() {
-            return sink_replicas - sink_zero_processed;
+        const Histogram& get_histogram() const {
+            return global_latencies;
         }
 
         /**
@@ -296,27 +249,31 @@ namespace metrics {
          * @return the global average latency value
          */
         double dump() {
-#ifdef DEBUG_PRINT_METRIC
-            std::cout << "[Aggregator] dumping latency statistics for " << aggregator.size() << " sinks..." << std::endl;
-#endif
-            if (aggregator.empty()) {
+            if (trace::debug()) {
+                std::cout << "[Aggregator] dumping latency statistics for " << get_active_sinks() << " sinks..." << std::endl;
+            }
+            if (get_active_sinks() == 0) {
                 std::cout << "[Aggregator] no latency statistics available." << std::endl;
                 return 0;
             }
 
-            if (aggregator.size() == (sink_replicas - sink_zero_processed)) {
-                for (auto& coll: aggregator) {
-                    double avg_lat = coll.compute_latency_statistics();
-                    average_latency_sum += avg_lat;
-#ifdef DEBUG_PRINT_METRIC
-                    std::cout << "[Collector_Sink" << collection.get_sink() << "] avg latency " << avg_lat << std::endl;
-#endif
+            for (const auto& coll: slots) {
+                if (!coll) continue;
+                [[maybe_unused]] double avg_lat = coll->compute_latency_statistics();
+                global_latencies.merge(coll->get_histogram());
+                if (trace::debug()) {
+                    std::cout << "[Collector_Sink" << coll->get_sink() << "] avg latency " << avg_lat << std::endl;
                 }
-            } else {
-                std::cout << "[Aggregator] waiting for some sink replica to terminate." << std::endl;
             }
 
-            return average_latency_sum / (double)(sink_replicas - sink_zero_processed);
+            /// write global latency summary to output file
+            std::ofstream out("latency.txt");
+            out << "[Global] latency (ms): ";
+            write_latency_statistics(out, global_latencies);
+            out << "." << std::endl;
+            out.close();
+
+            return global_latencies.mean() / 1000000.0;
         }
 
         /**
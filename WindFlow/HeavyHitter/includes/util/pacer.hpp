@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    pacer.hpp
+ *
+ *  @brief Utility file defining the pacing of the sources (global constant rate or trace replay).
+ *
+ *  In constant rate mode all the source replicas draw tokens from a single shared bucket, so
+ *  the target rate applies to the whole application. Tokens are reserved in batches with one
+ *  atomic operation and one clock read per batch (generic cell rate algorithm with a bounded
+ *  burst tolerance), instead of busy-waiting a fixed delay after every tuple.
+ *  In replay mode each tuple is emitted at the instant given by its capture timestamp relative
+ *  to the first packet of the trace, divided by a speed-up factor, so that the original
+ *  inter-arrival times (bursts included) are reproduced. A source may pass a hook called while
+ *  it waits, to act when it stays idle (see eos::Idle_Flush).
+ */
+
+#pragma once
+#ifndef HH_PACER_HPP
+#define HH_PACER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <windflow.hpp>
+#include "util/tsc_clock.hpp"
+
+namespace pacer {
+
+    /// hook of a source which does nothing while it waits
+    struct no_idle {
+        void operator()(uint64_t) const {}
+    };
+
+    /**
+     * @brief Spins until the given instant (nanoseconds, tsc::now clock).
+     *
+     * @param deadline instant to wait for
+     * @param idle hook called with the clock at each spin
+     * @return the last reading of the clock
+     */
+    template<typename idle_t = no_idle>
+    inline uint64_t wait_until(const uint64_t deadline, idle_t&& idle = idle_t()) {
+        uint64_t now;
+        while ((now = tsc::now()) < deadline) {
+            idle(now);
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+        return now;
+    }
+
+    /**
+     * @class Token_Bucket
+     * @brief Token bucket shared by all the source replicas, enforcing a global emission rate.
+     */
+    class Token_Bucket {
+    private:
+        std::atomic<uint64_t> tat;      // theoretical arrival time of the next token (nanoseconds)
+        double ns_per_token;            // emission period at the target rate
+        uint32_t batch;                 // tokens reserved by each acquire
+        uint64_t burst_ns;              // how far behind schedule a replica can fall before tokens are dropped
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _rate global target rate (tuples/s)
+         */
+        explicit Token_Bucket(const long _rate) :
+                tat(0),
+                ns_per_token(1e9 / _rate),
+                batch(std::clamp<long>(_rate / 100000, 1, 64)),     // about 10 us worth of tuples per batch
+                burst_ns(4 * batch * ns_per_token) {}
+
+        /**
+         * @brief Reserves a batch of tokens, waiting until the batch is due.
+         *
+         * @param _now set to the last reading of the clock
+         * @param idle hook called while waiting
+         * @return number of tuples that can be emitted
+         */
+        template<typename idle_t>
+        uint32_t acquire(uint64_t& _now, idle_t&& idle) {
+            const uint64_t now = tsc::now();
+            const uint64_t cost = batch * ns_per_token;
+            uint64_t old_tat = tat.load(std::memory_order_relaxed);
+            uint64_t due;
+            do {
+                due = std::max(old_tat, now - std::min(now, burst_ns));
+            } while (!tat.compare_exchange_weak(old_tat, due + cost, std::memory_order_relaxed));
+            _now = (due > now) ? wait_until(due, idle) : now;
+            return batch;
+        }
+    };
+
+    /**
+     * @class Source_Pacer
+     * @brief Pacing logic of a source replica (copied in each replica, the global state is shared).
+     */
+    class Source_Pacer {
+    private:
+        /// constant rate mode
+        std::shared_ptr<Token_Bucket> bucket;
+        uint32_t credit;                        // tuples left in the current batch
+
+        /// replay mode
+        double speedup;                         // 0 disables the replay mode
+        std::shared_ptr<std::atomic<uint64_t>> epoch;   // common start instant of the replay (nanoseconds)
+        uint64_t origin;                        // capture timestamp (us) of the first packet of the trace (0 = first packet seen)
+        uint64_t span;                          // duration (us) of the trace (0 = measured on each generation)
+        uint64_t gen_base;                      // offset (us) of the current generation
+        uint64_t max_ts;                        // last capture timestamp seen in the current generation
+        uint64_t start_ns;
+
+    public:
+        /**
+         * @brief Default constructor (no pacing, the sources emit at full speed).
+         */
+        Source_Pacer() : credit(0), speedup(0), origin(0), span(0), gen_base(0), max_ts(0), start_ns(0) {}
+
+        /**
+         * @brief Creates a pacer enforcing a global rate, shared by all the replicas.
+         *
+         * @param _rate global target rate (tuples/s), 0 for full speed
+         */
+        static Source_Pacer constant_rate(const long _rate) {
+            Source_Pacer p;
+            if (_rate > 0) p.bucket = std::make_shared<Token_Bucket>(_rate);
+            return p;
+        }
+
+        /**
+         * @brief Creates a pacer reproducing the capture timestamps of the trace.
+         *
+         * @param _speedup speed-up factor applied to the original inter-arrival times
+         * @param _origin capture timestamp (us) of the first packet (0 to take it from the stream)
+         * @param _span duration (us) of the trace (0 to measure it while replaying)
+         */
+        static Source_Pacer replay(const double _speedup, const uint64_t _origin = 0, const uint64_t _span = 0) {
+            Source_Pacer p;
+            p.speedup = _speedup;
+            p.epoch = std::make_shared<std::atomic<uint64_t>>(0);
+            p.origin = _origin;
+            p.span = _span;
+            return p;
+        }
+
+        /**
+         * @brief Checks if the pacer limits the emission of the source.
+         */
+        bool enabled() const {
+            return bucket != nullptr || speedup > 0;
+        }
+
+        /**
+         * @brief Gets a description of the pacing mode.
+         */
+        std::string describe(const long _rate) const {
+            if (speedup > 0) return "replay of the trace timestamps (x" + std::to_string(speedup) + ")";
+            return (bucket == nullptr) ? "max speed" : std::to_string(_rate) + " (tuples/s, global)";
+        }
+
+        /**
+         * @brief Called by the replica before emitting its first tuple.
+         */
+        void start() {
+            if (speedup > 0) {
+                uint64_t expected = 0;
+                const uint64_t now = tsc::now();
+                epoch->compare_exchange_strong(expected, now);  // the first replica fixes the common start
+                start_ns = epoch->load();
+            }
+        }
+
+        /**
+         * @brief Waits until the next tuple can be emitted.
+         *
+         * @param _capture_ts capture timestamp (us) of the tuple (used in replay mode)
+         * @param idle hook called while waiting
+         * @return the reading of the clock taken while waiting, 0 if the clock has not been read
+         */
+        template<typename idle_t = no_idle>
+        inline uint64_t pace(const uint64_t _capture_ts, idle_t&& idle = idle_t()) {
+            uint64_t now = 0;
+            if (bucket != nullptr) {
+                if (credit == 0) credit = bucket->acquire(now, idle);
+                credit--;
+            } else if (speedup > 0) {
+                if (origin == 0) origin = _capture_ts;
+                max_ts = std::max(max_ts, _capture_ts);
+                const uint64_t rel = (_capture_ts > origin) ? _capture_ts - origin : 0;
+                now = wait_until(start_ns + (uint64_t)((rel + gen_base) * 1000.0 / speedup), idle);
+            }
+            return now;
+        }
+
+        /**
+         * @brief Called by the replica when the trace is replayed again from the beginning.
+         */
+        void next_generation() {
+            if (speedup > 0) {
+                gen_base += ((span > 0) ? span : max_ts - std::min(max_ts, origin)) + 1;
+                max_ts = 0;
+            }
+        }
+    };
+}
+
+#endif //HH_PACER_HPP
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    perf_counters.hpp
+ *
+ *  @brief Hardware counters of the calling thread (instructions, cycles, cache misses) read through perf_event_open.
+ *
+ *  The counters are opened as a single group, so that they are scheduled together on the PMU and
+ *  their values refer to the same interval. When the kernel does not grant them (no PMU in a virtual
+ *  machine, perf_event_paranoid too high, a container without the syscall) the group is not available
+ *  and the readings are zero.
+ */
+
+#pragma once
+#ifndef HH_PERF_COUNTERS_HPP
+#define HH_PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace perf {
+
+    /// counted events
+    enum event_t { INSTRUCTIONS, CYCLES, CACHE_MISSES, L1D_MISSES, NUM_EVENTS };
+
+    inline std::string event_name(const event_t e) {
+        switch (e) {
+            case INSTRUCTIONS: return "instructions";
+            case CYCLES: return "cycles";
+            case CACHE_MISSES: return "LLC misses";
+            default: return "L1D misses";
+        }
+    }
+
+    /// values of the counters over an interval
+    struct sample_t {
+        uint64_t value[NUM_EVENTS] = {0, 0, 0, 0};
+    };
+
+    /**
+     * @class Counters
+     * @brief Group of hardware counters of the calling thread (not copyable, the descriptors are closed by the destructor).
+     */
+    class Counters {
+    private:
+        int fd[NUM_EVENTS];
+        bool opened[NUM_EVENTS];
+        uint64_t begin[NUM_EVENTS];
+
+#if defined(__linux__)
+        static int open_event(const uint32_t type, const uint64_t config, const int group) {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = (group == -1);      // the leader starts the whole group
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+        }
+#endif
+
+        uint64_t read_one(const int i) const {
+            uint64_t v = 0;
+#if defined(__linux__)
+            if (opened[i] && ::read(fd[i], &v, sizeof(v)) != (ssize_t)sizeof(v)) v = 0;
+#endif
+            return v;
+        }
+
+    public:
+        Counters() {
+            for (int i = 0; i < NUM_EVENTS; i++) {
+                fd[i] = -1;
+                opened[i] = false;
+                begin[i] = 0;
+            }
+#if defined(__linux__)
+            fd[INSTRUCTIONS] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1);
+            if (fd[INSTRUCTIONS] < 0) return;
+            opened[INSTRUCTIONS] = true;
+            fd[CYCLES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, fd[INSTRUCTIONS]);
+            fd[CACHE_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, fd[INSTRUCTIONS]);
+            fd[L1D_MISSES] = open_event(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), fd[INSTRUCTIONS]);
+            for (int i = CYCLES; i < NUM_EVENTS; i++) opened[i] = (fd[i] >= 0);     // an event missing on this PMU reads zero
+            ioctl(fd[INSTRUCTIONS], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fd[INSTRUCTIONS], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+        }
+
+        Counters(const Counters&) = delete;
+        Counters& operator=(const Counters&) = delete;
+
+        ~Counters() {
+#if defined(__linux__)
+            for (int i = 0; i < NUM_EVENTS; i++) {
+                if (fd[i] >= 0) close(fd[i]);
+            }
+#endif
+        }
+
+        /**
+         * @brief Checks if the counters are available (at least the instructions).
+         */
+        bool available() const {
+            return opened[INSTRUCTIONS];
+        }
+
+        /**
+         * @brief Checks if an event is counted.
+         */
+        bool counts(const event_t e) const {
+            return opened[e];
+        }
+
+        /**
+         * @brief Starts an interval.
+         */
+        void start() {
+            for (int i = 0; i < NUM_EVENTS; i++) begin[i] = read_one(i);
+        }
+
+        /**
+         * @brief Ends the interval started by the last start.
+         *
+         * @return events counted in the interval
+         */
+        sample_t stop() const {
+            sample_t s;
+            for (int i = 0; i < NUM_EVENTS; i++) s.value[i] = read_one(i) - begin[i];
+            return s;
+        }
+    };
+}
+
+#endif //HH_PERF_COUNTERS_HPP
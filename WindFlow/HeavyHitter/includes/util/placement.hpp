@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    placement.hpp
+ *
+ *  @brief Placement of the operator replicas on cores and NUMA nodes.
+ *
+ *  A placement maps the replicas of an operator to a list of targets, assigned round-robin by
+ *  replica index: a core ("3"), a range of cores, one per replica ("4-7"), all the cores of a NUMA
+ *  node ("node1") or the node of the capture interface ("nic"). The entry "*" applies to the
+ *  operators not listed. A spec is a list of op=targets entries separated by ';' (or a file with
+ *  one entry per line, '#' starting a comment), e.g. "Source=0,1;ByteLenAccumulator=node1;*=node0".
+ *
+ *  The thread of a replica is bound to its target when the replica registers, at its first call,
+ *  and from then on the memory it allocates is first touched on the node of the target. Operators
+ *  chained on the same thread keep the binding of the first operator of the chain. Every bound
+ *  replica records the core and the node it is running on once bound, which the summary reports.
+ */
+
+#pragma once
+#ifndef HH_PLACEMENT_HPP
+#define HH_PLACEMENT_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+namespace placement {
+
+    /// target of a replica
+    struct target_t {
+        std::string label;
+        std::vector<int> cpus;      // cores the thread may run on
+    };
+
+    /// placement of a replica, as actually applied
+    struct record_t {
+        std::string op;
+        std::size_t replica;
+        std::string target;         // requested target (or the operator the replica is chained to)
+        int cpu;                    // core running the replica after the binding
+        int node;                   // NUMA node of that core
+    };
+
+    /**
+     * @brief Reads a cpu list of the kernel (e.g. "0-3,8-11").
+     */
+    inline std::vector<int> parse_cpulist(const std::string& list) {
+        std::vector<int> cpus;
+        std::stringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (item.empty() || item == "\n") continue;
+            const std::size_t dash = item.find('-');
+            const int first = std::stoi(item.substr(0, dash));
+            const int last = (dash == std::string::npos) ? first : std::stoi(item.substr(dash + 1));
+            for (int c = first; c <= last; c++) cpus.push_back(c);
+        }
+        return cpus;
+    }
+
+    /**
+     * @brief Gets the cores of a NUMA node.
+     */
+    inline std::vector<int> node_cpus(const int node) {
+        std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+        if (!f || !std::getline(f, list) || list.empty())
+            throw std::invalid_argument("[placement] ERR: NUMA node " + std::to_string(node) + " not found");
+        return parse_cpulist(list);
+    }
+
+    /**
+     * @brief Gets the NUMA node of a network interface (0 if the device does not report it).
+     */
+    inline int interface_node(const std::string& iface) {
+        std::ifstream f("/sys/class/net/" + iface + "/device/numa_node");
+        int node = -1;
+        if (!f || !(f >> node) || node < 0) return 0;
+        return node;
+    }
+
+    /**
+     * @class Placement
+     * @brief Placement of the replicas of all the operators and record of the bindings applied.
+     */
+    class Placement {
+    private:
+        std::map<std::string, std::vector<target_t>> targets;
+        std::vector<record_t> records;
+        std::mutex m;                   // only taken once per replica, to record its binding
+        inline static thread_local std::string owner;      // replica that bound the calling thread
+
+        void add_record(record_t r) {
+            unsigned cpu = 0, node = 0;
+            if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+                r.cpu = cpu;
+                r.node = node;
+            }
+            std::unique_lock<std::mutex> lock(m);
+            for (auto& e : records) {
+                if (e.op == r.op && e.replica == r.replica) {     // the last binding of a replica wins
+                    e = std::move(r);
+                    return;
+                }
+            }
+            records.push_back(std::move(r));
+        }
+
+        bool apply(const std::string& _op, const std::size_t _replica, const target_t& t) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int c : t.cpus) CPU_SET(c, &set);
+            const int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (err == 0) owner = _op + "-" + std::to_string(_replica);
+            add_record({_op, _replica, (err == 0) ? t.label : t.label + " (failed: " + std::to_string(err) + ")", -1, -1});
+            return err == 0;
+        }
+
+        static bool numeric(const std::string& s) {
+            return !s.empty() && s.find_first_not_of("0123456789") == std::string::npos;
+        }
+
+        static std::string trim(const std::string& s) {
+            const std::size_t first = s.find_first_not_of(" \t\r\n");
+            if (first == std::string::npos) return "";
+            return s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+        }
+
+        static std::vector<target_t> parse_targets(const std::string& list, const std::string& iface) {
+            const long n_cpus = sysconf(_SC_NPROCESSORS_CONF);
+            std::vector<target_t> ts;
+            std::stringstream ss(list);
+            std::string t;
+            while (std::getline(ss, t, ',')) {
+                t = trim(t);
+                const std::size_t dash = t.find('-');
+                if (t.rfind("node", 0) == 0 && numeric(t.substr(4))) {
+                    ts.push_back({t, node_cpus(std::stoi(t.substr(4)))});
+                } else if (t == "nic") {
+                    if (iface.empty())
+                        throw std::invalid_argument("[placement] ERR: target nic requires a capture interface (-I)");
+                    const int node = interface_node(iface);
+                    ts.push_back({"nic (node" + std::to_string(node) + ")", node_cpus(node)});
+                } else if (numeric(t.substr(0, dash)) && (dash == std::string::npos || numeric(t.substr(dash + 1)))) {
+                    for (int c : parse_cpulist(t)) {
+                        if (c >= n_cpus || c >= CPU_SETSIZE)
+                            throw std::invalid_argument("[placement] ERR: core " + std::to_string(c) + " not available");
+                        ts.push_back({"cpu" + std::to_string(c), {c}});
+                    }
+                } else {
+                    throw std::invalid_argument("[placement] ERR: bad target " + t);
+                }
+            }
+            if (ts.empty())
+                throw std::invalid_argument("[placement] ERR: no targets in " + list);
+            return ts;
+        }
+
+    public:
+        /**
+         * @brief Sets the placement from a spec, or from a file when the spec starts with '@'.
+         *
+         * @param spec placement spec
+         * @param iface capture interface, for the nic target (empty if none)
+         */
+        void configure(const std::string& spec, const std::string& iface) {
+            std::string text = spec;
+            char sep = ';';
+            if (!spec.empty() && spec[0] == '@') {
+                std::ifstream f(spec.substr(1));
+                if (!f) throw std::invalid_argument("[placement] ERR: cannot open " + spec.substr(1));
+                std::stringstream buf;
+                std::string line;
+                while (std::getline(f, line)) buf << line.substr(0, line.find('#')) << '\n';
+                text = buf.str();
+                sep = '\n';
+            }
+            targets.clear();
+            std::stringstream ss(text);
+            std::string entry;
+            while (std::getline(ss, entry, sep)) {
+                entry = trim(entry);
+                if (entry.empty()) continue;
+                const std::size_t eq = entry.find('=');
+                if (eq == std::string::npos)
+                    throw std::invalid_argument("[placement] ERR: expected op=targets, found " + entry);
+                targets[trim(entry.substr(0, eq))] = parse_targets(entry.substr(eq + 1), iface);
+            }
+            if (targets.empty())
+                throw std::invalid_argument("[placement] ERR: empty placement");
+        }
+
+        bool active() const {
+            return !targets.empty();
+        }
+
+        /**
+         * @brief Binds the calling thread, running the given replica, to its target.
+         *
+         * @param _op name of the operator
+         * @param _replica index of the replica
+         * @return true if the thread has been bound (its memory should be first touched again)
+         */
+        bool bind(const std::string& _op, const std::size_t _replica) {
+            if (!active() || owner == _op + "-" + std::to_string(_replica)) return false;    // not placed, or already bound
+            auto it = targets.find(_op);
+            if (it == targets.end()) it = targets.find("*");
+            if (!owner.empty()) {
+                add_record({_op, _replica, "chained to " + owner, -1, -1});
+                return false;
+            }
+            if (it == targets.end()) {
+                add_record({_op, _replica, "runtime", -1, -1});
+                return false;
+            }
+            return apply(_op, _replica, it->second[_replica % it->second.size()]);
+        }
+
+        /**
+         * @brief Binds the calling thread, running the given replica, to a core (used by the runtimes
+         *        which place their threads themselves).
+         *
+         * @param _op name of the operator
+         * @param _replica index of the replica
+         * @param _cpu core
+         * @return true if the thread has been bound
+         */
+        bool pin(const std::string& _op, const std::size_t _replica, const int _cpu) {
+            return apply(_op, _replica, {"cpu" + std::to_string(_cpu), {_cpu}});
+        }
+
+        bool has_records() {
+            std::unique_lock<std::mutex> lock(m);
+            return !records.empty();
+        }
+
+        /**
+         * @brief Writes the placement of the replicas, in order of operator and replica.
+         */
+        void write_summary(std::ostream& os) {
+            std::unique_lock<std::mutex> lock(m);
+            std::vector<record_t> l(records);
+            lock.unlock();
+            std::map<std::string, std::size_t> rank;     // operators in order of first registration
+            for (const auto& r : l) rank.emplace(r.op, rank.size());
+            std::sort(l.begin(), l.end(), [&rank](const record_t& a, const record_t& b) {
+                return rank[a.op] != rank[b.op] ? rank[a.op] < rank[b.op] : a.replica < b.replica;
+            });
+            os << "[SUMMARY] placement:" << std::endl;
+            for (const auto& r : l) {
+                os << "  " << r.op << "-" << r.replica << ": " << r.target
+                   << ", running on cpu " << r.cpu << " (numa node " << r.node << ")" << std::endl;
+            }
+        }
+    };
+
+    /// placement of the whole application
+    inline Placement placement;
+}
+
+#endif //HH_PLACEMENT_HPP
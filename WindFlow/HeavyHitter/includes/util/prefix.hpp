@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    prefix.hpp
+ *
+ *  @brief Utility file defining the IPv4 prefixes used by the hierarchical heavy hitter detection.
+ *
+ *  The hierarchy is defined on the source or on the destination address, with the levels /8, /16,
+ *  /24 and /32. A prefix is identified by a 64-bit key holding the dimension of the hierarchy, the
+ *  prefix length and the masked address (host byte order), so that the prefixes of all the levels
+ *  can be stored in the same table.
+ */
+
+#pragma once
+#ifndef HH_PREFIX_HPP
+#define HH_PREFIX_HPP
+
+#include <cstdint>
+#include <string>
+#include <arpa/inet.h>
+
+namespace prefix {
+
+    /**
+     * @brief Address on which the hierarchy is defined.
+     */
+    enum class dim_t {
+        SRC,
+        DST
+    };
+
+    /// prefix lengths of the levels of the hierarchy, from the most specific
+    constexpr unsigned levels[] = {32, 24, 16, 8};
+    constexpr std::size_t num_levels = sizeof(levels) / sizeof(levels[0]);
+
+    inline bool parse_dim(const std::string& _name, dim_t& _dim) {
+        if (_name == "src") _dim = dim_t::SRC;
+        else if (_name == "dst") _dim = dim_t::DST;
+        else return false;
+        return true;
+    }
+
+    inline std::string dim_to_string(const dim_t _dim) {
+        return (_dim == dim_t::SRC) ? "source" : "destination";
+    }
+
+    inline constexpr uint32_t mask(const unsigned _len) {
+        return (_len == 0) ? 0 : ~0u << (32 - _len);
+    }
+
+    /**
+     * @brief Computes the key of a prefix.
+     *
+     * @param _dim dimension of the hierarchy
+     * @param _len prefix length
+     * @param _addr IPv4 address (host byte order)
+     * @return prefix key
+     */
+    inline constexpr uint64_t key(const dim_t _dim, const unsigned _len, const uint32_t _addr) {
+        return ((uint64_t)(_dim == dim_t::DST) << 40) | ((uint64_t)_len << 32) | (_addr & mask(_len));
+    }
+
+    inline constexpr unsigned length(const uint64_t _key) {
+        return (_key >> 32) & 0xff;
+    }
+
+    inline constexpr dim_t dim(const uint64_t _key) {
+        return ((_key >> 40) & 1) ? dim_t::DST : dim_t::SRC;
+    }
+
+    /// prefix of the given length containing the prefix _key
+    inline constexpr uint64_t parent(const uint64_t _key, const unsigned _len) {
+        return key(dim(_key), _len, (uint32_t)_key);
+    }
+
+    /// masked address of the prefix (network byte order)
+    inline uint32_t address(const uint64_t _key) {
+        return htonl((uint32_t)_key);
+    }
+
+    /**
+     * @brief Gets the text form of a prefix (e.g. 10.1.0.0/16).
+     *
+     * @param _key prefix key
+     * @return prefix in CIDR notation
+     */
+    inline std::string to_string(const uint64_t _key) {
+        char buf[INET_ADDRSTRLEN];
+        const uint32_t addr = address(_key);
+        inet_ntop(AF_INET, &addr, buf, sizeof(buf));
+        return std::string(buf) + "/" + std::to_string(length(_key));
+    }
+}
+
+#endif //HH_PREFIX_HPP
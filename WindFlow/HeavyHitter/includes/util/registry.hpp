@@ -0,0 +1,418 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    registry.hpp
+ *
+ *  @brief Registry of the live counters of the operator replicas.
+ *
+ *  Each replica of an operator gets its own slot of counters, aligned to a cache line, the first
+ *  time it processes a tuple. A slot is only written by the thread of its replica, with relaxed
+ *  loads and stores (no atomic read-modify-write and no shared cache lines), and can be read at
+ *  any time by other threads, which aggregate the values of the slots.
+ *
+ *  Besides the tuples received and emitted, the slots hold the service time of a sample of the
+ *  calls of the functors, the idle time between the calls and the fill level of the windows, from
+ *  which the end-of-run summary of the operators is computed.
+ */
+
+#pragma once
+#ifndef HH_REGISTRY_HPP
+#define HH_REGISTRY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "util/placement.hpp"
+#include "util/tsc_clock.hpp"
+
+namespace metrics {
+
+    /**
+     * @class Counter
+     * @brief Counter with a single writer and any number of readers.
+     */
+    class Counter {
+    private:
+        std::atomic<uint64_t> value;
+
+    public:
+        Counter() : value(0) {}
+
+        void add(const uint64_t n = 1) {
+            value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        void set(const uint64_t v) {
+            value.store(v, std::memory_order_relaxed);
+        }
+
+        uint64_t get() const {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Histogram of a quantity on power-of-two buckets, with a single writer.
+     */
+    struct Log2_Histogram {
+        static constexpr std::size_t BUCKETS = 48;
+
+        Counter count;
+        Counter sum;
+        Counter buckets[BUCKETS];           // values in [2^i, 2^(i+1))
+
+        void record(const uint64_t v) {
+            count.add();
+            sum.add(v);
+            const std::size_t b = (v == 0) ? 0 : 63 - __builtin_clzll(v);
+            buckets[(b < BUCKETS) ? b : BUCKETS - 1].add();
+        }
+
+        double mean() const {
+            const uint64_t n = count.get();
+            return (n > 0) ? (double)sum.get() / n : 0;
+        }
+
+        /// percentile taken at the midpoint of its bucket (within a factor of two)
+        double percentile(const double p) const {
+            const uint64_t n = count.get();
+            if (n == 0) return 0;
+            const uint64_t rank = (uint64_t)(p * (n - 1)) + 1;
+            uint64_t seen = 0;
+            for (std::size_t b = 0; b < BUCKETS; b++) {
+                seen += buckets[b].get();
+                if (seen >= rank) return 1.5 * (double)(1ULL << b);
+            }
+            return 0;
+        }
+    };
+
+    /**
+     * @brief Counters of a single replica of an operator.
+     */
+    struct alignas(64) Replica_Stats {
+        std::string op;             // name of the operator
+        std::size_t replica;        // index of the replica
+
+        alignas(64) Counter tuples_in;      // tuples received (generated by the sources)
+        Counter tuples_out;                 // tuples emitted
+        Counter batches;                    // batches processed (batch operators only)
+        Counter exec_time;                  // running time of the replica (nanoseconds, set at its termination)
+
+        alignas(64) Log2_Histogram latency;     // latency of the received tuples (sink replicas only, nanoseconds)
+        alignas(64) Log2_Histogram service;     // service time of the sampled calls (nanoseconds)
+        Counter idle;                           // time between the sampled calls and the next ones (nanoseconds)
+        alignas(64) Log2_Histogram window;      // items (tuples, flows or prefixes) in the closed windows
+        Counter window_max;
+        Counter table_flows;                    // flows in the flow table (flow table accumulator only)
+        Counter table_slots;
+        Counter table_peak;
+        Counter table_evicted;
+        Counter table_probe;                    // longest probe distance
+        Counter state_bytes;                    // bytes held by the state of the replica (stateful operators only)
+        Counter live_flows;                     // flows (or prefixes, results) in that state
+        Counter batch_len;                      // batch size in use (adaptive batching only)
+        Counter bytes_out;                      // bytes of the packets kept (sampler only)
+        Counter bytes_sq_out;                   // sum of the squares of their lengths
+
+        /// records the latency of a tuple (nanoseconds)
+        void record_latency(const uint64_t ns) {
+            latency.record(ns);
+        }
+
+        /// records the fill level of a closed window
+        void record_window(const uint64_t items) {
+            window.record(items);
+            if (items > window_max.get()) window_max.set(items);
+        }
+    };
+
+    /**
+     * @class Registry
+     * @brief Collection of the counters of all the operator replicas.
+     */
+    class Registry {
+    public:
+        /// sums of the counters of the replicas of an operator
+        struct totals_t {
+            std::size_t replicas = 0;
+            uint64_t tuples_in = 0;
+            uint64_t tuples_out = 0;
+            uint64_t exec_time = 0;         // nanoseconds
+        };
+
+    private:
+        std::deque<Replica_Stats> slots;    // stable addresses
+        mutable std::mutex m;               // only taken to register the replicas and to list the slots
+
+    public:
+        /**
+         * @brief Gets the slot of a replica, creating it the first time the replica is registered.
+         *
+         * @param _op name of the operator
+         * @param _replica index of the replica
+         * @return slot of the replica
+         */
+        Replica_Stats* replica(const std::string& _op, const std::size_t _replica) {
+            std::unique_lock<std::mutex> lock(m);
+            for (auto& s : slots) {
+                if (s.replica == _replica && s.op == _op) return &s;
+            }
+            Replica_Stats& s = slots.emplace_back();
+            s.op = _op;
+            s.replica = _replica;
+            return &s;
+        }
+
+        /**
+         * @brief Gets the slots registered so far.
+         *
+         * @return pointers to the slots, in order of registration
+         */
+        std::vector<const Replica_Stats*> list() const {
+            std::unique_lock<std::mutex> lock(m);
+            std::vector<const Replica_Stats*> l;
+            for (const auto& s : slots) l.push_back(&s);
+            return l;
+        }
+
+        /**
+         * @brief Drops all the slots (before the run, when no functor holds one).
+         */
+        void clear() {
+            std::unique_lock<std::mutex> lock(m);
+            slots.clear();
+        }
+
+        /**
+         * @brief Sums the counters of the replicas of an operator.
+         *
+         * @param _op name of the operator
+         * @return totals of the operator
+         */
+        totals_t total(const std::string& _op) const {
+            totals_t t;
+            for (const Replica_Stats* s : list()) {
+                if (s->op != _op) continue;
+                t.replicas++;
+                t.tuples_in += s->tuples_in.get();
+                t.tuples_out += s->tuples_out.get();
+                t.exec_time += s->exec_time.get();
+            }
+            return t;
+        }
+    };
+
+    /// registry of the whole application
+    inline Registry registry;
+
+    /**
+     * @class Probe
+     * @brief Slot of a replica with the sampled timing of the calls of its functor.
+     *
+     * One call every SAMPLE_PERIOD is timed, together with the idle time until the next call, so the
+     * busy fraction of the replica is estimated with three clock reads every SAMPLE_PERIOD calls.
+     */
+    class Probe {
+    private:
+        Replica_Stats* stats;
+        uint32_t calls;
+        bool timing;                // the current call is sampled
+        bool gap;                   // the idle time before the current call is sampled
+        uint64_t t_begin;
+        uint64_t t_end;
+
+        static uint64_t now() {
+            return tsc::now();
+        }
+
+    public:
+        static constexpr uint32_t SAMPLE_PERIOD = 64;
+
+        /**
+         * @class Scope
+         * @brief Times the enclosing call, if sampled.
+         */
+        class Scope {
+        private:
+            Probe& probe;
+
+        public:
+            explicit Scope(Probe& _probe) : probe(_probe) {
+                probe.begin();
+            }
+
+            ~Scope() {
+                probe.end();
+            }
+        };
+
+        Probe() : stats(nullptr), calls(0), timing(false), gap(false), t_begin(0), t_end(0) {}
+
+        /**
+         * @brief Registers the replica (at its first call) and binds its thread to its placement.
+         *
+         * @param _op name of the operator
+         * @param _replica index of the replica
+         * @return true if the thread has been bound to a placement target
+         */
+        bool attach(const std::string& _op, const std::size_t _replica) {
+            stats = registry.replica(_op, _replica);
+            return placement::placement.bind(_op, _replica);
+        }
+
+        bool attached() const {
+            return stats != nullptr;
+        }
+
+        Replica_Stats* operator->() const {
+            return stats;
+        }
+
+        void begin() {
+            if (gap) {
+                t_begin = now();
+                stats->idle.add(t_begin - t_end);
+                gap = false;
+                timing = ((++calls & (SAMPLE_PERIOD - 1)) == 0);
+                return;
+            }
+            if ((++calls & (SAMPLE_PERIOD - 1)) == 0) {
+                t_begin = now();
+                timing = true;
+            }
+        }
+
+        void end() {
+            if (!timing) return;
+            t_end = now();
+            stats->service.record(t_end - t_begin);
+            timing = false;
+            gap = true;
+        }
+    };
+
+    /**
+     * @brief Writes the statistics of the replicas and of each operator.
+     *
+     * @param out output stream
+     * @param reg registry of the counters
+     */
+    inline void write_operator_summary(std::ostream& out, const Registry& reg) {
+        struct total_t {
+            std::size_t replicas = 0;
+            uint64_t in = 0, out = 0, batches = 0;
+            uint64_t max_in = 0;
+            uint64_t svc_count = 0, svc_sum = 0, idle = 0;
+            double svc_p99 = 0;                 // largest among the replicas
+            double min_busy = 1, max_busy = 0;
+            uint64_t win_count = 0, win_sum = 0, win_max = 0;
+            uint64_t state_bytes = 0, live_flows = 0;
+        };
+        auto busy = [](const uint64_t svc, const uint64_t idle) {
+            return (svc + idle > 0) ? (double)svc / (svc + idle) : 0;
+        };
+        auto row = [&out](const std::string& name, const uint64_t in, const uint64_t tout, const uint64_t batches,
+                          const double svc_mean, const double svc_p99, const double b, const double win_mean, const uint64_t win_max) {
+            out << "  " << std::left << std::setw(36) << name << std::right
+                << " in " << std::setw(12) << in << " out " << std::setw(12) << tout
+                << " sel " << std::setw(7) << ((in > 0) ? (double)tout / in : 0)
+                << " batches " << std::setw(9) << batches
+                << " svc " << std::setw(9) << svc_mean / 1000.0 << " us (p99 " << std::setw(9) << svc_p99 / 1000.0 << " us)"
+                << " busy " << std::setw(6) << b * 100 << "%";
+            if (win_max > 0) out << " win fill " << win_mean << " (max " << win_max << ")";
+            out << "\n";
+        };
+        auto state = [&out](const uint64_t bytes, const uint64_t flows) {
+            if (bytes > 0) out << "  " << std::setw(36) << "" << " state " << bytes / 1048576.0 << " MB, " << flows << " live flows\n";
+        };
+
+        std::vector<std::string> order;
+        std::map<std::string, total_t> totals;
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+        out << "[OPERATORS] replicas (service times sampled on 1 call every " << Probe::SAMPLE_PERIOD << "):\n";
+        for (const Replica_Stats* s : reg.list()) {
+            if (totals.find(s->op) == totals.end()) order.push_back(s->op);
+            total_t& t = totals[s->op];
+            const double b = busy(s->service.sum.get(), s->idle.get());
+            t.replicas++;
+            t.in += s->tuples_in.get();
+            t.out += s->tuples_out.get();
+            t.batches += s->batches.get();
+            t.max_in = std::max(t.max_in, s->tuples_in.get());
+            t.svc_count += s->service.count.get();
+            t.svc_sum += s->service.sum.get();
+            t.idle += s->idle.get();
+            t.svc_p99 = std::max(t.svc_p99, s->service.percentile(0.99));
+            if (s->service.count.get() > 0) {
+                t.min_busy = std::min(t.min_busy, b);
+                t.max_busy = std::max(t.max_busy, b);
+            }
+            t.win_count += s->window.count.get();
+            t.win_sum += s->window.sum.get();
+            t.win_max = std::max(t.win_max, s->window_max.get());
+            t.state_bytes += s->state_bytes.get();
+            t.live_flows += s->live_flows.get();
+            row(s->op + "-" + std::to_string(s->replica), s->tuples_in.get(), s->tuples_out.get(), s->batches.get(),
+                s->service.mean(), s->service.percentile(0.99), b, s->window.mean(), s->window_max.get());
+            if (s->table_slots.get() > 0) {
+                out << "  " << std::setw(36) << "" << " table " << s->table_flows.get() << " flows in " << s->table_slots.get()
+                    << " slots (load " << 100.0 * s->table_flows.get() / s->table_slots.get() << "%, peak " << s->table_peak.get()
+                    << "), evicted " << s->table_evicted.get() << ", longest probe " << s->table_probe.get() << "\n";
+            }
+            state(s->state_bytes.get(), s->live_flows.get());
+            if (s->batch_len.get() > 0) {
+                out << "  " << std::setw(36) << "" << " adaptive batch " << s->batch_len.get() << " at the end (mean "
+                    << ((s->batches.get() > 0) ? (double)s->tuples_in.get() / s->batches.get() : 0) << ")\n";
+            }
+        }
+        out << "[OPERATORS] totals (busy range and input skew, max/mean, across the replicas):\n";
+        for (const auto& op : order) {
+            const total_t& t = totals[op];
+            row(op + " x" + std::to_string(t.replicas), t.in, t.out, t.batches,
+                (t.svc_count > 0) ? (double)t.svc_sum / t.svc_count : 0, t.svc_p99, busy(t.svc_sum, t.idle),
+                (t.win_count > 0) ? (double)t.win_sum / t.win_count : 0, t.win_max);
+            out << "  " << std::setw(36) << "" << " busy " << ((t.svc_count > 0) ? t.min_busy * 100 : 0) << "% - "
+                << t.max_busy * 100 << "%, skew " << ((t.in > 0) ? (double)t.max_in * t.replicas / t.in : 0) << "\n";
+            state(t.state_bytes, t.live_flows);
+        }
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif //HH_REGISTRY_HPP
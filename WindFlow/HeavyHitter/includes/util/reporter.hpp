@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    reporter.hpp
+ *
+ *  @brief Periodic reporter of the live metrics of the operator replicas.
+ *
+ *  A background thread wakes up at a fixed interval, reads the counters of the registry and
+ *  appends the values of the interval (tuples in and out, rates, latency of the sinks, bytes and
+ *  live flows of the state of the stateful replicas, resident set size of the process) of each
+ *  replica and of each operator to a time series file, in csv (long format, one row per replica
+ *  and per operator, with replica "all") or in json lines if the file name ends with ".json".
+ *  The last snapshot can also be exposed in the Prometheus text format on a TCP port.
+ */
+
+#pragma once
+#ifndef HH_REPORTER_HPP
+#define HH_REPORTER_HPP
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "util/memory.hpp"
+#include "util/registry.hpp"
+
+namespace metrics {
+
+    /**
+     * @class Live_Reporter
+     * @brief Thread exporting the counters of the registry at a fixed interval.
+     */
+    class Live_Reporter {
+    private:
+        /// values of a replica (or of a whole operator) at one snapshot
+        struct sample_t {
+            uint64_t tuples_in = 0;
+            uint64_t tuples_out = 0;
+            uint64_t lat_count = 0;
+            uint64_t lat_sum = 0;
+            uint64_t lat_buckets[Log2_Histogram::BUCKETS] = {};
+            uint64_t state_bytes = 0;       // gauges, not counters
+            uint64_t live_flows = 0;
+
+            void add(const sample_t& s) {
+                tuples_in += s.tuples_in;
+                state_bytes += s.state_bytes;
+                live_flows += s.live_flows;
+                tuples_out += s.tuples_out;
+                lat_count += s.lat_count;
+                lat_sum += s.lat_sum;
+                for (std::size_t b = 0; b < Log2_Histogram::BUCKETS; b++) lat_buckets[b] += s.lat_buckets[b];
+            }
+        };
+
+        const Registry& reg;
+        const long interval;                // milliseconds
+        std::ofstream out;
+        bool json;
+        int port;                           // 0 if the Prometheus endpoint is disabled
+        int server;
+        std::map<std::string, sample_t> last;   // previous snapshot, by replica ("op/idx")
+        std::string exposition;             // last snapshot in the Prometheus text format
+        std::mutex m;
+        std::condition_variable cv;
+        bool running;
+        std::thread reporter;
+        std::thread endpoint;
+        std::chrono::steady_clock::time_point start_time;
+        std::chrono::steady_clock::time_point prev_time;
+
+        static sample_t read(const Replica_Stats& s) {
+            sample_t v;
+            v.tuples_in = s.tuples_in.get();
+            v.tuples_out = s.tuples_out.get();
+            v.lat_count = s.latency.count.get();
+            v.lat_sum = s.latency.sum.get();
+            for (std::size_t b = 0; b < Log2_Histogram::BUCKETS; b++) v.lat_buckets[b] = s.latency.buckets[b].get();
+            v.state_bytes = s.state_bytes.get();
+            v.live_flows = s.live_flows.get();
+            return v;
+        }
+
+        /// difference between two snapshots of the same counters
+        static sample_t delta(const sample_t& cur, const sample_t& prev) {
+            sample_t d;
+            d.tuples_in = cur.tuples_in - prev.tuples_in;
+            d.tuples_out = cur.tuples_out - prev.tuples_out;
+            d.lat_count = cur.lat_count - prev.lat_count;
+            d.lat_sum = cur.lat_sum - prev.lat_sum;
+            for (std::size_t b = 0; b < Log2_Histogram::BUCKETS; b++) d.lat_buckets[b] = cur.lat_buckets[b] - prev.lat_buckets[b];
+            d.state_bytes = cur.state_bytes;
+            d.live_flows = cur.live_flows;
+            return d;
+        }
+
+        /// latency percentile of the interval (milliseconds), taken at the midpoint of the bucket
+        static double percentile(const sample_t& d, const double p) {
+            if (d.lat_count == 0) return 0;
+            const uint64_t rank = (uint64_t)(p * (d.lat_count - 1)) + 1;
+            uint64_t seen = 0;
+            for (std::size_t b = 0; b < Log2_Histogram::BUCKETS; b++) {
+                seen += d.lat_buckets[b];
+                if (seen >= rank) return 1.5 * (double)(1ULL << b) / 1e6;
+            }
+            return 0;
+        }
+
+        void write_row(const long ts, const std::string& op, const std::string& replica,
+                       const sample_t& total, const sample_t& d, const double secs, const uint64_t rss) {
+            const double in_rate = (secs > 0) ? d.tuples_in / secs : 0;
+            const double out_rate = (secs > 0) ? d.tuples_out / secs : 0;
+            const double lat_mean = (d.lat_count > 0) ? (double)d.lat_sum / d.lat_count / 1e6 : 0;
+            if (json) {
+                out << "{\"ts_ms\":" << ts << ",\"operator\":\"" << op << "\",\"replica\":\"" << replica
+                    << "\",\"tuples_in\":" << total.tuples_in << ",\"tuples_out\":" << total.tuples_out
+                    << ",\"in_rate\":" << in_rate << ",\"out_rate\":" << out_rate
+                    << ",\"lat_mean_ms\":" << lat_mean << ",\"lat_p50_ms\":" << percentile(d, 0.5)
+                    << ",\"lat_p99_ms\":" << percentile(d, 0.99) << ",\"state_bytes\":" << total.state_bytes
+                    << ",\"live_flows\":" << total.live_flows << ",\"rss_bytes\":" << rss << "}\n";
+            }
+            else {
+                out << ts << "," << op << "," << replica << "," << total.tuples_in << "," << total.tuples_out << ","
+                    << in_rate << "," << out_rate << "," << lat_mean << ","
+                    << percentile(d, 0.5) << "," << percentile(d, 0.99) << ","
+                    << total.state_bytes << "," << total.live_flows << "," << rss << "\n";
+            }
+        }
+
+        /// reads the registry and writes the values of the last interval
+        void snapshot() {
+            const auto now = std::chrono::steady_clock::now();
+            const long ts = std::chrono::duration_cast<std::chrono::milliseconds>(now - start_time).count();
+            const double secs = std::chrono::duration<double>(now - prev_time).count();
+            prev_time = now;
+            const uint64_t rss = memory::rss_bytes();
+
+            std::map<std::string, std::pair<sample_t, sample_t>> ops;   // operator -> (total, interval)
+            std::vector<std::string> order;
+            // the samples of each metric family are buffered apart, and written contiguously after its TYPE line
+            std::ostringstream tuples_in, tuples_out, state_bytes, live_flows, latency, out_rate, interval_latency;
+            for (const Replica_Stats* s : reg.list()) {
+                const sample_t cur = read(*s);
+                const std::string id = s->op + "/" + std::to_string(s->replica);
+                const sample_t d = delta(cur, last[id]);
+                last[id] = cur;
+                write_row(ts, s->op, std::to_string(s->replica), cur, d, secs, rss);
+                if (ops.find(s->op) == ops.end()) order.push_back(s->op);
+                ops[s->op].first.add(cur);
+                ops[s->op].second.add(d);
+                const std::string labels = "{operator=\"" + s->op + "\",replica=\"" + std::to_string(s->replica) + "\"}";
+                tuples_in << "hh_tuples_in_total" << labels << " " << cur.tuples_in << "\n";
+                tuples_out << "hh_tuples_out_total" << labels << " " << cur.tuples_out << "\n";
+                if (cur.state_bytes > 0) {
+                    state_bytes << "hh_state_bytes" << labels << " " << cur.state_bytes << "\n";
+                    live_flows << "hh_live_flows" << labels << " " << cur.live_flows << "\n";
+                }
+                if (cur.lat_count > 0) {
+                    latency << "hh_latency_seconds_sum" << labels << " " << cur.lat_sum / 1e9 << "\n"
+                            << "hh_latency_seconds_count" << labels << " " << cur.lat_count << "\n";
+                }
+            }
+            for (const auto& op : order) {
+                const auto& v = ops[op];
+                write_row(ts, op, "all", v.first, v.second, secs, rss);
+                const double lat_mean = (v.second.lat_count > 0) ? (double)v.second.lat_sum / v.second.lat_count / 1e9 : 0;
+                out_rate << "hh_out_rate{operator=\"" << op << "\"} " << ((secs > 0) ? v.second.tuples_out / secs : 0) << "\n";
+                if (v.second.lat_count > 0)
+                    interval_latency << "hh_interval_latency_seconds{operator=\"" << op << "\"} " << lat_mean << "\n";
+            }
+            out.flush();
+            if (port > 0) {
+                std::ostringstream prom;
+                prom << "# TYPE hh_rss_bytes gauge\nhh_rss_bytes " << rss << "\n";
+                const auto family = [&prom](const char* name, const char* type, const std::ostringstream& samples) {
+                    const std::string lines = samples.str();
+                    if (!lines.empty()) prom << "# TYPE " << name << " " << type << "\n" << lines;
+                };
+                family("hh_tuples_in_total", "counter", tuples_in);
+                family("hh_tuples_out_total", "counter", tuples_out);
+                family("hh_state_bytes", "gauge", state_bytes);
+                family("hh_live_flows", "gauge", live_flows);
+                family("hh_latency_seconds", "summary", latency);
+                family("hh_out_rate", "gauge", out_rate);
+                family("hh_interval_latency_seconds", "gauge", interval_latency);
+                std::unique_lock<std::mutex> lock(m);
+                exposition = prom.str();
+            }
+        }
+
+        void report_loop() {
+            std::unique_lock<std::mutex> lock(m);
+            while (running) {
+                cv.wait_for(lock, std::chrono::milliseconds(interval), [this] { return !running; });
+                lock.unlock();
+                snapshot();
+                lock.lock();
+            }
+        }
+
+        /// minimal HTTP server answering every request with the last snapshot
+        void serve_loop() {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(m);
+                    if (!running) break;
+                }
+                struct pollfd pfd = {server, POLLIN, 0};
+                if (poll(&pfd, 1, 200) <= 0) continue;
+                const int client = accept(server, nullptr, nullptr);
+                if (client < 0) continue;
+                char request[1024];
+                if (recv(client, request, sizeof(request), 0) > 0) {
+                    std::string body;
+                    {
+                        std::unique_lock<std::mutex> lock(m);
+                        body = exposition;
+                    }
+                    const std::string response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                                                 "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+                    send(client, response.data(), response.size(), MSG_NOSIGNAL);
+                }
+                close(client);
+            }
+        }
+
+        void open_endpoint() {
+            server = socket(AF_INET, SOCK_STREAM, 0);
+            if (server < 0) throw std::runtime_error("[Live_Reporter] ERR: cannot create the socket of the endpoint");
+            const int on = 1;
+            setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            struct sockaddr_in addr = {};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            addr.sin_port = htons(port);
+            if (bind(server, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(server, 8) < 0) {
+                const std::string reason = strerror(errno);
+                close(server);
+                throw std::runtime_error("[Live_Reporter] ERR: cannot listen on port " + std::to_string(port) + " of the Prometheus endpoint (" + reason + ")");
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _reg registry of the counters
+         * @param _interval reporting interval (milliseconds)
+         * @param _file time series file (json lines if it ends with .json, csv otherwise)
+         * @param _port port of the Prometheus endpoint (0 to disable it)
+         */
+        Live_Reporter(const Registry& _reg, const long _interval, const std::string& _file, const int _port = 0) :
+                reg(_reg), interval(_interval), json(false), port(_port), server(-1), running(false) {
+            if (_interval <= 0)
+                throw std::invalid_argument("[Live_Reporter] ERR: the reporting interval must be positive");
+            json = (_file.size() >= 5 && _file.compare(_file.size() - 5, 5, ".json") == 0);
+            out.open(_file);
+            if (!out.is_open())
+                throw std::runtime_error("[Live_Reporter] ERR: cannot open the output file " + _file);
+            out << std::fixed << std::setprecision(3);
+            if (!json)
+                out << "ts_ms,operator,replica,tuples_in,tuples_out,in_rate,out_rate,lat_mean_ms,lat_p50_ms,lat_p99_ms,state_bytes,live_flows,rss_bytes\n";
+        }
+
+        ~Live_Reporter() {
+            stop();
+        }
+
+        /**
+         * @brief Starts the reporting thread (and the endpoint, if enabled).
+         */
+        void start() {
+            if (port > 0) open_endpoint();
+            start_time = prev_time = std::chrono::steady_clock::now();
+            running = true;
+            reporter = std::thread(&Live_Reporter::report_loop, this);
+            if (port > 0) endpoint = std::thread(&Live_Reporter::serve_loop, this);
+        }
+
+        /**
+         * @brief Stops the threads, after writing a last snapshot.
+         */
+        void stop() {
+            {
+                std::unique_lock<std::mutex> lock(m);
+                if (!running) return;
+                running = false;
+            }
+            cv.notify_all();
+            if (reporter.joinable()) reporter.join();
+            if (endpoint.joinable()) endpoint.join();
+            if (server >= 0) close(server);
+            server = -1;
+            out.close();
+        }
+    };
+}
+
+#endif //HH_REPORTER_HPP
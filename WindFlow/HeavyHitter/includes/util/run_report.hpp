@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    run_report.hpp
+ *
+ *  @brief Machine-readable record of the configuration and of the measures of a run.
+ *
+ *  The record is appended to a csv file (the header is written when the file is empty) or, if
+ *  the file name ends with ".json", as a json line. The names of the configuration fields follow
+ *  the keys of the hh.properties files of the Flink, Storm and Spark versions of the application
+ *  (e.g. hh.source.threads becomes source_threads), so that the runs of all the engines can be
+ *  collected in the same table. All the records share the schema below, in its order: the runs of
+ *  a single process, of the nodes of a multi-node run and of its coordinator can be appended to the
+ *  same file, and the fields that do not apply to a record are left empty (null in json).
+ */
+
+#pragma once
+#ifndef HH_RUN_REPORT_HPP
+#define HH_RUN_REPORT_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+    /// fields of a record, in the order they are written
+    inline const std::vector<std::string> FIELDS = {
+        "engine", "input_file", "detection", "change_only", "load_s",
+        "source_threads", "flowid_threads", "acc_threads", "detector_threads", "sink_threads", "all_threads",
+        "chaining", "batch_len", "batch_slo_p99_ms", "win_len", "win_slide", "win_implementation",
+        "gpu_batch_len", "gpu_batch_fill_ms", "gen_rate", "threshold", "app_runtime_s", "warmup_s", "generations",
+        "measure_s", "elapsed_s", "sent_tuples", "received_tuples", "throughput", "source_max_emit_rate",
+        "latency_mean_ms", "latency_p50_ms", "latency_p99_ms", "latency_p999_ms", "latency_max_ms",
+        "cpu_util", "heavy_hitters", "query_syn", "query_ddos", "query_scan", "nodes", "missing_nodes",
+        "peak_rss_mb", "state_mb", "sampling", "sampling_kept", "sampling_error_pct",
+        "pages", "arena_peak_mb", "arena_fallbacks", "thp_mb",
+        "trace_residency_p50_ms", "trace_residency_p99_ms", "trace_processing_p50_ms", "trace_processing_p99_ms"
+    };
+
+    /**
+     * @class Run_Report
+     * @brief Fields describing a run, set by name and written in the order of FIELDS.
+     */
+    class Run_Report {
+    private:
+        std::vector<std::string> values;
+        std::vector<bool> set;          // fields given a value (the others are written empty)
+        std::vector<bool> quoted;       // string fields (quoted in json)
+
+        void put(const std::string& name, const std::string& value, const bool is_string) {
+            const auto it = std::find(FIELDS.begin(), FIELDS.end(), name);
+            if (it == FIELDS.end())
+                throw std::invalid_argument("[Run_Report] ERR: " + name + " is not a field of the report");
+            const std::size_t i = it - FIELDS.begin();
+            values[i] = value;
+            set[i] = true;
+            quoted[i] = is_string;
+        }
+
+        static std::string escape(const std::string& v) {
+            std::string e;
+            for (const char c : v) {
+                if (c == '"' || c == '\\') e += '\\';
+                e += c;
+            }
+            return e;
+        }
+
+    public:
+        Run_Report() : values(FIELDS.size()), set(FIELDS.size(), false), quoted(FIELDS.size(), false) {}
+
+        void add(const std::string& name, const std::string& value) {
+            put(name, value, true);
+        }
+
+        void add(const std::string& name, const char* value) {
+            add(name, std::string(value));
+        }
+
+        void add(const std::string& name, const bool value) {
+            put(name, (value) ? "true" : "false", false);
+        }
+
+        template<typename T>
+        void add(const std::string& name, const T value) {
+            std::ostringstream s;
+            s << value;
+            put(name, s.str(), false);
+        }
+
+        /**
+         * @brief Appends the record to a file.
+         *
+         * @param file output file (json lines if it ends with .json, csv otherwise)
+         */
+        void append(const std::string& file) const {
+            const bool json = (file.size() >= 5 && file.compare(file.size() - 5, 5, ".json") == 0);
+            bool empty;
+            {
+                std::ifstream in(file, std::ios::ate);
+                empty = !in.is_open() || in.tellg() == 0;
+            }
+            std::ofstream out(file, std::ios::app);
+            if (!out.is_open())
+                throw std::runtime_error("[Run_Report] ERR: cannot open the report file " + file);
+            if (json) {
+                out << "{";
+                for (std::size_t i = 0; i < FIELDS.size(); i++) {
+                    out << ((i > 0) ? "," : "") << "\"" << FIELDS[i] << "\":";
+                    if (!set[i]) out << "null";
+                    else if (quoted[i]) out << "\"" << escape(values[i]) << "\"";
+                    else out << values[i];
+                }
+                out << "}\n";
+                return;
+            }
+            if (empty) {
+                for (std::size_t i = 0; i < FIELDS.size(); i++) out << ((i > 0) ? "," : "") << FIELDS[i];
+                out << "\n";
+            }
+            for (std::size_t i = 0; i < FIELDS.size(); i++) {
+                const bool comma = values[i].find(',') != std::string::npos;
+                out << ((i > 0) ? "," : "") << ((comma) ? "\"" + escape(values[i]) + "\"" : values[i]);
+            }
+            out << "\n";
+        }
+    };
+}
+
+#endif //HH_RUN_REPORT_HPP
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    sampling.hpp
+ *
+ *  @brief Packet sampling of the ingest stream (1 in N packets, or 1 in N flows), with the error bounds of the scaled byte estimates.
+ *
+ *  With packet sampling every N-th packet of a source replica is kept, and its length is counted N
+ *  times by the flow identifier, so that the bytes of a flow are an unbiased estimate of the bytes
+ *  it carried and the threshold keeps its meaning. The estimate of a flow carrying B bytes sums N
+ *  times the lengths of about B / (N * L) samples, with L the mean length of the packets: its variance
+ *  is (N - 1) * B * L2 / L, with L2 the mean square length, so its error at 95% is within 1.96 times
+ *  its root (for packets of the same length, 1.96 / sqrt(samples) of B, as in sFlow). With flow sampling the
+ *  flows whose key hashes to 0 modulo N are kept with all their packets: their bytes are exact and
+ *  not scaled, but a heavy hitter is only found with probability 1 / N.
+ */
+
+#pragma once
+#ifndef HH_SAMPLING_HPP
+#define HH_SAMPLING_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include "util/registry.hpp"
+
+namespace sampling {
+
+    enum class mode_t { OFF, PACKET, FLOW };
+
+    constexpr uint32_t MAX_FRAME = 18 + UINT16_MAX;                 // largest length counted for a packet (IP length + Ethernet)
+    constexpr uint32_t MAX_RATE = UINT32_MAX / MAX_FRAME;           // 65519: the scaled lengths of the packets fit the 32 bits of total_len
+    constexpr double Z_95 = 1.96;
+
+    /// sampling of the run
+    struct spec_t {
+        mode_t mode = mode_t::OFF;
+        uint32_t rate = 1;      // 1 in rate packets or flows
+
+        bool enabled() const {
+            return mode != mode_t::OFF;
+        }
+
+        /// weight of the length of a kept packet
+        uint32_t weight() const {
+            return (mode == mode_t::PACKET) ? rate : 1;
+        }
+
+        std::string to_string() const {
+            if (!enabled()) return "off";
+            return std::string((mode == mode_t::PACKET) ? "packet:" : "flow:") + std::to_string(rate);
+        }
+    };
+
+    /**
+     * @brief Parses packet:N or flow:N.
+     *
+     * @return whether the spec is valid (N between 2 and MAX_RATE)
+     */
+    inline bool parse(const std::string& s, spec_t& spec) {
+        const std::size_t colon = s.find(':');
+        if (colon == std::string::npos) return false;
+        const std::string mode = s.substr(0, colon), rate = s.substr(colon + 1);
+        char* end = nullptr;
+        const unsigned long n = strtoul(rate.c_str(), &end, 10);
+        if (rate.empty() || *end != '\0' || n < 2 || n > MAX_RATE) return false;
+        if (mode == "packet") {
+            spec.mode = mode_t::PACKET;
+        } else if (mode == "flow") {
+            spec.mode = mode_t::FLOW;
+        } else {
+            return false;
+        }
+        spec.rate = (uint32_t)n;
+        return true;
+    }
+
+    /// sampling of the run (set before the operators are created)
+    inline spec_t spec;
+
+    /// whether a flow is kept by flow sampling (the hash is independent of the bits of the key used by the hash tables)
+    inline bool keeps_flow(const uint64_t flow_key, const uint32_t rate) {
+        uint64_t x = flow_key ^ 0x5bd1e9955bd1e995ULL;
+        x ^= x >> 31;
+        x *= 0x7fb5d329728ea185ULL;
+        x ^= x >> 27;
+        return x % rate == 0;
+    }
+
+    /**
+     * @class Outcome
+     * @brief Packets seen and kept by the samplers, and the error bounds of the estimates they give.
+     */
+    class Outcome {
+    private:
+        uint64_t seen = 0;
+        uint64_t kept = 0;
+        uint64_t kept_bytes = 0;        // unscaled
+        uint64_t kept_bytes_sq = 0;     // sum of the squares of the lengths
+
+    public:
+        /// sums the counters of the sampler replicas (at the end of the run)
+        void collect(const metrics::Registry& reg) {
+            seen = kept = kept_bytes = kept_bytes_sq = 0;
+            for (const metrics::Replica_Stats* s : reg.list()) {
+                if (s->op != "Sampler") continue;
+                seen += s->tuples_in.get();
+                kept += s->tuples_out.get();
+                kept_bytes += s->bytes_out.get();
+                kept_bytes_sq += s->bytes_sq_out.get();
+            }
+        }
+
+        /// mean length of the packets (bytes)
+        double mean_len() const {
+            return (kept > 0) ? (double)kept_bytes / kept : 0;
+        }
+
+        /// error at 95% of an estimate of bytes (0 if exact)
+        double bound(const uint64_t bytes) const {
+            if (spec.mode != mode_t::PACKET || kept_bytes == 0) return 0;
+            return Z_95 * std::sqrt((spec.rate - 1.0) * bytes * ((double)kept_bytes_sq / kept_bytes));
+        }
+
+        /// relative error at 95% of an estimate of bytes
+        double relative_bound(const uint64_t bytes) const {
+            return (bytes > 0) ? bound(bytes) / bytes : 0;
+        }
+
+        double kept_fraction() const {
+            return (seen > 0) ? (double)kept / seen : 0;
+        }
+
+        /**
+         * @brief Writes the sampling of the run and the error of its estimates.
+         *
+         * @param out output stream
+         * @param threshold threshold of the heavy hitters (bytes)
+         */
+        void write_summary(std::ostream& out, const uint64_t threshold) const {
+            const auto flags = out.flags();
+            const auto precision = out.precision();
+            out << std::fixed << std::setprecision(2);
+            out << "[SAMPLING] 1 in " << spec.rate << ((spec.mode == mode_t::PACKET) ? " packets" : " flows") << ": " << kept << " of " << seen
+                << " packets kept (" << kept_fraction() * 100 << "%), mean length " << mean_len() << " bytes\n";
+            if (spec.mode == mode_t::PACKET) {
+                out << "[SAMPLING] error of the estimated bytes at 95%: +/-" << relative_bound(threshold) * 100 << "% (+/-" << (uint64_t)bound(threshold)
+                    << " bytes) for a flow at the threshold, of each heavy hitter in the sink reports\n";
+            } else {
+                out << "[SAMPLING] the bytes of the flows kept are exact: each heavy hitter is found with probability " << 100.0 / spec.rate << "%\n";
+            }
+            out.flags(flags);
+            out.precision(precision);
+        }
+    };
+
+    /// outcome of the run (collected before the results are written)
+    inline Outcome outcome;
+}
+
+#endif //HH_SAMPLING_HPP
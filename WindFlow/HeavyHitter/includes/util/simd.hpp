@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    simd.hpp
+ *
+ *  @brief Kernels processing whole batches of tuple fields (structure of arrays layout).
+ *
+ *  The kernels are written with AVX2 and AVX-512 intrinsics when the application is compiled for
+ *  a target supporting them (see ARCH in the Makefile), and fall back to branch-free scalar loops
+ *  otherwise.
+ */
+
+#pragma once
+#ifndef HH_SIMD_HPP
+#define HH_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace simd {
+
+    /**
+     * @brief Computes the total length of a batch of packets from their IP length (network byte order).
+     *
+     * @param n number of packets
+     * @param ip_len IP total lengths (network byte order)
+     * @param total_len output total lengths (IP length plus 18 bytes of MAC header and CRC)
+     */
+    inline void lengths(const std::size_t n, const uint16_t* __restrict ip_len, uint32_t* __restrict total_len) {
+        std::size_t i = 0;
+#ifdef __AVX2__
+        const __m256i swap = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                              1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        const __m256i eth = _mm256_set1_epi32(18);
+        for (; i + 16 <= n; i += 16) {
+            const __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ip_len + i)), swap);
+            const __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v));
+            const __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(total_len + i), _mm256_add_epi32(lo, eth));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(total_len + i + 8), _mm256_add_epi32(hi, eth));
+        }
+#endif
+        for (; i < n; i++) {
+            total_len[i] = 18 + (uint16_t)((ip_len[i] >> 8) | (ip_len[i] << 8));
+        }
+    }
+
+    /**
+     * @brief Selects the elements of a batch above a threshold (compress-store of their indexes).
+     *
+     * @param n number of elements
+     * @param values values to compare
+     * @param threshold threshold
+     * @param idx output indexes of the selected elements (room for n indexes)
+     * @return number of selected elements
+     */
+    inline std::size_t select_above(const std::size_t n, const uint64_t* __restrict values, const uint64_t threshold,
+                                    uint32_t* __restrict idx) {
+        std::size_t i = 0, k = 0;
+#ifdef __AVX512F__
+        const __m512i thr = _mm512_set1_epi64((long long)threshold);
+        const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        for (; i + 16 <= n; i += 16) {
+            const __mmask8 lo = _mm512_cmpgt_epu64_mask(_mm512_loadu_si512(values + i), thr);
+            const __mmask8 hi = _mm512_cmpgt_epu64_mask(_mm512_loadu_si512(values + i + 8), thr);
+            const __mmask16 m = (__mmask16)(lo | (hi << 8));
+            _mm512_mask_compressstoreu_epi32(idx + k, m, _mm512_add_epi32(_mm512_set1_epi32((int)i), lanes));
+            k += __builtin_popcount(m);
+        }
+#endif
+        for (; i < n; i++) {
+            idx[k] = (uint32_t)i;
+            k += (values[i] > threshold);
+        }
+        return k;
+    }
+}
+
+#endif //HH_SIMD_HPP
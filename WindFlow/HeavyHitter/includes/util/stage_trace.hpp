@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file    stage_trace.hpp
+ *
+ *  @brief Sampled tracing of the tuples through the stages of the pipeline (per-stage latency breakdown).
+ *
+ *  A traced tuple is one of the latency-marked tuples (see tsc::Stamper), selected by a hash of its
+ *  timestamp: its record, in a table of slots indexed by the timestamp, is opened by the first
+ *  operator receiving the packet and is stamped by the following operator boundaries (arrival at
+ *  the accumulator, window close, detector), each recognizing the tuple by its timestamp. A window
+ *  result carries the timestamp of the last packet of its flow, so the record of that packet is
+ *  completed by the sink receiving the result, which splits the end-to-end latency into the hops
+ *  between the stamps and separates the time the packet waited for its window to close from the
+ *  time spent in processing and in the queues. The boundaries not visible to the operators (the
+ *  arrival at the windows kept by WindFlow, the close of the incremental and pane-based windows)
+ *  are merged in the next hop. A record overwritten by a newer traced tuple, or never reaching a
+ *  sink, is lost: the records are written without locks, and the incoherent ones are discarded.
+ */
+
+#pragma once
+#ifndef HH_STAGE_TRACE_HPP
+#define HH_STAGE_TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "util/histogram.hpp"
+#include "util/tsc_clock.hpp"
+
+namespace stage_trace {
+
+    /// operator boundaries stamped by the tracing (the source emission is the timestamp of the tuple)
+    enum stage_t { FLOWID = 0, ACC_IN, WINDOW_CLOSE, DETECTOR, NUM_STAGES };
+
+    inline const char* stage_name(const int s) {
+        static const char* names[] = {"flow id", "accumulator", "window close", "detector"};
+        if (s < 0) return "source";
+        return (s < NUM_STAGES) ? names[s] : "sink";
+    }
+
+    /**
+     * @class Tracer
+     * @brief Records of the traced tuples and breakdown of their latency, per sink replica.
+     */
+    class Tracer {
+    public:
+        static constexpr std::size_t SLOTS = 4096;
+
+    private:
+        struct alignas(64) slot_t {
+            std::atomic<uint64_t> key{0};                   // timestamp of the traced tuple (0 if free)
+            std::atomic<uint64_t> stamps[NUM_STAGES] = {};  // time of each boundary (0 if not seen)
+        };
+
+        /// latency breakdown of the records completed by a sink replica (nanoseconds)
+        struct breakdown_t {
+            std::map<std::pair<int, int>, metrics::Histogram> hops;     // from a stamp to the next one present
+            metrics::Histogram residency;       // up to the window close
+            metrics::Histogram processing;      // processing and queueing (end to end, minus the residency)
+            metrics::Histogram total;
+            uint64_t discarded = 0;
+        };
+
+        uint64_t period;                    // one marked tuple traced every period (0 if disabled)
+        std::unique_ptr<slot_t[]> slots;
+        std::vector<breakdown_t> sinks;
+
+        static uint64_t hash(const uint64_t ts) {
+            return ts * 0x9e3779b97f4a7c15ULL;
+        }
+
+        slot_t& slot_of(const uint64_t ts) {
+            return slots[hash(ts) >> 52];
+        }
+
+    public:
+        Tracer() : period(0) {}
+
+        /**
+         * @brief Enables the tracing (before the run).
+         *
+         * @param _period one latency-marked tuple traced every _period
+         * @param sink_replicas replicas of the sink
+         */
+        void configure(const uint64_t _period, const std::size_t sink_replicas) {
+            period = _period;
+            slots = std::make_unique<slot_t[]>(SLOTS);
+            sinks.clear();
+            sinks.resize(sink_replicas);
+        }
+
+        bool enabled() const {
+            return period > 0;
+        }
+
+        uint64_t get_period() const {
+            return period;
+        }
+
+        /// opens the record of a marked tuple, if it is selected for tracing
+        void begin(const uint64_t ts, const uint64_t now) {
+            if ((hash(ts) & 0xfffffffffULL) % period != 0) return;
+            slot_t& s = slot_of(ts);
+            s.key.store(0, std::memory_order_relaxed);
+            for (auto& st : s.stamps) st.store(0, std::memory_order_relaxed);
+            s.stamps[FLOWID].store(now, std::memory_order_relaxed);
+            s.key.store(ts, std::memory_order_release);
+        }
+
+        /// stamps a boundary of a traced tuple (the first crossing only)
+        void stamp(const stage_t stage, const uint64_t ts, const uint64_t now) {
+            slot_t& s = slot_of(ts);
+            if (s.key.load(std::memory_order_acquire) != ts) return;
+            if (s.stamps[stage].load(std::memory_order_relaxed) == 0) s.stamps[stage].store(now, std::memory_order_relaxed);
+        }
+
+        /// completes the record of a traced tuple received by a sink replica
+        void complete(const std::size_t sink, const uint64_t ts, const uint64_t now) {
+            slot_t& s = slot_of(ts);
+            if (s.key.load(std::memory_order_acquire) != ts) return;
+            uint64_t stamps[NUM_STAGES];
+            for (int i = 0; i < NUM_STAGES; i++) stamps[i] = s.stamps[i].load(std::memory_order_relaxed);
+            s.key.store(0, std::memory_order_relaxed);
+
+            breakdown_t& b = sinks[sink];
+            const uint64_t emit = ts & ~1ULL;
+            int prev = -1;
+            uint64_t prev_time = emit;
+            for (int i = 0; i <= NUM_STAGES; i++) {     // the stamps must follow the path of the tuple
+                const uint64_t t = (i < NUM_STAGES) ? stamps[i] : now;
+                if (t == 0) continue;
+                if (t < prev_time) {
+                    b.discarded++;
+                    return;
+                }
+                prev_time = t;
+            }
+            prev_time = emit;
+            uint64_t residency = 0;
+            for (int i = 0; i <= NUM_STAGES; i++) {
+                const uint64_t t = (i < NUM_STAGES) ? stamps[i] : now;
+                if (t == 0) continue;
+                b.hops[{prev, i}].record(t - prev_time);
+                if (i == WINDOW_CLOSE) residency = t - prev_time;
+                prev = i;
+                prev_time = t;
+            }
+            if (stamps[WINDOW_CLOSE] != 0) {     // otherwise the residency is hidden in one of the hops
+                b.residency.record(residency);
+                b.processing.record(now - emit - residency);
+            }
+            b.total.record(now - emit);
+        }
+
+        /**
+         * @brief Writes the percentiles of the latency breakdown of all the sink replicas (milliseconds).
+         *
+         * @param out output stream
+         */
+        void write_summary(std::ostream& out) const {
+            breakdown_t all;
+            for (const auto& b : sinks) {
+                for (const auto& h : b.hops) all.hops[h.first].merge(h.second);
+                all.residency.merge(b.residency);
+                all.processing.merge(b.processing);
+                all.total.merge(b.total);
+                all.discarded += b.discarded;
+            }
+            const auto flags = out.flags();
+            const auto precision = out.precision();
+            out << std::fixed << std::setprecision(3);
+            out << "[TRACE] latency breakdown of " << all.total.count() << " traced tuples (1 marked tuple every " << period
+                << ", " << all.discarded << " incoherent records discarded), ms (p50 / p90 / p99 / max):\n";
+            auto row = [&out](const std::string& name, const metrics::Histogram& h) {
+                out << "  " << std::left << std::setw(40) << name << std::right << std::setw(10) << h.count() << " tuples "
+                    << std::setw(10) << h.percentile(0.5) / 1e6 << " / " << std::setw(10) << h.percentile(0.9) / 1e6
+                    << " / " << std::setw(10) << h.percentile(0.99) / 1e6 << " / " << std::setw(10) << h.max() / 1e6 << "\n";
+            };
+            for (const auto& h : all.hops) {
+                const bool merged_close = (h.first.second == WINDOW_CLOSE && h.first.first != ACC_IN);
+                row(std::string(stage_name(h.first.first)) + " -> " + stage_name(h.first.second) + ((merged_close) ? " (+ queue)" : ""), h.second);
+            }
+            if (all.residency.count() > 0) {
+                row("window residency", all.residency);
+                row("processing and queueing", all.processing);
+            }
+            row("end to end", all.total);
+            out.flags(flags);
+            out.precision(precision);
+        }
+
+        /// percentile of the window residency and of the rest of the latency (milliseconds), for the run reports
+        double residency_percentile(const double p) const {
+            metrics::Histogram h;
+            for (const auto& b : sinks) h.merge(b.residency);
+            return h.percentile(p) / 1e6;
+        }
+
+        double processing_percentile(const double p) const {
+            metrics::Histogram h;
+            for (const auto& b : sinks) h.merge(b.processing);
+            return h.percentile(p) / 1e6;
+        }
+    };
+
+    /// tracer of the run
+    inline Tracer tracer;
+
+    /// opens the record of a tuple at the first operator receiving it
+    inline void begin(const uint64_t ts) {
+        if (tsc::marked(ts) && tracer.enabled()) tracer.begin(ts, tsc::now());
+    }
+
+    /// stamps an operator boundary of a tuple
+    inline void stamp(const stage_t stage, const uint64_t ts) {
+        if (tsc::marked(ts) && tracer.enabled()) tracer.stamp(stage, ts, tsc::now());
+    }
+
+    /// completes the record of a tuple at the sink
+    inline void complete(const std::size_t sink, const uint64_t ts) {
+        if (tsc::marked(ts) && tracer.enabled()) tracer.complete(sink, ts, tsc::now());
+    }
+}
+
+#endif //HH_STAGE_TRACE_HPP
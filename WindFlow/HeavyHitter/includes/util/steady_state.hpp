@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    steady_state.hpp
+ *
+ *  @brief Measurement interval excluding the warm-up and the drain phases of a run.
+ *
+ *  The interval [begin, end) is set before the topology starts, on the clock of the generation
+ *  timestamps of the tuples (tsc::now). The sinks only keep the latency of the tuples
+ *  generated inside it, and a fence thread reads the counters of the sources and of the sinks in
+ *  the registry at the two boundaries, so the throughput is computed on the steady-state phase
+ *  without adding any work to the replicas.
+ */
+
+#pragma once
+#ifndef HH_STEADY_STATE_HPP
+#define HH_STEADY_STATE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <sys/resource.h>
+#include "util/registry.hpp"
+
+namespace measure {
+
+    /// boundaries of the measurement interval (nanoseconds), written before the topology starts
+    inline uint64_t begin_ns = 0;
+    inline uint64_t end_ns = UINT64_MAX;
+
+    /// tells whether a tuple generated at the given time falls in the measurement interval
+    inline bool contains(const uint64_t ts) {
+        return ts >= begin_ns && ts < end_ns;
+    }
+
+    /**
+     * @class Steady_State
+     * @brief Thread reading the totals of the sources and of the sinks at the boundaries of the interval.
+     */
+    class Steady_State {
+    private:
+        /// totals read at a boundary
+        struct snapshot_t {
+            uint64_t ns = 0;
+            uint64_t sent = 0;
+            uint64_t received = 0;
+            double cpu = 0;                 // CPU time of the process (seconds)
+        };
+
+        const metrics::Registry& reg;
+        std::function<uint64_t()> clock;    // nanoseconds, same clock as begin_ns and end_ns
+        snapshot_t first;
+        snapshot_t last;
+        bool complete;                      // the end of the interval has been reached before the run ended
+        std::mutex m;
+        std::condition_variable cv;
+        bool running;
+        std::thread fence;
+
+        snapshot_t take() const {
+            snapshot_t s;
+            s.ns = clock();
+            s.sent = reg.total("Source").tuples_out;
+            s.received = reg.total("Sink").tuples_in;
+            struct rusage u;
+            getrusage(RUSAGE_SELF, &u);
+            s.cpu = u.ru_utime.tv_sec + u.ru_stime.tv_sec + (u.ru_utime.tv_usec + u.ru_stime.tv_usec) / 1e6;
+            return s;
+        }
+
+        /// waits until the clock reaches the given time, or the run ends (returns false)
+        bool wait(std::unique_lock<std::mutex>& lock, const uint64_t ns) {
+            while (running) {
+                const uint64_t now = clock();
+                if (now >= ns) return true;
+                cv.wait_for(lock, std::chrono::nanoseconds(std::min<uint64_t>(ns - now, 100000000)));
+            }
+            return false;
+        }
+
+        void fence_loop() {
+            std::unique_lock<std::mutex> lock(m);
+            if (!wait(lock, begin_ns)) return;
+            first = take();
+            complete = wait(lock, end_ns);
+            last = take();
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _reg registry of the counters
+         * @param _clock clock of the generation timestamps (nanoseconds)
+         */
+        Steady_State(const metrics::Registry& _reg, std::function<uint64_t()> _clock) :
+                reg(_reg), clock(std::move(_clock)), complete(false), running(false) {}
+
+        ~Steady_State() {
+            stop();
+        }
+
+        void start() {
+            running = true;
+            fence = std::thread(&Steady_State::fence_loop, this);
+        }
+
+        /**
+         * @brief Stops the fence at the end of the run (the interval is truncated if still open).
+         */
+        void stop() {
+            {
+                std::unique_lock<std::mutex> lock(m);
+                if (!running) return;
+                running = false;
+            }
+            cv.notify_all();
+            if (fence.joinable()) fence.join();
+        }
+
+        /// the end of the interval has been reached while the topology was running
+        bool is_complete() const {
+            return complete;
+        }
+
+        /// length of the measured interval (seconds, 0 if the run ended before the warm-up)
+        double seconds() const {
+            return (last.ns > first.ns) ? (last.ns - first.ns) / 1e9 : 0;
+        }
+
+        /// tuples generated by the sources in the interval
+        uint64_t sent() const {
+            return last.sent - first.sent;
+        }
+
+        /// tuples received by the sinks in the interval
+        uint64_t received() const {
+            return last.received - first.received;
+        }
+
+        /// busy cores on average in the interval
+        double cpu_util() const {
+            return (seconds() > 0) ? (last.cpu - first.cpu) / seconds() : 0;
+        }
+    };
+}
+
+#endif //HH_STEADY_STATE_HPP
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    trace.hpp
+ *
+ *  @brief Tracing level of the application, selected at run time.
+ *
+ *  The per-replica summaries printed at termination and the per-tuple debug prints used to be
+ *  compiled in with preprocessor flags. They are now always compiled and enabled by the level set
+ *  before the topology starts: the level never changes during the run, so the check in the hot path
+ *  is a load and a branch that is always predicted, and the same binary is used for every run.
+ */
+
+#pragma once
+#ifndef HH_TRACE_HPP
+#define HH_TRACE_HPP
+
+#include <string>
+
+namespace trace {
+
+    /// tracing levels (each level includes the previous ones)
+    enum class level_t {
+        OFF,            // measures and results only
+        SUMMARY,        // termination messages and totals of each operator replica
+        DEBUG           // every tuple received or sent by each replica, dataset and aggregation details
+    };
+
+    /// level of the run (set before the topology starts, read-only while it lasts)
+    inline level_t level = level_t::OFF;
+
+    /**
+     * @brief Parses the name of a tracing level.
+     *
+     * @param _name off, summary or debug
+     * @param _level level parsed from the name
+     * @return true if the name is valid
+     */
+    inline bool parse_level(const std::string& _name, level_t& _level) {
+        if (_name == "off") _level = level_t::OFF;
+        else if (_name == "summary") _level = level_t::SUMMARY;
+        else if (_name == "debug") _level = level_t::DEBUG;
+        else return false;
+        return true;
+    }
+
+    /// tells whether the termination summaries of the replicas are printed
+    inline bool summary() {
+        return __builtin_expect(level >= level_t::SUMMARY, 0);
+    }
+
+    /// tells whether the tuples are printed one by one
+    inline bool debug() {
+        return __builtin_expect(level == level_t::DEBUG, 0);
+    }
+}
+
+#endif //HH_TRACE_HPP
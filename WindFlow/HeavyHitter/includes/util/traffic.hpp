@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    traffic.hpp
+ *
+ *  @brief Synthetic traffic model: Zipf-distributed background flows and an optional attack.
+ *
+ *  The background traffic is made of a given number of flows, whose popularity follows a Zipf
+ *  law with the given exponent (0 is uniform); the ranks are drawn with the rejection-inversion
+ *  method of Hormann and Derflinger, in constant time and memory whatever the number of flows.
+ *  From the onset time a share of the packets belongs instead to a set of heavy flows, all
+ *  directed to the same victim host. The packet sizes are drawn from a discrete mix. Every
+ *  replica generates its own disjoint share of the flows (as the RX queues of a NIC would see
+ *  them) from a generator seeded with the seed of the run and the replica index, so that a run
+ *  can be reproduced exactly. The ranks of the global Zipf law are dealt to the replicas in turn
+ *  (rank r to replica r mod R), and each replica draws its ranks with their global weights, so the
+ *  popularity of the flows does not depend on the number of replicas. Since the replicas emit at
+ *  the same rate while their shares of the Zipf mass differ (the first replica holds the most
+ *  popular flow), the flows of a replica are scaled by 1 / (R * share): replica_shares gives the
+ *  smallest and largest share, reported in the summary of the run.
+ */
+
+#pragma once
+#ifndef HH_TRAFFIC_HPP
+#define HH_TRAFFIC_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <netinet/in.h>
+#include "tuples/hh_tuples.hpp"
+#include "util/flow.hpp"
+
+namespace traffic {
+
+    /// largest number of packet sizes in the mix
+    constexpr std::size_t MAX_SIZES = 16;
+
+    /**
+     * @brief Parameters of the synthetic traffic.
+     */
+    struct spec_t {
+        uint64_t flows = 100000;        // background flows (all the replicas)
+        double zipf = 1.0;              // exponent of the flow popularity
+        uint64_t heavy = 0;             // attack flows (0 disables the attack)
+        double attack = 0.5;            // share of the packets of the attack flows, after the onset
+        double onset = 0;               // start of the attack (seconds from the start of the run)
+        uint64_t seed = 1;
+        std::size_t num_sizes = 3;      // packet size mix (bytes on the wire, including the ethernet header)
+        uint16_t sizes[MAX_SIZES] = {64, 576, 1500};
+        double weights[MAX_SIZES] = {7, 4, 1};
+        std::size_t share = 0;          // share of the flows generated by this process, out of shares (multi-node runs)
+        std::size_t shares = 1;
+
+        [[nodiscard]] std::string to_string() const {
+            std::stringstream ss;
+            ss << flows << " flows (zipf " << zipf << "), sizes ";
+            for (std::size_t i = 0; i < num_sizes; i++) ss << ((i > 0) ? "/" : "") << sizes[i] << ":" << weights[i];
+            if (heavy > 0) ss << ", " << heavy << " attack flows (" << attack * 100 << "% of the packets after " << onset << " s)";
+            ss << ", seed " << seed;
+            return ss.str();
+        }
+    };
+
+    /**
+     * @brief Parses the description of the traffic.
+     *
+     * The description is a comma separated list of key=value pairs among flows, zipf, heavy,
+     * attack, onset, seed and sizes (size:weight pairs separated by '/', e.g. 64:7/576:4/1500:1).
+     *
+     * @param desc description of the traffic
+     * @return parameters of the traffic
+     */
+    inline spec_t parse(const std::string& desc) {
+        auto number = [](const std::string& key, const std::string& value) {
+            std::size_t end = 0;
+            double v = 0;
+            try {
+                v = std::stod(value, &end);
+            } catch (const std::logic_error&) {
+                end = 0;
+            }
+            if (end == 0 || end != value.size())
+                throw std::invalid_argument("[traffic] ERR: bad value for " + key + ": " + value);
+            return v;
+        };
+        spec_t s;
+        std::stringstream in(desc);
+        std::string item;
+        while (std::getline(in, item, ',')) {
+            if (item.empty()) continue;
+            const std::size_t eq = item.find('=');
+            if (eq == std::string::npos)
+                throw std::invalid_argument("[traffic] ERR: expected key=value, found " + item);
+            const std::string key = item.substr(0, eq);
+            const std::string value = item.substr(eq + 1);
+            if (key == "flows") s.flows = number(key, value);
+            else if (key == "zipf") s.zipf = number(key, value);
+            else if (key == "heavy") s.heavy = number(key, value);
+            else if (key == "attack") s.attack = number(key, value);
+            else if (key == "onset") s.onset = number(key, value);
+            else if (key == "seed") s.seed = number(key, value);
+            else if (key == "sizes") {
+                std::stringstream mix(value);
+                std::string entry;
+                s.num_sizes = 0;
+                while (std::getline(mix, entry, '/')) {
+                    if (s.num_sizes == MAX_SIZES)
+                        throw std::invalid_argument("[traffic] ERR: at most " + std::to_string(MAX_SIZES) + " packet sizes");
+                    const std::size_t colon = entry.find(':');
+                    const double size = number(key, entry.substr(0, colon));
+                    if (size < 64 || size > 1518)
+                        throw std::invalid_argument("[traffic] ERR: packet size must be in [64, 1518], found " + entry);
+                    s.sizes[s.num_sizes] = size;
+                    s.weights[s.num_sizes] = (colon == std::string::npos) ? 1 : number(key, entry.substr(colon + 1));
+                    s.num_sizes++;
+                }
+            }
+            else throw std::invalid_argument("[traffic] ERR: unknown key " + key);
+        }
+        if (s.flows == 0 || s.zipf < 0 || s.attack < 0 || s.attack > 1 || s.onset < 0 || s.num_sizes == 0)
+            throw std::invalid_argument("[traffic] ERR: invalid traffic description " + desc);
+        return s;
+    }
+
+    /**
+     * @class Rng
+     * @brief xoshiro256** pseudo-random generator.
+     */
+    class Rng {
+    private:
+        uint64_t s[4];
+
+        static uint64_t rotl(const uint64_t x, const int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+
+    public:
+        explicit Rng(uint64_t seed = 1) {
+            for (auto& w : s) {     // state filled with splitmix64
+                seed += 0x9e3779b97f4a7c15ULL;
+                w = flow::mix64(seed);
+            }
+        }
+
+        uint64_t next() {
+            const uint64_t r = rotl(s[1] * 5, 7) * 9;
+            const uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = rotl(s[3], 45);
+            return r;
+        }
+
+        /// uniform in [0, 1)
+        double uniform() {
+            return (next() >> 11) * 0x1.0p-53;
+        }
+    };
+
+    /**
+     * @class Zipf
+     * @brief Sampler of the Zipf distribution over the ranks 0..n-1 (rejection-inversion).
+     *
+     * The weight of rank k is (k + offset)^-exponent: with offset 1 it is the Zipf law itself, with
+     * offset (i + 1) / R the ranks k are the global ranks k * R + i of replica i of R.
+     */
+    class Zipf {
+    private:
+        uint64_t n;
+        double exponent;
+        double shift;               // offset - 1: rank k has the point k + 1 + shift of the hat
+        double h_integral_x1;
+        double h_integral_n;
+        double s;
+
+        static double helper1(const double x) {     // log1p(x) / x
+            return (std::abs(x) > 1e-8) ? std::log1p(x) / x : 1 - x * (0.5 - x * (1.0 / 3 - 0.25 * x));
+        }
+
+        static double helper2(const double x) {     // expm1(x) / x
+            return (std::abs(x) > 1e-8) ? std::expm1(x) / x : 1 + x * 0.5 * (1 + x / 3 * (1 + 0.25 * x));
+        }
+
+        double h(const double x) const {
+            return std::exp(-exponent * std::log(x));
+        }
+
+        double h_integral(const double x) const {
+            const double log_x = std::log(x);
+            return helper2((1 - exponent) * log_x) * log_x;
+        }
+
+        double h_integral_inverse(const double x) const {
+            double t = x * (1 - exponent);
+            if (t < -1) t = -1;
+            return std::exp(helper1(t) * x);
+        }
+
+    public:
+        Zipf(const uint64_t _n, const double _exponent, const double _offset = 1) :
+                n(std::max<uint64_t>(_n, 1)), exponent(_exponent), shift(std::min(std::max(_offset, 1e-9), 1.0) - 1) {
+            h_integral_x1 = h_integral(1.5 + shift) - h(1 + shift);
+            h_integral_n = h_integral(n + 0.5 + shift);
+            s = 2 + shift - h_integral_inverse(h_integral(2.5 + shift) - h(2 + shift));
+        }
+
+        /// draws a rank in [0, n) (0 is the most popular)
+        uint64_t sample(Rng& rng) const {
+            if (exponent == 0) return rng.next() % n;
+            while (true) {
+                const double u = h_integral_n + rng.uniform() * (h_integral_x1 - h_integral_n);
+                const double x = h_integral_inverse(u);
+                const double r = x - shift + 0.5;
+                uint64_t k = (r < 1) ? 1 : (uint64_t)r;
+                if (k > n) k = n;
+                if (k + shift - x <= s || u >= h_integral(k + 0.5 + shift) - h(k + shift)) return k - 1;
+            }
+        }
+    };
+
+    /**
+     * @brief Sum of (k + offset)^-exponent over k in [0, n) (exact for the first terms, then Euler-Maclaurin).
+     */
+    inline double zipf_mass(const uint64_t n, const double exponent, const double offset) {
+        constexpr uint64_t EXACT = 4096;
+        double sum = 0;
+        for (uint64_t k = 0; k < std::min(n, EXACT); k++) sum += std::pow(k + offset, -exponent);
+        if (n <= EXACT) return sum;
+        const double a = EXACT + offset, b = n - 1 + offset;       // tail: terms a .. b
+        const double integral = (exponent == 1) ? std::log(b / a) : (std::pow(b, 1 - exponent) - std::pow(a, 1 - exponent)) / (1 - exponent);
+        const double derivative = -exponent * (std::pow(b, -exponent - 1) - std::pow(a, -exponent - 1));
+        return sum + integral + (std::pow(a, -exponent) + std::pow(b, -exponent)) / 2 + derivative / 12;
+    }
+
+    /**
+     * @brief Smallest and largest share of the Zipf mass of the background flows held by a replica.
+     *
+     * @param spec parameters of the traffic
+     * @param replicas replicas of each process generating the traffic
+     * @return smallest and largest share (1 / R each with the uniform traffic)
+     */
+    inline std::pair<double, double> replica_shares(const spec_t& spec, const std::size_t replicas) {
+        const uint64_t all = std::max<std::size_t>(replicas, 1) * std::max<std::size_t>(spec.shares, 1);
+        double total = 0, low = 0, high = 0;
+        for (uint64_t i = 0; i < all; i++) {
+            const uint64_t own = (spec.flows + all - 1 - i) / all;
+            const double m = (own == 0) ? 0 : zipf_mass(own, spec.zipf, (double)(i + 1) / all);    // the global factor all^-zipf cancels out
+            total += m;
+            low = (i == 0) ? m : std::min(low, m);
+            high = std::max(high, m);
+        }
+        return (total > 0) ? std::make_pair(low / total, high / total) : std::make_pair(0.0, 0.0);
+    }
+
+    /**
+     * @class Generator
+     * @brief Generator of the packets of one replica.
+     */
+    class Generator {
+    private:
+        static constexpr uint32_t VICTIM = 0xc6336401;      // 198.51.100.1
+
+        spec_t spec;
+        std::size_t replica;
+        std::size_t replicas;
+        Rng rng;
+        Zipf background;            // ranks of the flows of this replica, with their global Zipf weights
+        uint64_t own_heavy;         // attack flows of this replica
+        double size_cdf[MAX_SIZES];
+        uint16_t ip_len[MAX_SIZES]; // IP length of each size (network representation)
+
+        uint16_t draw_size() {
+            const double u = rng.uniform();
+            std::size_t i = 0;
+            while (i + 1 < spec.num_sizes && u >= size_cdf[i]) i++;
+            return ip_len[i];
+        }
+
+        /// source address of a flow, kept out of 240.0.0.0/4 (the mark of the IPv6 pairs, see ip6::is_pair)
+        static uint32_t source(const uint64_t h) {
+            const uint32_t addr = (uint32_t)h;
+            return (ip6::is_pair(addr)) ? addr ^ htonl(0x80000000u) : addr;
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param _spec parameters of the traffic
+         * @param _replica index of the replica
+         * @param _replicas number of replicas generating the traffic
+         */
+        Generator(const spec_t& _spec, const std::size_t _replica, const std::size_t _replicas) :
+                spec(_spec),
+                replica(_spec.share * std::max<std::size_t>(_replicas, 1) + _replica),      // replicas of all the processes
+                replicas(std::max<std::size_t>(_replicas, 1) * std::max<std::size_t>(_spec.shares, 1)),
+                rng(flow::mix64(_spec.seed) ^ flow::mix64(replica + 1)),
+                background((_spec.flows + replicas - 1 - replica) / replicas, _spec.zipf, (double)(replica + 1) / replicas),
+                own_heavy((_spec.heavy + replicas - 1 - replica) / replicas) {
+            double total = 0;
+            for (std::size_t i = 0; i < spec.num_sizes; i++) total += spec.weights[i];
+            double cum = 0;
+            for (std::size_t i = 0; i < spec.num_sizes; i++) {
+                cum += spec.weights[i];
+                size_cdf[i] = cum / total;
+                ip_len[i] = htons(spec.sizes[i] - 18);
+            }
+        }
+
+        /**
+         * @brief Generates the next packet (the timestamp is left to the caller).
+         *
+         * @param attacking true if the attack has started
+         * @param p generated packet
+         */
+        void next(const bool attacking, packet_t& p) {
+            uint64_t id;
+            if (attacking && own_heavy > 0 && rng.uniform() < spec.attack) {
+                id = ~((rng.next() % own_heavy) * replicas + replica);      // attack flows
+                const uint64_t h = flow::mix64(id);
+                p.ip_src = source(h);
+                p.ip_dst = htonl(VICTIM);
+                p.port_src = (uint16_t)(h >> 32);
+                p.port_dst = htons(80);
+                p.protocol = 6;
+                p.syn = 1;
+                p.ip_len = htons(1500 - 18);
+                return;
+            }
+            id = background.sample(rng) * replicas + replica;       // global rank of a background flow (dealt to the replicas in turn)
+            const uint64_t h = flow::mix64(id ^ flow::mix64(spec.seed));
+            p.ip_src = source(h);
+            p.ip_dst = (uint32_t)(h >> 32);
+            const uint64_t ports = flow::mix64(h);
+            p.port_src = (uint16_t)ports;
+            p.port_dst = (uint16_t)(ports >> 16);
+            p.protocol = ((ports >> 32) & 3) ? 6 : 17;
+            p.syn = 0;
+            p.ip_len = draw_size();
+        }
+    };
+}
+
+#endif //HH_TRAFFIC_HPP
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/**
+ *  @file    tsc_clock.hpp
+ *
+ *  @brief Clock of the application (calibrated TSC) and latency markers of the sampled tuples.
+ *
+ *  On x86 processors with an invariant TSC the clock reads the time stamp counter and converts it
+ *  to nanoseconds with a scale calibrated against CLOCK_MONOTONIC at startup, which avoids the cost
+ *  of clock_gettime at every tuple. On the other machines it falls back to clock_gettime. All the
+ *  timestamps of the application (start time, tuple timestamps, measurement interval) come from
+ *  this clock, so they can be compared with each other.
+ *
+ *  The sources read the clock once every CLOCK_BATCH tuples and give the same timestamp to the
+ *  whole batch; one tuple every `sampling` is stamped with a fresh reading and marked by setting
+ *  the lowest bit of its timestamp. The sinks measure the latency of the marked tuples only, so
+ *  the cost of the measures does not grow with the throughput.
+ */
+
+#pragma once
+#ifndef HH_TSC_CLOCK_HPP
+#define HH_TSC_CLOCK_HPP
+
+#include <cstdint>
+#include <string>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace tsc {
+
+    /**
+     * @class Clock
+     * @brief Nanosecond clock reading the TSC when it is invariant, clock_gettime otherwise.
+     */
+    class Clock {
+    private:
+        bool use_tsc;
+        uint64_t base_tsc;
+        uint64_t base_ns;
+        uint64_t mult;          // nanoseconds per tick, 32.32 fixed point
+
+        static uint64_t monotonic_ns() {
+            struct timespec t;
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            return t.tv_sec * 1000000000ULL + t.tv_nsec;
+        }
+
+        static bool invariant_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007) return false;
+            __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+            return (edx >> 8) & 1;
+#else
+            return false;
+#endif
+        }
+
+    public:
+        Clock() : use_tsc(false), base_tsc(0), base_ns(0), mult(0) {}
+
+        /**
+         * @brief Calibrates the TSC against CLOCK_MONOTONIC (to be called before the threads of the application start).
+         *
+         * @param _ms length of the calibration interval (milliseconds)
+         */
+        void calibrate(const uint64_t _ms = 50) {
+#if defined(__x86_64__) || defined(__i386__)
+            if (!invariant_tsc()) return;
+            const uint64_t t0 = monotonic_ns();
+            const uint64_t c0 = __rdtsc();
+            uint64_t t1;
+            do {
+                t1 = monotonic_ns();
+            } while (t1 - t0 < _ms * 1000000ULL);
+            const uint64_t c1 = __rdtsc();
+            if (c1 <= c0) return;
+            mult = (uint64_t)(((unsigned __int128)(t1 - t0) << 32) / (c1 - c0));
+            base_tsc = c1;
+            base_ns = t1;
+            use_tsc = true;
+#else
+            (void)_ms;
+#endif
+        }
+
+        /**
+         * @brief Reads the clock.
+         *
+         * @return nanoseconds (same origin as CLOCK_MONOTONIC)
+         */
+        inline uint64_t now() const {
+#if defined(__x86_64__) || defined(__i386__)
+            if (use_tsc) return base_ns + (uint64_t)(((unsigned __int128)(__rdtsc() - base_tsc) * mult) >> 32);
+#endif
+            return monotonic_ns();
+        }
+
+        /**
+         * @brief Gets a description of the clock source.
+         */
+        std::string describe() const {
+            if (!use_tsc) return "clock_gettime (CLOCK_MONOTONIC)";
+            return "TSC (" + std::to_string(4294967296.0 / mult).substr(0, 4) + " GHz, calibrated on CLOCK_MONOTONIC)";
+        }
+    };
+
+    /// clock of the application
+    inline Clock clock_source;
+
+    /// reads the clock of the application (nanoseconds)
+    inline uint64_t now() {
+        return clock_source.now();
+    }
+
+    /// one tuple every `sampling` carries a latency marker (set before the run, 1 marks all the tuples)
+    inline uint32_t sampling = 64;
+
+    /// tells whether a timestamp carries a latency marker
+    inline bool marked(const uint64_t ts) {
+        return ts & 1;
+    }
+
+    /**
+     * @class Stamper
+     * @brief Timestamps of the tuples emitted by a source replica (batch-level readings and sampled markers).
+     */
+    class Stamper {
+    private:
+        uint64_t last;          // last reading of the clock
+        uint32_t count;         // tuples since the last marked one
+
+    public:
+        /// tuples stamped with the same reading of the clock
+        static constexpr uint32_t CLOCK_BATCH = 16;
+
+        Stamper() : last(0), count(0) {}
+
+        /**
+         * @brief Reads the clock (when the replica starts).
+         */
+        void start() {
+            last = now();
+        }
+
+        /**
+         * @brief Gets the last reading of the clock, used by the replica as its current time.
+         */
+        uint64_t time() const {
+            return last;
+        }
+
+        /**
+         * @brief Updates the current time with a reading taken elsewhere (e.g. by the pacer).
+         */
+        void refresh(const uint64_t _now) {
+            last = _now;
+        }
+
+        /**
+         * @brief Gets the timestamp of the next tuple.
+         *
+         * @return batch-level timestamp with the lowest bit cleared, or a fresh one with the lowest bit set (marked tuple)
+         */
+        inline uint64_t stamp() {
+            if (++count >= sampling) {
+                count = 0;
+                last = now();
+                return last | 1;
+            }
+            if ((count & (CLOCK_BATCH - 1)) == 0) last = now();
+            return last & ~(uint64_t)1;
+        }
+    };
+}
+
+#endif //HH_TSC_CLOCK_HPP
@@ -37,32 +37,142 @@
 #ifndef HH_UTIL_HPP
 #define HH_UTIL_HPP
 
+#include <algorithm>
+#include <cctype>
 #include <getopt.h>
+#include <glob.h>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace cli {
     /// manage command line options
     typedef enum {NONE, REQUIRED} opt_arg;    // an option can require one argument or none
 
+    /// options without a short form (values out of the range of the characters)
+    constexpr int PAGES = 256;
+    constexpr int SAMPLING = 257;
+
     const struct option long_opts[] = {
             {"help", NONE, 0, 'h'},
-            {"interface", REQUIRED, 0, 'i'},
+            {"input", REQUIRED, 0, 'i'},
+            {"interface", REQUIRED, 0, 'I'},
+            {"generate", REQUIRED, 0, 'G'},
+            {"queue", REQUIRED, 0, 'q'},
+            {"zero-copy", NONE, 0, 'z'},
+            {"stream", NONE, 0, 'S'},
+            {"prefetch", REQUIRED, 0, 'P'},
+            {"shard", REQUIRED, 0, 'D'},
+            {"loader-threads", REQUIRED, 0, 'y'},
+            {"pages", REQUIRED, 0, PAGES},
+            {"sampling", REQUIRED, 0, SAMPLING},
+            {"flow", REQUIRED, 0, 'f'},
+            {"preagg", REQUIRED, 0, 'g'},
+            {"acc", REQUIRED, 0, 'a'},
+            {"expected-flows", REQUIRED, 0, 'e'},
+            {"idle-timeout", REQUIRED, 0, 'o'},
+            {"gpu-batch", REQUIRED, 0, 'U'},
+            {"mode", REQUIRED, 0, 'm'},
+            {"sketch", REQUIRED, 0, 'k'},
+            {"hierarchy", REQUIRED, 0, 'H'},
+            {"top", REQUIRED, 0, 'K'},
             {"parallelism", REQUIRED, 0, 'p'},
             {"batch", REQUIRED, 0, 'b'},
             {"win", REQUIRED, 0, 'w'},
             {"slide", REQUIRED, 0, 's'},
             {"threshold", REQUIRED, 0, 't'},
+            {"rate", REQUIRED, 0, 'r'},
+            {"replay", REQUIRED, 0, 'R'},
+            {"event-time", REQUIRED, 0, 'E'},
+            {"live", REQUIRED, 0, 'L'},
+            {"live-output", REQUIRED, 0, 'O'},
+            {"prometheus", REQUIRED, 0, 'X'},
+            {"report", REQUIRED, 0, 'j'},
+            {"alerts", REQUIRED, 0, 'n'},
+            {"placement", REQUIRED, 0, 'A'},
+            {"backend", REQUIRED, 0, 'B'},
+            {"node", REQUIRED, 0, 'N'},
+            {"coordinator", REQUIRED, 0, 'C'},
+            {"duration", REQUIRED, 0, 'T'},
+            {"warmup", REQUIRED, 0, 'W'},
+            {"generations", REQUIRED, 0, 'Z'},
+            {"measure", REQUIRED, 0, 'M'},
+            {"latency-sampling", REQUIRED, 0, 'l'},
+            {"stage-trace", REQUIRED, 0, 'u'},
+            {"calibrate", REQUIRED, 0, 'x'},
+            {"queries", REQUIRED, 0, 'J'},
+            {"latency-slo", REQUIRED, 0, 'Q'},
+            {"shape", REQUIRED, 0, 'Y'},
+            {"trace", REQUIRED, 0, 'v'},
             {"chaining", NONE, 0, 'c'},
+            {"changes", NONE, 0, 'd'},
+            {"fused", NONE, 0, 'F'},
+            {"vectorized", NONE, 0, 'V'},
             {0, 0, 0, 0}
     };
 
     /// instructions to run the application
-    const std::string help = "Run Heavy Hitter with the following parameters:\n[ -i input ] " \
-                             "[ -p nSource,nFlowId,nWinAcc,nDetector,nSink ]  [ -b batch ] " \
-                             "[ -w win length ms ] [ -s win slide ms ] [ -c ]";
+    const std::string help = "Run Heavy Hitter with the following parameters:\n[ -i input[,input...] [ -S [ -P prefetch MB ] | -D range|hash ] [ -y loader threads ] | -I interface[:queue,...] [ -q first_queue ] [ -z ] | -G traffic ] [ --sampling packet|flow:N ] " \
+                             "[ -f 2tuple|5tuple|src|dst ] [ -g sub-interval ms ] [ -a nic|inc|ffat|table|gpu [ -e expected flows ] [ -o idle timeout ms ] [ -U gpu batch ] ] [ -m exact|sketch|hhh|topk|topk-dst [ -k width,depth ] [ -H src|dst ] [ -K k ] ] [ -p nSource,nFlowId,nWinAcc,nDetector,nSink ]  [ -b batch ] " \
+                             "[ -w win length ms ] [ -s win slide ms ] [ -t threshold ] [ -r rate | -R replay speed-up ] [ -E lateness ms ] [ -L interval ms [ -O file ] [ -X port ] ] [ -j report_file ] [ -n alert target ] [ -A placement ] [ --pages heap|thp|2m|1g ] [ -B wf|bare ] [ -N id/nodes@host:port ] [ -T run time s ] [ -Z generations ] [ -W warm-up s ] [ -M interval s ] [ -l latency sampling ] [ -u stage tracing ] [ -x cores[,run] ] [ -J query[:threshold[:win ms[:slide ms]]],... ] [ -Y full|source-sink ] [ -v off|summary|debug ] [ -c ] [ -d ] [ -F ] [ -V [ -Q p99 ms[,max batch[,flush ms]] ] ]\nRun the coordinator of a multi-node run with:\n-C nodes@port[:timeout s] [ -j report_file ] [ -v off|summary|debug ]";
 
     /// error message
     const std::string parsing_error = "Error in parsing input arguments. Use the --help option to see how to run the application.";
+
+    /**
+     * @brief Compares two names with the runs of digits compared as numbers (dump_q2 < dump_q10).
+     */
+    inline bool natural_less(const std::string& a, const std::string& b) {
+        std::size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (isdigit(a[i]) && isdigit(b[j])) {
+                const std::size_t ei = a.find_first_not_of("0123456789", i), ej = b.find_first_not_of("0123456789", j);
+                const std::string na = a.substr(i, ei - i), nb = b.substr(j, ej - j);
+                const std::size_t za = na.find_first_not_of('0'), zb = nb.find_first_not_of('0');
+                const std::string va = (za == std::string::npos) ? "" : na.substr(za), vb = (zb == std::string::npos) ? "" : nb.substr(zb);
+                if (va.size() != vb.size()) return va.size() < vb.size();
+                if (va != vb) return va < vb;
+                i = (ei == std::string::npos) ? a.size() : ei;
+                j = (ej == std::string::npos) ? b.size() : ej;
+                continue;
+            }
+            if (a[i] != b[j]) return a[i] < b[j];
+            i++;
+            j++;
+        }
+        return (a.size() - i) < (b.size() - j);
+    }
+
+    /**
+     * @brief Expands a comma separated list of input files, where each item can be a glob pattern.
+     *
+     * @param spec list of files or patterns (e.g. "dump_q*.pcap" or "a.pcap,b.pcap")
+     * @return files, in the order of the list (the matches of a pattern in natural order, so q2 comes before q10)
+     */
+    inline std::vector<std::string> expand_inputs(const std::string& spec) {
+        std::vector<std::string> files;
+        std::stringstream ss(spec);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (item.empty()) continue;
+            if (item.find_first_of("*?[") == std::string::npos) {
+                files.push_back(item);
+                continue;
+            }
+            glob_t g;
+            const int err = glob(item.c_str(), GLOB_NOSORT, nullptr, &g);
+            if (err == 0) {
+                std::vector<std::string> matches(g.gl_pathv, g.gl_pathv + g.gl_pathc);
+                std::sort(matches.begin(), matches.end(), natural_less);
+                files.insert(files.end(), matches.begin(), matches.end());
+            }
+            globfree(&g);
+            if (err != 0) throw std::invalid_argument("[cli] ERR: no input matches " + item);
+        }
+        if (files.empty()) throw std::invalid_argument("[cli] ERR: no input files in " + spec);
+        return files;
+    }
 }
 
 #endif //HH_UTIL_HPP
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+#
+# Regression suite of the Heavy Hitter application: runs hh.out on a fixed set of reference cases,
+# compares the heavy hitter reports of each case (heavy_hitters.txt and the report_sink*.txt files)
+# with the stored golden outputs, and its throughput and p99 latency (median of the repetitions,
+# from the -j record) with the stored baseline. Exits with status 1 on any regression.
+#
+# usage: regression.py config.json [ --update ] [ --results-only ] [ --case name ... ]
+
+import argparse
+import csv
+import glob
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+# performance measures of the baseline, and whether larger values are better
+MEASURES = {
+    "throughput": True,
+    "latency_p99_ms": False,
+}
+
+
+def absolute_args(args):
+    # the runs happen in a scratch directory: the existing files given as arguments keep pointing to them
+    return [os.path.abspath(a) if os.path.exists(a) else a for a in args]
+
+
+def normalize(path):
+    # header line kept in place, the entries sorted (the sinks write them in the order of their hash tables)
+    with open(path) as f:
+        lines = [line.rstrip("\n") for line in f if line.strip()]
+    head = [line for line in lines if line.startswith("[") or line.startswith("List of")]
+    return head + sorted(line for line in lines if line not in head)
+
+
+def outputs(workdir, merge_sinks):
+    # reports of a run: with several sinks replicas the results reach any of them, so their reports are merged
+    files = {}
+    for path in sorted(glob.glob(os.path.join(workdir, "heavy_hitters.txt")) + glob.glob(os.path.join(workdir, "report_*.txt"))):
+        files[os.path.basename(path)] = normalize(path)
+    if merge_sinks:
+        sinks = [name for name in files if name.startswith("report_sink")]
+        merged = sorted(line for name in sinks for line in files.pop(name) if not line.startswith("["))
+        if sinks:
+            files["report_sinks.txt"] = merged
+    return files
+
+
+def run_case(config, case, repeats):
+    cmd = [os.path.abspath(config.get("binary", "./hh.out"))] + absolute_args(config.get("args", []) + case.get("args", []))
+    records, files = [], None
+    for r in range(repeats):
+        with tempfile.TemporaryDirectory() as tmp:
+            report = os.path.join(tmp, "run.csv")
+            print("[%s, run %d/%d] %s" % (case["name"], r + 1, repeats, " ".join(cmd + ["-j", report])), flush=True)
+            try:
+                res = subprocess.run(cmd + ["-j", report], cwd=tmp, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE,
+                                     timeout=config.get("timeout"))
+                status = "ok" if res.returncode == 0 else "exit %d" % res.returncode
+            except subprocess.TimeoutExpired:
+                status = "timeout"
+            if status != "ok" or not os.path.exists(report):
+                return None, None, status
+            with open(report, newline="") as f:
+                records += list(csv.DictReader(f))
+            run_files = outputs(tmp, case.get("merge_sinks", False))
+            if files is not None and run_files != files:
+                return None, None, "results differ between the repetitions"
+            files = run_files
+    measures = {m: statistics.median(float(rec[m]) for rec in records) for m in MEASURES}
+    return files, measures, "ok"
+
+
+def compare_results(golden_dir, files):
+    errors = []
+    expected = {os.path.basename(p): p for p in glob.glob(os.path.join(golden_dir, "*.txt"))}
+    for name in sorted(set(expected) | set(files)):
+        if name not in files:
+            errors.append("%s not written" % name)
+        elif name not in expected:
+            errors.append("%s not in the golden outputs" % name)
+        else:
+            with open(expected[name]) as f:
+                golden = [line.rstrip("\n") for line in f]
+            missing = [line for line in golden if line not in files[name]]
+            extra = [line for line in files[name] if line not in golden]
+            if missing or extra:
+                errors.append("%s: %d entries missing, %d unexpected (e.g. %s)" % (name, len(missing), len(extra), (missing + extra)[0]))
+    return errors
+
+
+def compare_measures(baseline, measures, tolerance):
+    errors = []
+    for m, larger_better in MEASURES.items():
+        if m not in baseline:
+            continue
+        tol = float(tolerance.get(m, 0.1))
+        ref, value = float(baseline[m]), measures[m]
+        change = (value - ref) / ref if ref > 0 else 0
+        print("  %s: %.4g (baseline %.4g, %+.1f%%)" % (m, value, ref, change * 100))
+        if (larger_better and change < -tol) or (not larger_better and change > tol):
+            errors.append("%s %.4g is %.1f%% %s than the baseline %.4g (tolerance %.0f%%)"
+                          % (m, value, abs(change) * 100, "lower" if larger_better else "higher", ref, tol * 100))
+    return errors
+
+
+def store(golden_dir, files):
+    shutil.rmtree(golden_dir, ignore_errors=True)
+    os.makedirs(golden_dir)
+    for name, lines in files.items():
+        with open(os.path.join(golden_dir, name), "w") as f:
+            f.write("\n".join(lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Regression suite of the Heavy Hitter application")
+    parser.add_argument("config", help="json file with the binary, the common arguments, the tolerances and the cases")
+    parser.add_argument("--update", action="store_true", help="record the golden outputs and the baseline instead of checking them")
+    parser.add_argument("--results-only", action="store_true", help="check the golden outputs only (e.g. on a machine other than the baseline one)")
+    parser.add_argument("--case", action="append", help="run only the given case (repeatable)")
+    opts = parser.parse_args()
+
+    with open(opts.config) as f:
+        config = json.load(f)
+    golden_root = config.get("golden", "scripts/regression/golden")
+    baseline_file = config.get("baseline", "scripts/regression/baseline.json")
+    baseline = {}
+    if os.path.exists(baseline_file):
+        with open(baseline_file) as f:
+            baseline = json.load(f)
+    cases = [c for c in config.get("cases", []) if not opts.case or c["name"] in opts.case]
+    if not cases:
+        sys.exit("no cases to run")
+
+    failures = {}
+    for case in cases:
+        name = case["name"]
+        files, measures, status = run_case(config, case, int(config.get("repeats", 1)))
+        if files is None:
+            failures[name] = ["run failed (%s)" % status]
+            continue
+        golden_dir = os.path.join(golden_root, name)
+        if opts.update:
+            store(golden_dir, files)
+            baseline[name] = measures
+            print("  recorded %d reports, %s" % (len(files), ", ".join("%s %.4g" % kv for kv in measures.items())))
+            continue
+        if not os.path.isdir(golden_dir):
+            failures[name] = ["no golden outputs (record them with --update)"]
+            continue
+        errors = compare_results(golden_dir, files)
+        if not opts.results_only:
+            if name in baseline:
+                errors += compare_measures(baseline[name], measures, config.get("tolerance", {}))
+            else:
+                print("  no baseline for the case, performance not checked")
+        if errors:
+            failures[name] = errors
+
+    if opts.update:
+        os.makedirs(os.path.dirname(baseline_file) or ".", exist_ok=True)
+        with open(baseline_file, "w") as f:
+            json.dump(baseline, f, indent=4, sort_keys=True)
+            f.write("\n")
+    for name, errors in failures.items():
+        for e in errors:
+            print("[REGRESSION] %s: %s" % (name, e), file=sys.stderr)
+    print("%d cases, %d failed" % (len(cases), len(failures)))
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+#
+# Parameter sweep of the Heavy Hitter application: runs hh.out on every point of a grid of
+# configurations, repeating each point, and collects the records written by the -j option
+# (one row per run, with the point and repetition indexes) in a single csv or json lines file.
+#
+# usage: sweep.py config.json [ -o results.csv ] [ --dry-run ]
+
+import argparse
+import csv
+import itertools
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# grid dimensions and how they become command line options
+OPTIONS = {
+    "parallelism": lambda v: ["-p", str(v)],
+    "batch": lambda v: ["-b", str(v)],
+    "chaining": lambda v: ["-c"] if v else [],
+    "window": lambda v: ["-w", str(v).split(",")[0], "-s", str(v).split(",")[1]],
+    "rate": lambda v: ["-r", str(v)] if int(v) > 0 else [],
+    "threshold": lambda v: ["-t", str(v)],
+    "extra": lambda v: str(v).split(),
+}
+
+
+def points(grid):
+    names = list(grid.keys())
+    for name in names:
+        if name not in OPTIONS:
+            sys.exit("unknown grid dimension: " + name)
+    for values in itertools.product(*(grid[n] for n in names)):
+        yield dict(zip(names, values))
+
+
+def command(config, point, report):
+    cmd = [config.get("binary", "./hh.out")] + list(config.get("args", []))
+    for name, value in point.items():
+        cmd += OPTIONS[name](value)
+    return cmd + ["-j", report]
+
+
+def read_report(report):
+    rows = []
+    if not os.path.exists(report):
+        return rows
+    with open(report, newline="") as f:
+        for row in csv.DictReader(f):
+            rows.append(row)
+    return rows
+
+
+def write_results(output, rows):
+    if output.endswith(".json"):
+        with open(output, "w") as f:
+            for row in rows:
+                f.write(json.dumps(row) + "\n")
+        return
+    fields = []
+    for row in rows:
+        fields += [k for k in row if k not in fields]
+    with open(output, "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Parameter sweep of the Heavy Hitter application")
+    parser.add_argument("config", help="json file with the binary, the fixed arguments, the repetitions and the grid")
+    parser.add_argument("-o", "--output", default="sweep_results.csv", help="results file (json lines if it ends with .json)")
+    parser.add_argument("--dry-run", action="store_true", help="print the commands without running them")
+    opts = parser.parse_args()
+
+    with open(opts.config) as f:
+        config = json.load(f)
+    repeats = int(config.get("repeats", 1))
+    timeout = config.get("timeout")
+
+    rows = []
+    grid = list(points(config.get("grid", {})))
+    for p, point in enumerate(grid):
+        for r in range(repeats):
+            with tempfile.TemporaryDirectory() as tmp:
+                report = os.path.join(tmp, "run.csv")
+                cmd = command(config, point, report)
+                print("[%d/%d, run %d/%d] %s" % (p + 1, len(grid), r + 1, repeats, " ".join(cmd)), flush=True)
+                if opts.dry_run:
+                    continue
+                try:
+                    res = subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, timeout=timeout)
+                    status = "ok" if res.returncode == 0 else "exit %d" % res.returncode
+                except subprocess.TimeoutExpired:
+                    status = "timeout"
+                runs = read_report(report)
+                if not runs:
+                    print("  failed (%s), no report written" % status, file=sys.stderr)
+                    runs = [{"engine": "windflow"}]
+                for run in runs:
+                    run.update({"point": p, "repeat": r, "status": status})
+                    run.update({"grid_" + k: v for k, v in point.items()})
+                    rows.append(run)
+        if rows and not opts.dry_run:
+            write_results(opts.output, rows)     # partial results survive an interrupted sweep
+
+    if not opts.dry_run:
+        print("%d runs written to %s" % (len(rows), opts.output))
+
+
+if __name__ == "__main__":
+    main()
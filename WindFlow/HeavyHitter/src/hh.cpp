@@ -39,27 +39,60 @@
 #include <regex>
 #include <cstddef>
 #include <csignal>
+#include <sys/resource.h>
+#include <memory>
 #include <vector>
 #include <windflow.hpp>
 #include "nodes/source.hpp"
+#include "nodes/stream_source.hpp"
+#include "nodes/sharded_source.hpp"
+#include "nodes/generator_source.hpp"
+#ifdef HH_NETHUNS
+#include "nodes/live_source.hpp"
+#endif
 #include "nodes/flow_identifier.hpp"
+#include "nodes/sampler.hpp"
+#include "nodes/pre_aggregator.hpp"
 #include "nodes/accumulator.hpp"
 #include "nodes/detector.hpp"
+#include "nodes/sketch.hpp"
+#include "nodes/hhh.hpp"
+#include "nodes/fused.hpp"
+#include "nodes/topk.hpp"
+#include "nodes/query.hpp"
 #include "nodes/sink.hpp"
+#ifdef HH_GPU
+#include "nodes/gpu.hpp"
+#endif
+#include "bare/pipeline.hpp"
 #include "parser/pcap_parser.hpp"
+#include "parser/pcap_mmap_reader.hpp"
+#include "parser/trace_file.hpp"
+#include "parser/parallel_loader.hpp"
+#include "util/arena.hpp"
+#include "util/memory.hpp"
 #include "util/metric.hpp"
+#include "util/reporter.hpp"
+#include "util/pacer.hpp"
+#include "util/adaptive_batch.hpp"
+#include "util/calibrator.hpp"
+#include "util/cluster.hpp"
+#include "util/eos.hpp"
+#include "util/event_time.hpp"
 #include "util/hh_stats.hpp"
+#include "util/run_report.hpp"
+#include "util/stage_trace.hpp"
+#include "util/steady_state.hpp"
+#include "util/tsc_clock.hpp"
+#include "util/trace.hpp"
 #include "util/util.hpp"
 
 /// global variables (for input PCAP file parsing)
-std::vector<wf_tuple_t> dataset;            // dataset of all the tuples in memory
+packets_t dataset;                          // dataset of all the tuples in memory
 
 /// global variables (for performance metrics evaluation)
-std::atomic<long> sent_tuples;              // total number of tuples sent by all the sources
-std::atomic<long> received_tuples;          // total number of tuples received by all the sinks
 metrics::Metrics_Aggregator latency_aggr;   // aggregates the latency samples collected in each of the sink's replicas
-metrics::Atomic_Double source_exec_time;    // sum of the execution times (milliseconds) of all the source replicas
-metrics::Atomic_Double sink_exec_time;      // sum of the execution times (milliseconds) of all the sink replicas
+std::atomic<uint64_t> sketch_window_bytes;  // sum of the largest window volumes (bytes) counted by the sketch replicas
 volatile unsigned long app_start_time;
 volatile unsigned long app_run_time;
 
@@ -73,32 +106,286 @@ void exit_app(int exit_signal) {
     std::cout << "Signal handler: started app termination..." << std::endl;
 }
 
+/// coordinator of a multi-node run: merges the summaries of the nodes as the sink replicas of a single process
+int run_coordinator(const std::size_t nodes, const int port, const int timeout_s, const std::string& report_file) {
+    std::cout << "Coordinating " << nodes << " nodes on port " << port << "..." << std::endl;
+    std::vector<cluster::node_report_t> reports;
+    try {
+        reports = cluster::collect_reports(nodes, port, timeout_s);
+    } catch (const std::runtime_error& e) {
+        std::cout << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    latency_aggr.set_sink_replicas(nodes);
+    result_aggr.set_sink_replicas(nodes);
+    uint64_t sent = 0, received = 0, threads = 0;
+    double throughput = 0, cpu_util = 0, measured_s = 0;
+    for (auto& r : reports) {
+        std::cout << "[MEASURE] node " << r.node << ": throughput " << (int) r.throughput << " tuples/second, "
+                  << r.cpu_util << " cores, " << r.results.size() << " heavy hitter flows" << std::endl;
+        sent += r.sent;
+        received += r.received;
+        threads += r.threads;
+        throughput += r.throughput;     // the nodes run in parallel on disjoint shares of the traffic
+        cpu_util += r.cpu_util;
+        measured_s = std::max(measured_s, r.measured_s);
+        hh_stats::prefix_results = r.prefix_results;
+        for (const auto& [h, pair] : r.ip6_names) ip6::remember(h, pair.src.data(), pair.dst.data());
+        if (r.latencies.count() > 0) {
+            metrics::Metrics_Collector mc;
+            mc.set_sink(r.node);
+            mc.merge(r.latencies);
+            latency_aggr.add_collector(r.node, std::move(mc));
+        }
+        if (!r.results.empty()) {
+            hh_stats::Results_Collector rc;
+            rc.set_sink(r.node);
+            rc.get_collection() = std::move(r.results);
+            result_aggr.add_res_collector(r.node, std::move(rc));
+        }
+    }
+    std::cout << "[MEASURE] throughput: " << (int) throughput << " tuples/second (" << nodes << " nodes)" << std::endl;
+    std::cout << "[MEASURE] cpu utilisation: " << cpu_util << " cores" << std::endl;
+    const std::size_t hh_hosts = result_aggr.dump_aggregated();
+    const double latency = latency_aggr.dump();
+    const metrics::Histogram& lat_hist = latency_aggr.get_histogram();
+    std::cout << "[MEASURE] average latency: " << std::fixed << std::setprecision(5) << latency << " ms" <<  std::endl;
+    std::cout << "[MEASURE] latency percentiles: " << lat_hist.percentile(0.5) / 1000000.0 << " ms (p50), "
+              << lat_hist.percentile(0.99) / 1000000.0 << " ms (p99), "
+              << lat_hist.percentile(0.999) / 1000000.0 << " ms (p99.9), "
+              << lat_hist.max() / 1000000.0 << " ms (max)" << std::endl;
+    std::cout << "[RESULTS] heavy hitter hosts (no duplicates): " << hh_hosts << std::endl;
+    if (!report_file.empty()) {
+        bench::Run_Report report;
+        report.add("engine", "windflow");
+        report.add("nodes", nodes);
+        report.add("all_threads", threads);
+        report.add("measure_s", measured_s);
+        report.add("sent_tuples", sent);
+        report.add("received_tuples", received);
+        report.add("throughput", throughput);
+        report.add("latency_mean_ms", latency);
+        report.add("latency_p50_ms", lat_hist.percentile(0.5) / 1000000.0);
+        report.add("latency_p99_ms", lat_hist.percentile(0.99) / 1000000.0);
+        report.add("latency_p999_ms", lat_hist.percentile(0.999) / 1000000.0);
+        report.add("latency_max_ms", lat_hist.max() / 1000000.0);
+        report.add("cpu_util", cpu_util);
+        report.add("heavy_hitters", hh_hosts);
+        report.add("missing_nodes", nodes - reports.size());
+        report.append(report_file);
+    }
+    return (reports.size() == nodes) ? EXIT_SUCCESS : EXIT_FAILURE;    // the results of the missing nodes are lost
+}
+
 /// main
 int main(int argc, char* argv[]) {
     /// parse options from command line
     int option = 0;
     int index = 0;
     std::string input_pcap_file = "./dump.pcap";
+    std::vector<std::string> input_files;   // files of the input list (inputs i, i + nSource, ... are read by source replica i)
+    std::string interface;          // live capture from this network interface (replaces the input file)
+    std::string generate;           // description of the synthetic traffic (replaces the input file)
+    traffic::spec_t traffic_spec;
+    int first_queue = 0;
+    bool zero_copy = false;
+    bool streaming = false;         // read the input file on demand instead of pre-loading it in memory
+    std::size_t prefetch_mb = 64;   // size of the prefetch window of the streaming reader
+    std::string shard;              // split the dataset among the source replicas (range or hash, default each replica replays all of it)
+    std::size_t loader_threads = 0; // threads decoding a pcap input before the run (0 is one per online core)
+    flow::flow_def_t flow_def = flow::flow_def_t::TWO_TUPLE;   // fields identifying a flow
+    std::string acc_mode = "nic";   // window accumulator implementation (nic, inc, ffat, table, or gpu for the flow identifier and the windows on the GPU)
+    std::size_t expected_flows = 65536;     // initial size of the flow tables (all the accumulator replicas)
+    double idle_timeout_ms = 0;     // eviction of the idle flows from the flow tables (0 is the window length)
+    std::size_t gpu_batch = 16384;  // tuples per batch shipped to the GPU operators
+    double preagg_ms = 0;           // sub-interval of the partial aggregation of the flows before the window stage (0 disables it)
+    std::string detection = "exact";    // detection mode
+    bool sketch_mode = false;       // detect the heavy hitters in bounded memory with Count-Min sketches
+    std::string topk_mode;          // report the K largest flows of each window (global or dst) instead of all the heavy hitters
+    std::size_t topk = 10;
+    bool hhh_mode = false;          // detect the hierarchical heavy hitters over the IP prefixes
+    prefix::dim_t hhh_dim = prefix::dim_t::SRC;
+    std::size_t sketch_width = 4096;
+    std::size_t sketch_depth = 4;
     std::size_t source_pardeg = 0;
     std::size_t flowid_pardeg = 0;
     std::size_t winacc_pardeg = 0;
     std::size_t detector_pardeg = 0;
     std::size_t sink_pardeg = 0;
     bool chaining = false;
+    bool vectorized = false;        // batch versions of the flow identifier and of the detector
+    bool fused = false;             // single operator per source replica (run-to-completion) instead of the operator pipeline
+    bool change_only = false;       // the detector replicas keep their heavy hitters and forward only the changes of the set
+    std::string shape = "full";     // topology shape (full pipeline, or source-sink where the sink directly receives the packets)
     std::size_t batch_size = 0;
     std::size_t win_length = 0;
     std::size_t win_slide = 0;
-    int rate = 0;
+    int rate = 0;                   // global generation rate of all the source replicas (0 is full speed)
+    double replay = 0;              // replay the trace timestamps with this speed-up factor (0 disables the replay)
+    long lateness_ms = -1;          // windows driven by the capture timestamps with this allowed lateness (-1 is ingress time)
+    long live_ms = 0;               // interval of the live metrics reporter (0 disables it)
+    std::string live_file = "live_metrics.csv";
+    int prometheus_port = 0;        // serve the live metrics to Prometheus on this port (0 disables the endpoint)
+    std::string report_file;        // append the configuration and the measures of the run to this file
+    std::string alert_target;       // stream the heavy hitters to this file or network target while the application runs
+    std::string placement_spec;     // cores or NUMA nodes of the operator replicas (empty leaves the placement to the runtime)
+    std::string backend = "wf";     // runtime of the operators (wf, or bare for dedicated threads connected by Iffq rings)
+    double duration_s = 60;         // run time of the sources
+    double warmup_s = 0;            // initial phase excluded from the measures
+    int generations = 0;            // replays of the input by each source replica within the run time (0 is no limit)
+    double measure_s = -1;          // length of the measurement interval (-1 is until the end of the run)
+    long latency_sampling = 64;     // one tuple every latency_sampling carries a latency marker
+    adaptive::slo_t batch_slo;      // latency target of the adaptive batching (disabled by default)
+    long stage_trace_period = 0;    // one marked tuple every stage_trace_period is traced through the stages (0 disables the tracing)
+    calibrate::spec_t calibration;  // core budget of the calibration of the parallelism degrees (disabled by default)
+    std::vector<query::spec_t> queries;     // queries sharing the source and the flow identifier (none by default)
+    cluster::node_spec_t node;      // node of a multi-node run (processes its own share of the traffic)
+    std::size_t coordinator_nodes = 0;  // run as the coordinator of a multi-node run with this number of nodes
+    int coordinator_port = 0;
+    int coordinator_timeout = 60;       // longest wait of the coordinator for a summary, after the first one
     threshold = 0;
 
     /// parse command line options
     opterr = 1; // turn on/off getopt error messages
-    if (argc >= 7) {
-        while ((option = getopt_long(argc, argv, "i:p:b:w:s:r:t:c", cli::long_opts, &index)) != -1) {
+    const bool coordinator_call = (argc >= 3 && (std::string(argv[1]) == "-C" || std::string(argv[1]).rfind("--coordinator", 0) == 0));
+    if (argc >= 7 || coordinator_call) {
+        while ((option = getopt_long(argc, argv, "i:I:G:q:zSP:D:y:f:g:a:e:o:U:n:N:C:m:k:H:K:p:b:w:s:r:R:E:L:O:X:j:A:B:T:W:Z:M:l:u:x:J:Q:Y:v:t:cdFV", cli::long_opts, &index)) != -1) {
             switch (option) {
                 case 'i':       // pcap file to open (optional argument, default is ../dump.pcap)
                     input_pcap_file = optarg;
                     break;
+                case 'I':       // network interface to capture from (optional argument, default is reading the pcap file)
+                    interface = optarg;
+                    break;
+                case 'G':       // synthetic traffic (optional argument, default is reading the pcap file)
+                    generate = optarg;
+                    try {
+                        traffic_spec = traffic::parse(generate);
+                    } catch (const std::invalid_argument& e) {
+                        std::cout << e.what() << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'q':       // RX queue bound to the first source replica (optional argument, default 0)
+                    first_queue = atoi(optarg);
+                    break;
+                case 'z':       // request zero-copy live capture (optional argument, default disabled)
+                    zero_copy = true;
+                    break;
+                case 'S':       // stream the input file on demand (optional argument, default disabled)
+                    streaming = true;
+                    break;
+                case 'P':       // prefetch window of the streaming reader in MB (optional argument, default 64 MB)
+                    if (atol(optarg) <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    prefetch_mb = atol(optarg);
+                    break;
+                case 'D':       // shard the dataset among the source replicas (optional argument, range or hash)
+                    shard = optarg;
+                    if (shard != "range" && shard != "hash") {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'y':       // threads decoding a pcap input (optional argument, default one per online core)
+                    if (atol(optarg) <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    loader_threads = atol(optarg);
+                    break;
+                case cli::PAGES: {      // backing of the arena (optional argument, heap, thp, 2m or 1g, default heap)
+                    arena::pages_t pages;
+                    if (!arena::parse_pages(optarg, pages)) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    arena::blocks.configure(pages);     // before the dataset and the state of the operators are allocated
+                    break;
+                }
+                case cli::SAMPLING:     // sampling of the packets of the sources (optional argument, packet:N or flow:N, default disabled)
+                    if (!sampling::parse(optarg, sampling::spec)) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'f':       // flow definition (optional argument, 2tuple, 5tuple, src or dst, default 2tuple)
+                    if (!flow::parse_def(optarg, flow_def)) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'g':       // pre-aggregate the flows over sub-intervals of this length in ms (optional argument, default disabled)
+                    preagg_ms = atof(optarg);
+                    if (preagg_ms < 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'a':       // window accumulator implementation (optional argument, nic, inc, ffat, table or gpu, default nic)
+                    acc_mode = optarg;
+                    if (acc_mode != "nic" && acc_mode != "inc" && acc_mode != "ffat" && acc_mode != "table" && acc_mode != "gpu") {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'e':       // expected flows, initial size of the flow tables (optional argument, default 65536)
+                    expected_flows = atol(optarg);
+                    if (expected_flows == 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'o':       // idle timeout of the flows in the flow tables in ms (optional argument, default the window length)
+                    idle_timeout_ms = atof(optarg);
+                    if (idle_timeout_ms <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'U':       // tuples per batch shipped to the GPU operators (optional argument, default 16384)
+                    gpu_batch = atol(optarg);
+                    if (gpu_batch == 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'm': {     // heavy hitter detection mode (optional argument, exact or sketch, default exact)
+                    std::string mode(optarg);
+                    if (mode != "exact" && mode != "sketch" && mode != "hhh" && mode != "topk" && mode != "topk-dst") {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    detection = mode;
+                    sketch_mode = (mode == "sketch");
+                    hhh_mode = (mode == "hhh");
+                    topk_mode = (mode == "topk") ? "global" : (mode == "topk-dst") ? "dst" : "";
+                    break;
+                }
+                case 'K':       // flows reported per window in top-K mode (optional argument, default 10)
+                    topk = atol(optarg);
+                    if (topk == 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'H':       // address of the prefix hierarchy (optional argument, src or dst, default src)
+                    if (!prefix::parse_dim(optarg, hhh_dim)) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'k': {     // sketch size (optional argument, width,depth, default 4096,4)
+                    char* end = nullptr;
+                    sketch_width = strtoul(optarg, &end, 10);
+                    if (*end != ',' || sketch_width == 0 || (sketch_depth = strtoul(end + 1, &end, 10)) == 0 || *end != '\0') {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                }
                 case 'p': {     // operators parallelism (required)
                     std::vector<size_t> pardegs;
                     std::string pars(optarg);
@@ -132,9 +419,154 @@ int main(int argc, char* argv[]) {
                 case 'c':       // enable chaining (optional argument, default disabled)
                     chaining = true;
                     break;
+                case 'd':       // change-only detection (optional argument, default disabled)
+                    change_only = true;
+                    break;
+                case 'F':       // fused topology (optional argument, default disabled)
+                    fused = true;
+                    break;
+                case 'V':       // vectorized batch operators (optional argument, default disabled)
+                    vectorized = true;
+                    break;
                 case 'r':       // set up generation rate (optional argument, default full speed tuples/second)
                     rate = atoi(optarg);
                     break;
+                case 'R':       // replay the original inter-arrival times sped up by this factor (optional argument, default disabled)
+                    replay = atof(optarg);
+                    if (replay <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'E':       // event-time processing with the given allowed lateness in ms (optional argument, default ingress time)
+                    lateness_ms = atol(optarg);
+                    if (lateness_ms < 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'L':       // report the live metrics every given ms (optional argument, default disabled)
+                    live_ms = atol(optarg);
+                    if (live_ms <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'O':       // time series file of the live metrics (optional argument, default live_metrics.csv)
+                    live_file = std::string(optarg);
+                    break;
+                case 'X':       // port of the Prometheus endpoint (optional argument, default disabled)
+                    prometheus_port = atoi(optarg);
+                    if (prometheus_port <= 0 || prometheus_port > 65535) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'Z':       // generations of the input replayed by each source replica (optional argument, default until the end of the run time)
+                    generations = atoi(optarg);
+                    if (generations <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'T':       // run time in seconds (optional argument, default 60)
+                    duration_s = atof(optarg);
+                    if (duration_s <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'W':       // warm-up in seconds excluded from the measures (optional argument, default 0)
+                    warmup_s = atof(optarg);
+                    if (warmup_s < 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'M':       // measurement interval in seconds (optional argument, default until the end of the run)
+                    measure_s = atof(optarg);
+                    if (measure_s <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'l':       // one tuple every given number carries a latency marker (optional argument, default 64)
+                    latency_sampling = atol(optarg);
+                    if (latency_sampling <= 0 || latency_sampling > UINT32_MAX) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'u':       // per-stage latency breakdown of one marked tuple every given number (optional argument, default disabled)
+                    stage_trace_period = atol(optarg);
+                    if (stage_trace_period <= 0) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'x':       // calibration of the parallelism degrees, cores[,run] (optional argument, default disabled)
+                    try {
+                        calibration = calibrate::parse(optarg);
+                    } catch (const std::invalid_argument& e) {
+                        std::cout << e.what() << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'J':       // queries sharing the front end, name[:threshold[:win_ms[:slide_ms]]],... (optional argument, default none)
+                    try {
+                        queries = query::parse(optarg);
+                    } catch (const std::invalid_argument& e) {
+                        std::cout << e.what() << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'n':       // streaming output of the heavy hitters (optional argument, default disabled)
+                    alert_target = std::string(optarg);
+                    break;
+                case 'j':       // machine-readable report of the run (optional argument, default disabled)
+                    report_file = std::string(optarg);
+                    break;
+                case 'A':       // placement of the operator replicas (optional argument, default left to the runtime)
+                    placement_spec = std::string(optarg);
+                    break;
+                case 'B':       // runtime of the operators (optional argument, default wf)
+                    backend = std::string(optarg);
+                    if (backend != "wf" && backend != "bare") {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'Y':       // topology shape (optional argument, default full)
+                    shape = std::string(optarg);
+                    if (shape != "full" && shape != "source-sink") {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'v':       // tracing level (optional argument, default off)
+                    if (!trace::parse_level(optarg, trace::level)) {
+                        std::cout << cli::parsing_error << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'Q':       // adaptive batch sizes, p99_ms[,max_batch[,flush_ms]] (optional argument, default fixed batches)
+                    try {
+                        batch_slo = adaptive::parse_slo(optarg);
+                    } catch (const std::invalid_argument& e) {
+                        std::cout << e.what() << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
+                case 'N':       // node of a multi-node run, id/nodes@coordinator_host:port (optional argument, default single node)
+                case 'C':       // coordinator of a multi-node run, nodes@port (optional argument, default disabled)
+                    try {
+                        if (option == 'N') node = cluster::parse_node(optarg);
+                        else cluster::parse_coordinator(optarg, coordinator_nodes, coordinator_port, coordinator_timeout);
+                    } catch (const std::invalid_argument& e) {
+                        std::cout << e.what() << std::endl;
+                        exit(EXIT_FAILURE);
+                    }
+                    break;
                 case 't':
                     threshold = atol(optarg);
                     break;
@@ -154,128 +586,898 @@ int main(int argc, char* argv[]) {
         std::cout << cli::parsing_error << std::endl;
         exit(EXIT_FAILURE);
     }
+    if (coordinator_nodes > 0) {
+        return run_coordinator(coordinator_nodes, coordinator_port, coordinator_timeout, report_file);
+    }
+    if (warmup_s + std::max(measure_s, 0.0) >= duration_s) {
+        std::cout << "The warm-up and the measurement interval must end before the end of the run (-T)." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!generate.empty() && (!interface.empty() || streaming || !shard.empty() || replay > 0)) {
+        std::cout << "The synthetic traffic (-G) replaces the input: it cannot be used with -I, -S, -D or -R." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (interface.empty() && generate.empty()) {
+        try {
+            input_files = cli::expand_inputs(input_pcap_file);
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    const bool multi_input = (input_files.size() > 1);
+    if (multi_input && input_files.size() < source_pardeg) {
+        std::cout << "Each source replica needs its own input: " << input_files.size() << " inputs for " << source_pardeg << " source replicas." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (multi_input && !shard.empty()) {
+        std::cout << "Multiple inputs are already split among the source replicas: they cannot be used with -D." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+#ifdef HH_NETHUNS
+    try {
+        const std::size_t endpoints = Live_Source_Functor::parse_endpoints(interface).size();
+        if (endpoints > 0 && endpoints != source_pardeg) {
+            std::cout << "The capture list gives " << endpoints << " interface:queue pairs for " << source_pardeg << " source replicas." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cout << e.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+#endif
+    const bool bare_mode = (backend == "bare");
+    const bool two_ops = (shape == "source-sink");     // the sink directly receives the packets emitted by the sources
+    if (bare_mode && two_ops) {
+        std::cout << "The bare runtime (-B bare) is not available in the source-sink topology." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (bare_mode && (!interface.empty() || !generate.empty() || streaming || !shard.empty() || multi_input || lateness_ms >= 0
+                      || sketch_mode || hhh_mode || !topk_mode.empty() || fused || preagg_ms > 0 || chaining || vectorized)) {
+        std::cout << "The bare runtime (-B bare) replays a single input file in ingress time through the exact detection pipeline: it cannot be used with -I, -G, -S, -D, -E, -m, -g, -c, -F or -V." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (bare_mode) acc_mode = "inc";     // the bare runtime keeps the windows itself and runs the incremental accumulator
+    if (idle_timeout_ms <= 0) idle_timeout_ms = win_length;     // the idle flows have no bytes left in the window
+    if (!placement_spec.empty()) {
+        try {
+            placement::placement.configure(placement_spec, interface.substr(0, interface.find_first_of(":,")));
+        } catch (const std::exception& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (batch_slo.enabled() && !vectorized) {
+        std::cout << "The adaptive batching (-Q) resizes the batches of the batch operators at run time: it requires -V." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (fused && (sketch_mode || hhh_mode || !topk_mode.empty() || preagg_ms > 0)) {
+        std::cout << "The fused topology only supports the exact detection mode, without pre-aggregation." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (fused && interface.empty() && generate.empty() && shard != "hash") {
+        std::cout << "The fused topology (-F) needs each flow in a single source replica: a replayed input must be sharded by flow (-D hash), not by range or by input file." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (change_only && (two_ops || fused || vectorized || bare_mode || sketch_mode || hhh_mode || !topk_mode.empty())) {
+        std::cout << "The change-only detection (-d) keeps the heavy hitters in the exact detector: it cannot be used with -Y source-sink, -F, -V, -B bare or -m sketch|hhh|topk|topk-dst." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    const bool gpu_mode = (acc_mode == "gpu");
+#ifndef HH_GPU
+    if (gpu_mode) {
+        std::cout << "GPU offload is not available: rebuild the application with GPU=1." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+#endif
+    if (gpu_mode && (bare_mode || two_ops || fused || vectorized || sketch_mode || hhh_mode || preagg_ms > 0)) {
+        std::cout << "The GPU accumulator (-a gpu) runs the flow identifier and the windows of the exact or top-K detection: it cannot be used with -B bare, -Y source-sink, -F, -V, -g or -m sketch|hhh." << std::endl;
+        exit(EXIT_FAILURE);
+    }
 
-    /// performance metrics and results management
-    sent_tuples = 0;
-    received_tuples = 0;
-    latency_aggr.set_sink_replicas(sink_pardeg);
-    result_aggr.set_sink_replicas(sink_pardeg);
+    if (calibration.enabled() && (!interface.empty() || !generate.empty() || streaming || !shard.empty() || multi_input || two_ops || sketch_mode || hhh_mode
+                                  || !topk_mode.empty() || fused || preagg_ms > 0 || vectorized || (acc_mode != "nic" && acc_mode != "inc"))) {
+        std::cout << "The calibration (-x) profiles the exact detection pipeline on a single input file loaded in memory: it cannot be used with -I, -G, -S, -D, -Y source-sink, -m, -g, -a ffat|table|gpu, -F or -V." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (!queries.empty() && (bare_mode || two_ops || fused || gpu_mode || vectorized || preagg_ms > 0 || calibration.enabled())) {
+        std::cout << "The queries (-J) split the stream of the flow identifier: they cannot be used with -B bare, -Y source-sink, -F, -a gpu, -V, -g or -x." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (sampling::spec.enabled() && (bare_mode || two_ops || fused || gpu_mode || !queries.empty() || calibration.enabled())) {
+        std::cout << "The sampling (--sampling) is chained to the sources and scaled back in the flow identifier: it cannot be used with -B bare, -Y source-sink, -F, -a gpu, -J or -x." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (sampling::spec.mode == sampling::mode_t::FLOW && (hhh_mode || topk_mode == "dst")) {
+        std::cout << "The flow sampling (--sampling flow:N) keeps the bytes of the flows unscaled: it cannot be used with -m hhh or -m topk-dst, which aggregate or rank the flows together (use --sampling packet:N)." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    for (auto& q : queries) {       // the queries without their own windows take the ones of the heavy hitter pipeline
+        if (q.win_ms == 0) q.win_ms = win_length;
+        if (q.slide_ms == 0) q.slide_ms = std::min<std::size_t>(win_slide, q.win_ms);
+    }
+    if (calibration.enabled() && bare_mode && calibration.cores < calibrate::NUM_OPS) {
+        std::cout << "The bare runtime (-B bare) runs each replica on its own thread, without chaining: the calibration needs at least " << calibrate::NUM_OPS << " cores." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    /// data pre-processing (not needed when capturing live traffic)
+#ifndef HH_NETHUNS
+    if (!interface.empty()) {
+        std::cout << "Live capture is not available: rebuild the application with NETHUNS=<socket type>." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+#endif
+    const bool file_input = interface.empty() && generate.empty();
+    const bool trace_input = file_input && trace_file::is_trace_file(input_files[0]);   // pre-parsed trace (see pcap2trace)
+    for (const auto& f : input_files) {
+        if (trace_file::is_trace_file(f) != trace_input) {
+            std::cout << "The inputs must be all pcap files or all pre-parsed traces (" << f << ")." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    /// the IPv6 packets only carry the hash of their address pair (see ip6::hash), the analyses by address reject them
+    const bool by_address = hhh_mode || topk_mode == "dst" || !queries.empty() || flow_def == flow::flow_def_t::SRC || flow_def == flow::flow_def_t::DST;
+    for (const auto& f : input_files) {
+        if (by_address && trace_input && trace_file::ipv6_pairs(f) > 0) {
+            std::cout << "The input carries IPv6 packets, identified by the hash of their address pair: the analyses by address (-f src|dst, -m hhh|topk-dst, -J) only run on IPv4 traffic." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    /// multi-node run: a node keeps the packets of its own flows (of its own /8 prefixes, or destinations, if those are the units of detection)
+    auto share_key = [&](const packet_t& t) -> uint64_t {
+        if (hhh_mode) return prefix::key(hhh_dim, 8, ntohl((hhh_dim == prefix::dim_t::SRC) ? t.ip_src : t.ip_dst));
+        if (topk_mode == "dst") return t.ip_dst;
+        uint64_t k = 0;
+        flow::with_def(flow_def, [&](auto def) { k = flow::key<def>(t.ip_src, t.ip_dst, t.port_src, t.port_dst, t.protocol); });
+        return k;
+    };
+    traffic_spec.share = node.id;       // the generated flows are split among the replicas of all the nodes
+    traffic_spec.shares = (node.enabled()) ? node.nodes : 1;
+    const std::size_t loaders = loader::threads_of(loader_threads);
+    auto load_input = [trace_input, loaders, &node, &share_key](const std::string& file) {
+        auto keep = [&node, &share_key](const packet_t& p) { return !node.enabled() || node.owns(share_key(p)); };
+        if (!trace_input && loader::append_pcap(file, loaders, dataset, keep)) return;     // pcap of ethernet frames, decoded in parallel
+        std::vector<wf_tuple_t> parsed;
+        if (trace_input) {
+            parsed = trace_file::load(file);        // map the pre-parsed trace, no packet parsing needed
+        } else {
+            PcapTransformer pcap_tran(file);
+            //pcap_tran.toHumanReadableCsv(std::regex_replace(file, std::regex("pcap"), "csv")); // generate a human-readable csv file from the original pcap file
+            parsed = pcap_tran.toTupleDataset(-1);      // generate the entire tuple dataset from the original pcap file
+        }
+        dataset.reserve(dataset.size() + parsed.size() / ((node.enabled()) ? node.nodes : 1));    // keep only the fields of the packets used by the application
+        for (const auto& t : parsed) {
+            const packet_t p(t);
+            if (keep(p)) dataset.push_back(p);
+        }
+    };
+    const uint64_t load_start = tsc::now();
+    std::vector<std::size_t> input_offsets;     // first packet of the inputs of each source replica (multiple inputs)
+    if (file_input && !streaming && !multi_input) {
+        load_input(input_files[0]);
+    } else if (file_input && !streaming) {
+        for (std::size_t r = 0; r < source_pardeg; r++) {
+            const std::size_t first = dataset.size();
+            input_offsets.push_back(first);
+            for (std::size_t i = r; i < input_files.size(); i += source_pardeg) {
+                load_input(input_files[i]);
+            }
+            if (input_files.size() > source_pardeg) {     // several inputs of a replica are merged as a single queue would see them
+                std::stable_sort(dataset.begin() + first, dataset.end(), [](const packet_t& a, const packet_t& b) { return a.ts < b.ts; });
+            }
+        }
+        input_offsets.push_back(dataset.size());
+    }
+    memory::accounts.set("dataset", memory::bytes_of(dataset));
+    const double load_s = (tsc::now() - load_start) / 1e9;
+    if (by_address && ip6::seen) {
+        std::cout << "The input carries IPv6 packets, identified by the hash of their address pair: the analyses by address (-f src|dst, -m hhh|topk-dst, -J) only run on IPv4 traffic." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (by_address) ip6::accepted = false;      // the streamed and captured IPv6 packets are skipped by the parser
+    if (file_input && !streaming && trace::summary()) {
+        std::cout << "[LOAD] " << dataset.size() << " packets loaded in " << load_s << " s"
+                  << ((!trace_input) ? " (" + std::to_string(loaders) + " loader threads)" : "") << std::endl;
+    }
+
+    /// pacing of the sources: one token bucket shared by all the replicas, or replay of the capture timestamps
+    uint64_t trace_origin = 0, trace_span = 0;      // the inputs of all the replicas share the same time origin and span
+    if (!dataset.empty() && (replay > 0 || lateness_ms >= 0)) {
+        const auto [first, last] = std::minmax_element(dataset.begin(), dataset.end(), [](const packet_t& a, const packet_t& b) { return a.ts < b.ts; });
+        trace_origin = first->ts;
+        trace_span = last->ts - trace_origin;
+    }
+    pacer::Source_Pacer source_pacer = pacer::Source_Pacer::constant_rate(rate);
+    if (replay > 0) {
+        if (!interface.empty()) {
+            std::cout << "The replay mode requires an input trace, it cannot be used with live capture." << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        source_pacer = pacer::Source_Pacer::replay(replay, trace_origin, trace_span);
+    }
+
+    /// time policy: in event time the sources emit the capture timestamps and their watermarks (the generations are shifted by the span of the whole trace)
+    const bool event_mode = (lateness_ms >= 0);
+    event_time::Event_Clock source_clock(event_mode, (event_mode) ? lateness_ms * 1000 : 0, trace_span);
 
-    /// data pre-processing
-    PcapTransformer pcap_tran(input_pcap_file);
-    //pcap_tran.toHumanReadableCsv(std::regex_replace(input_pcap_file, std::regex("pcap"), "csv")); // generate a human-readable csv file from the original pcap file
-    dataset = pcap_tran.toTupleDataset(-1);         // generate the entire tuple dataset from the original pcap file
-    
     /// register termination signals SIGINT and SIGTERM
     signal(SIGINT, exit_app);
     signal(SIGTERM, exit_app);
 
-    /// application starting time and run time
-    app_start_time = wf::current_time_nsecs();    // nanoseconds
-    app_run_time = 60 * 1000000000L;              // 60 seconds
+    /// application starting time and run time (on the calibrated clock shared by all the functors)
+    tsc::clock_source.calibrate();
+    tsc::sampling = latency_sampling;
+
+    /// calibration of the parallelism degrees on a sample of the input (the run goes on with the proposed settings if asked)
+    if (calibration.enabled()) {
+        calibrate::profile_t profile;
+        try {
+            flow::with_def(flow_def, [&](auto def) { profile = calibrate::measure(dataset, FlowId_Functor<def>(), win_length * 1000000, win_slide * 1000000); });
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        metrics::registry.clear();      // the counters of the calibration are not part of the run
+        const calibrate::plan_t plan = calibrate::propose(profile, calibration.cores, !bare_mode);
+        calibrate::write_summary(std::cout, profile, plan);
+        if (!calibration.run) exit(EXIT_SUCCESS);
+        source_pardeg = plan.pardeg[calibrate::SOURCE];
+        flowid_pardeg = plan.pardeg[calibrate::FLOWID];
+        winacc_pardeg = plan.pardeg[calibrate::ACC];
+        detector_pardeg = plan.pardeg[calibrate::DETECTOR];
+        sink_pardeg = plan.pardeg[calibrate::SINK];
+        batch_size = plan.batch;
+        chaining = plan.chaining;
+    }
+
+    /// performance metrics and results management
+    sketch_window_bytes = 0;
+    latency_aggr.set_sink_replicas(sink_pardeg);
+    result_aggr.set_sink_replicas(sink_pardeg);
+    memory::accounts.set("latency histograms", (sink_pardeg + 1) * sizeof(metrics::Histogram));     // one per sink replica, and the merged one
+    if (stage_trace_period > 0) stage_trace::tracer.configure(stage_trace_period, sink_pardeg);
+    if (!alert_target.empty()) {
+        try {
+            alerts::writer.configure(alert_target, sink_pardeg);
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /// largest emission rate of a source replica replaying the dataset (bulk emission, without the runtime)
+    const bool dataset_source = file_input && !streaming && !multi_input && shard.empty();
+    const double source_max_rate = (dataset_source) ? Source_Functor::max_emit_rate(dataset) : 0;
+
+    app_start_time = tsc::now();    // nanoseconds
+    app_run_time = duration_s * 1000000000L;
+
+    /// steady-state measurement interval (the whole run if neither a warm-up nor an interval is given)
+    const bool fenced = (warmup_s > 0 || measure_s > 0);
+    if (fenced) {
+        measure::begin_ns = app_start_time + (uint64_t)(warmup_s * 1e9);
+        measure::end_ns = (measure_s > 0) ? measure::begin_ns + (uint64_t)(measure_s * 1e9) : app_start_time + app_run_time;
+    }
 
     Source_Functor::terminate = false;
+    Source_Functor::max_generations = generations;
+
+    /// bare runtime: the functors of the pipeline on dedicated threads connected by Iffq rings (the topology below is built but not run)
+    std::unique_ptr<bare::Pipeline> bare_pipeline;
+    if (bare_mode) {
+        try {
+            flow::with_def(flow_def, [&](auto def) {
+                bare_pipeline = std::make_unique<bare::Pipeline>(dataset, source_pacer, FlowId_Functor<def>(), WinAcc_Inc_Functor(), Detector_Functor(), Sink_Functor<hh_result_t>(),
+                                                                 bare::Pipeline::pardeg_t{source_pardeg, flowid_pardeg, winacc_pardeg, detector_pardeg, sink_pardeg},
+                                                                 win_length * 1000000UL, win_slide * 1000000UL);
+            });
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
 
     /// create nodes and topology
-    wf::PipeGraph topology("HeavyHitter", wf::Execution_Mode_t::DEFAULT, wf::Time_Policy_t::INGRESS_TIME);
-
-    Source_Functor source_fun(dataset, rate);           // source operator
-    wf::Source source = wf::Source_Builder(source_fun)
-            .withParallelism(source_pardeg)
-            .withName("Source")
-            .withOutputBatchSize(batch_size)
-            .build();
-    wf::MultiPipe &mp = topology.add_source(source);
-
-    FlowId_Functor flowid_fun;                             // flow identifier operator
-    wf::Map flowid = wf::Map_Builder(flowid_fun)
-            .withParallelism(flowid_pardeg)
-            .withName("FlowIdentifier")
-            .withOutputBatchSize(batch_size)
-            .build();
-
-    WinAcc_Functor winacc_fun;                             // per-flow byte length accumulator
-    wf::Keyed_Windows win_acc = wf::Keyed_Windows_Builder(winacc_fun)
-            .withParallelism(winacc_pardeg)
-            .withName("ByteLenAccumulator")
-            .withKeyBy([](const wf_tuple_t& t) -> unsigned long { return t.flow_key; })     // stream is logically partitioned on keys (flow id)
-            .withTBWindows(std::chrono::microseconds(win_length * 1000), std::chrono::microseconds(win_slide * 1000))
-            .withOutputBatchSize(batch_size)
-            .build();
-#ifndef TWO_OPS
-    mp.add(flowid);
-    mp.add(win_acc);
-#endif
+    wf::PipeGraph topology("HeavyHitter", wf::Execution_Mode_t::DEFAULT,
+                           (event_mode) ? wf::Time_Policy_t::EVENT_TIME : wf::Time_Policy_t::INGRESS_TIME);
 
-    if (!chaining) {        // chaining disabled
-        Detector_Functor detector_fun;                     // heavy hitter detector operator (batching enabled)
-        wf::Filter detector = wf::Filter_Builder(detector_fun)
-                .withParallelism(detector_pardeg)
-                .withName("HeavyHitterDetector")
+    wf::MultiPipe *source_mp = nullptr;
+#ifdef HH_NETHUNS
+    if (!interface.empty()) {
+        Live_Source_Functor source_fun(interface, first_queue, zero_copy, source_clock);     // live capture source operator
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
                 .withOutputBatchSize(batch_size)
                 .build();
-#ifndef TWO_OPS
-        mp.add(detector);
+        source_mp = &topology.add_source(source);
+    }
 #endif
-        Sink_Functor sink_fun;                             // sink operator (added to the multipipe)
-        wf::Sink sink = wf::Sink_Builder(sink_fun)
-                .withParallelism(sink_pardeg)
-                .withName("Sink")
+    if (source_mp == nullptr && !generate.empty()) {
+        Generator_Source_Functor source_fun(traffic_spec, source_pacer, source_clock);     // synthetic traffic source operator
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
                 .build();
-        mp.add_sink(sink);
-    } else {        // chaining enabled
-        Detector_Functor detector_fun;                     // heavy hitter detector operator (batching disabled)
+        source_mp = &topology.add_source(source);
+    }
+    if (source_mp == nullptr && streaming && trace_input) {
+        std::vector<trace_file::Trace_Mmap_Reader> readers;
+        for (const auto& f : input_files) readers.emplace_back(f);
+        Stream_Source_Functor<trace_file::Trace_Mmap_Reader> source_fun(readers, source_pacer, source_clock);   // streaming source operator (pre-parsed traces)
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
+                .build();
+        source_mp = &topology.add_source(source);
+    }
+    if (source_mp == nullptr && streaming) {
+        std::vector<Pcap_Mmap_Reader> readers;
+        for (const auto& f : input_files) readers.emplace_back(f, prefetch_mb << 20);
+        Stream_Source_Functor<Pcap_Mmap_Reader> source_fun(readers, source_pacer, source_clock);   // streaming source operator
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
+                .build();
+        source_mp = &topology.add_source(source);
+    }
+    if (source_mp == nullptr && multi_input) {
+        Sharded_Source_Functor source_fun(dataset, input_offsets, source_pacer, source_clock);     // one set of inputs per source replica
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
+                .build();
+        source_mp = &topology.add_source(source);
+    }
+    if (source_mp == nullptr && !shard.empty()) {
+        Sharded_Source_Functor source_fun(dataset, (shard == "hash") ? shard_policy_t::HASH : shard_policy_t::RANGE, source_pacer, source_clock, flow_def);   // sharded source operator
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
+                .build();
+        source_mp = &topology.add_source(source);
+    }
+    if (source_mp == nullptr) {
+        Source_Functor source_fun(dataset, source_pacer, source_clock);       // source operator
+        wf::Source source = wf::Source_Builder(source_fun)
+                .withParallelism(source_pardeg)
+                .withName("Source")
+                .withOutputBatchSize(batch_size)
+                .build();
+        source_mp = &topology.add_source(source);
+    }
+    wf::MultiPipe* pipe = source_mp;              // heavy hitter pipeline (the first branch when the stream is split among the queries)
+    if (sampling::spec.enabled()) {
+        flow::with_def(flow_def, [&](auto def) {
+            Sampler_Functor<def> sampler_fun(sampling::spec);     // packet or flow sampling (chained to the source)
+            wf::Filter sampler = wf::Filter_Builder(sampler_fun)
+                    .withParallelism(source_pardeg)
+                    .withName("Sampler")
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->chain(sampler);
+        });
+    }
+    std::size_t last_pardeg = source_pardeg;        // parallelism of the operator preceding the sink
+    const std::size_t vector_batch = (batch_size > 0) ? batch_size : 64;    // tuples per batch of the vectorized operators
+    const adaptive::Batch_Controller vector_batcher = (batch_slo.enabled()) ? adaptive::Batch_Controller(batch_slo)
+                                                                            : adaptive::Batch_Controller(vector_batch);
+    const bool table_mode = !sketch_mode && !hhh_mode && acc_mode == "table";     // the window stage is a FlatMap on the flow table
+    if (!two_ops && !fused && (vectorized || preagg_ms > 0 || sketch_mode || hhh_mode || table_mode)) {    // the sources end with a marker flushing the partial batches, sums and windows (see eos.hpp)
+        eos::plan.sources = source_pardeg;
+        eos::plan.flowid = flowid_pardeg;
+        eos::plan.keyed = (sketch_mode || hhh_mode || table_mode) ? winacc_pardeg : 0;
+        eos::plan.preagg = preagg_ms > 0;
+        eos::plan.idle_ns = batch_slo.flush_ns;   // and a flush marker when they are idle for the flush timeout
+    }
+
+    /// branch of a query: windows on its own key, detector and sink (see query.hpp)
+    auto add_query = [&](wf::MultiPipe& branch, const query::spec_t& q) {
+        const std::string name = query::op_name(q.kind);
+        const auto win = std::chrono::microseconds(q.win_ms * 1000);
+        const auto slide = std::chrono::microseconds(q.slide_ms * 1000);
+        if (q.kind == query::kind_t::SCAN) {
+            Scan_Acc_Functor acc_fun;                          // distinct destinations of the SYN packets of each source
+            wf::Keyed_Windows acc = wf::Keyed_Windows_Builder(acc_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName(name + "Accumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.ip_src; })      // stream is partitioned on the sources
+                    .withTBWindows(win, slide)
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            branch.add(acc);
+        } else {
+            Query_Acc_Functor acc_fun(q.kind);                 // SYN packets or bytes of each destination (incremental)
+            wf::Keyed_Windows acc = wf::Keyed_Windows_Builder(acc_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName(name + "Accumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.ip_dst; })      // stream is partitioned on the destinations
+                    .withTBWindows(win, slide)
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            branch.add(acc);
+        }
+        Query_Detector_Functor detector_fun(q);                // keys above the threshold of the query
         wf::Filter detector = wf::Filter_Builder(detector_fun)
                 .withParallelism(detector_pardeg)
-                .withName("HeavyHitterDetector")
+                .withName(name + "Detector")
+                .withOutputBatchSize((chaining) ? 0 : batch_size)
+                .build();
+        branch.add(detector);
+        Query_Sink_Functor sink_fun(q.kind);                   // peaks of the reported keys
+        wf::Sink sink = wf::Sink_Builder(sink_fun)
+                .withParallelism(sink_pardeg)
+                .withName(name + "Sink")
                 .build();
-#ifndef TWO_OPS
-        mp.add(detector);
+        if (chaining) {
+            branch.chain_sink(sink);
+        } else {
+            branch.add_sink(sink);
+        }
+    };
+
+    /// the operators computing the flow keys are specialised on the flow definition (FlowId_Functor<def>, ...)
+    if (two_ops) {
+        /// source-sink topology: the sink directly receives the packets emitted by the sources
+    } else if (fused) {
+        flow::with_def(flow_def, [&](auto def) {
+            Fused_Functor<def> fused_fun(win_length * 1000, win_slide * 1000);   // whole processing of each replica share (chained to the source)
+            wf::FlatMap fused_op = wf::FlatMap_Builder(fused_fun)
+                    .withParallelism(source_pardeg)
+                    .withName("FusedHeavyHitter")
+                    .withOutputBatchSize((chaining) ? 0 : batch_size)
+                    .build();
+            pipe->chain(fused_op);
+        });
+    } else {
+        last_pardeg = detector_pardeg;
+        flow::with_def(flow_def, [&](auto def) {
+            if (gpu_mode) {
+#ifdef HH_GPU
+                GPU_Stage_Functor stage_fun;                  // conversion to the GPU tuples (chained to the source)
+                wf::Map stage = wf::Map_Builder(stage_fun)
+                        .withParallelism(source_pardeg)
+                        .withName("GPUStage")
+                        .withOutputBatchSize(gpu_batch)
+                        .build();
+                pipe->chain(stage);
+                FlowId_GPU_Functor<def> flowid_gpu_fun;       // flow identifier operator (one GPU thread per packet)
+                wf::Map_GPU flowid_gpu = wf::Map_GPU_Builder(flowid_gpu_fun)
+                        .withParallelism(flowid_pardeg)
+                        .withName("FlowIdentifier")
+                        .build();
+                pipe->add(flowid_gpu);
 #endif
-        Sink_Functor sink_fun;                             // sink operator (chained to the detector in the multipipe)
+            } else if (vectorized) {
+                FlowId_Batch_Functor<def> flowid_batch_fun(vector_batcher);     // flow identifier operator (batch version)
+                wf::FlatMap flowid_batch = wf::FlatMap_Builder(flowid_batch_fun)
+                        .withParallelism(flowid_pardeg)
+                        .withName("FlowIdentifier")
+                        .withKeyBy([](const packet_t& t) -> unsigned long { return eos::flowid_key(t); })   // spread evenly, the markers to their replica
+                        .withOutputBatchSize(batch_size)
+                        .build();
+                pipe->add(flowid_batch);
+            } else if (eos::plan.enabled()) {
+                FlowId_Functor<def> flowid_fun;                   // flow identifier operator (receiving the markers of the sources)
+                wf::Map flowid = wf::Map_Builder(flowid_fun)
+                        .withParallelism(flowid_pardeg)
+                        .withName("FlowIdentifier")
+                        .withKeyBy([](const packet_t& t) -> unsigned long { return eos::flowid_key(t); })   // spread evenly, the markers to their replica
+                        .withOutputBatchSize(batch_size)
+                        .build();
+                pipe->add(flowid);
+            } else {
+                FlowId_Functor<def> flowid_fun;                   // flow identifier operator
+                wf::Map flowid = wf::Map_Builder(flowid_fun)
+                        .withParallelism(flowid_pardeg)
+                        .withName("FlowIdentifier")
+                        .withOutputBatchSize(batch_size)
+                        .build();
+                pipe->add(flowid);
+            }
+        });
+        if (!queries.empty()) {     // parsing and flow keys are shared: the heavy hitter pipeline continues in the first branch
+            wf::FlatMap fan_out = wf::FlatMap_Builder(query::Fan_Out(queries))    // one copy per branch (chained to the flow identifier)
+                    .withParallelism(flowid_pardeg)
+                    .withName("QueryFanOut")
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->chain(fan_out);
+            pipe->split(query::Splitter(), queries.size() + 1);
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                add_query(pipe->select(i + 1), queries[i]);
+            }
+            pipe = &pipe->select(0);
+        }
+        if (preagg_ms > 0) {
+            Pre_Aggregator_Functor preagg_fun((uint64_t)(preagg_ms * 1000));      // partial sums of the flows (chained to the flow identifier)
+            wf::FlatMap preagg = wf::FlatMap_Builder(preagg_fun)
+                    .withParallelism(flowid_pardeg)
+                    .withName("PreAggregator")
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->chain(preagg);
+        }
+        if (sketch_mode) {
+            Sketch_Functor sketch_fun(sketch_width, sketch_depth, win_length * 1000, win_slide * 1000);   // window sketches (heavy hitter detection)
+            wf::FlatMap sketch = wf::FlatMap_Builder(sketch_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("Sketch")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.flow_key; })     // stream is partitioned on keys (flow id, the markers on their replica)
+                    .withOutputBatchSize((chaining) ? 0 : batch_size)
+                    .build();
+            pipe->add(sketch);
+            last_pardeg = winacc_pardeg;
+        } else if (hhh_mode) {
+            HHH_Functor hhh_fun(hhh_dim, win_length * 1000, win_slide * 1000);    // hierarchical heavy hitter detector
+            wf::FlatMap hhh = wf::FlatMap_Builder(hhh_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("HierarchicalHeavyHitterDetector")
+                    .withKeyBy([hhh_dim](const flow_len_t& t) -> unsigned long {       // stream is partitioned on the /8 prefixes (the markers on their replica)
+                        if (eos::is_marker(t)) return t.flow_key;
+                        return prefix::key(hhh_dim, 8, ntohl((hhh_dim == prefix::dim_t::SRC) ? t.ip_src : t.ip_dst));
+                    })
+                    .withOutputBatchSize((chaining) ? 0 : batch_size)
+                    .build();
+            pipe->add(hhh);
+            hh_stats::prefix_results = true;
+            last_pardeg = winacc_pardeg;
+        } else if (acc_mode == "inc") {
+            WinAcc_Inc_Functor winacc_fun;                     // per-flow byte length accumulator (incremental)
+            wf::Keyed_Windows win_acc = wf::Keyed_Windows_Builder(winacc_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("ByteLenAccumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.flow_key; })     // stream is logically partitioned on keys (flow id)
+                    .withTBWindows(std::chrono::microseconds(win_length * 1000), std::chrono::microseconds(win_slide * 1000))
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(win_acc);
+        } else if (gpu_mode) {
+#ifdef HH_GPU
+            WinAcc_Lift_GPU_Functor lift_fun;                  // per-flow byte length accumulator (pane-based, on the GPU)
+            WinAcc_Comb_GPU_Functor comb_fun;
+            wf::Ffat_Windows_GPU win_acc = wf::Ffat_Windows_GPU_Builder(lift_fun, comb_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("ByteLenAccumulator")
+                    .withKeyBy(Flow_Key_GPU())                   // stream is logically partitioned on keys (flow id)
+                    .withTBWindows(std::chrono::microseconds(win_length * 1000), std::chrono::microseconds(win_slide * 1000))
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(win_acc);
+#endif
+        } else if (acc_mode == "table") {
+            WinAcc_Table_Functor winacc_fun(win_length * 1000, win_slide * 1000, (uint64_t)(idle_timeout_ms * 1000),
+                                            (expected_flows + winacc_pardeg - 1) / winacc_pardeg);     // per-flow byte length accumulator (flow table)
+            wf::FlatMap win_acc = wf::FlatMap_Builder(winacc_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("ByteLenAccumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.flow_key; })     // stream is logically partitioned on keys (flow id, the markers on their replica)
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(win_acc);
+        } else if (acc_mode == "ffat") {
+            WinAcc_Lift_Functor lift_fun;                      // per-flow byte length accumulator (pane-based)
+            WinAcc_Comb_Functor comb_fun;
+            wf::Ffat_Windows win_acc = wf::Ffat_Windows_Builder(lift_fun, comb_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("ByteLenAccumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.flow_key; })     // stream is logically partitioned on keys (flow id)
+                    .withTBWindows(std::chrono::microseconds(win_length * 1000), std::chrono::microseconds(win_slide * 1000))
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(win_acc);
+        } else {
+            WinAcc_Functor winacc_fun;                         // per-flow byte length accumulator (non incremental)
+            wf::Keyed_Windows win_acc = wf::Keyed_Windows_Builder(winacc_fun)
+                    .withParallelism(winacc_pardeg)
+                    .withName("ByteLenAccumulator")
+                    .withKeyBy([](const flow_len_t& t) -> unsigned long { return t.flow_key; })     // stream is logically partitioned on keys (flow id)
+                    .withTBWindows(std::chrono::microseconds(win_length * 1000), std::chrono::microseconds(win_slide * 1000))
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(win_acc);
+        }
+        if (topk_mode == "global") {
+            TopK_Functor topk_fun(topk);                   // K largest flows of each window in each replica
+            wf::FlatMap topk_op = wf::FlatMap_Builder(topk_fun)
+                    .withParallelism(detector_pardeg)
+                    .withName("TopK")
+                    .withOutputBatchSize(batch_size)
+                    .build();
+            pipe->add(topk_op);
+            TopK_Merge_Functor merge_fun(detector_pardeg, topk);   // K largest flows of each window
+            wf::FlatMap merge = wf::FlatMap_Builder(merge_fun)
+                    .withParallelism(1)
+                    .withName("TopKMerge")
+                    .withOutputBatchSize((chaining) ? 0 : batch_size)
+                    .build();
+            pipe->add(merge);
+            last_pardeg = 1;
+        } else if (topk_mode == "dst") {
+            TopK_Dst_Functor topk_fun(topk);               // K largest flows towards each destination in each window
+            wf::FlatMap topk_op = wf::FlatMap_Builder(topk_fun)
+                    .withParallelism(detector_pardeg)
+                    .withName("TopK")
+                    .withKeyBy([](const hh_result_t& t) -> unsigned long { return t.ip_dst; })    // stream is partitioned on the destinations
+                    .withOutputBatchSize((chaining) ? 0 : batch_size)
+                    .build();
+            pipe->add(topk_op);
+        }
+    }
+
+    /// sink operator, of the type of the tuples it receives (added to the multipipe, or chained to the preceding operator)
+    auto add_sink = [&](auto sink_fun) {
         wf::Sink sink = wf::Sink_Builder(sink_fun)
                 .withParallelism(sink_pardeg)
                 .withName("Sink")
                 .build();
-        mp.chain_sink(sink);
+        if (chaining) {
+            pipe->chain_sink(sink);
+        } else {
+            pipe->add_sink(sink);
+        }
+    };
+
+    /// heavy hitter detector (batching of its output disabled when the sink is chained to it)
+    const std::size_t detector_batch_size = (chaining) ? 0 : batch_size;
+    if (!two_ops && !sketch_mode && !hhh_mode && !fused && topk_mode.empty()) {
+        if (vectorized) {
+            Detector_Batch_Functor detector_batch_fun(vector_batcher);    // heavy hitter detector operator (batch version)
+            wf::FlatMap detector_batch = wf::FlatMap_Builder(detector_batch_fun)
+                    .withParallelism(detector_pardeg)
+                    .withName("HeavyHitterDetector")
+                    .withOutputBatchSize(detector_batch_size)
+                    .build();
+            pipe->add(detector_batch);
+        } else if (change_only) {
+            Detector_Change_Functor detector_change_fun((win_length + win_slide) * 1000000);   // heavy hitter detector operator (changes only)
+            wf::FlatMap detector_change = wf::FlatMap_Builder(detector_change_fun)
+                    .withParallelism(detector_pardeg)
+                    .withName("HeavyHitterDetector")
+                    .withKeyBy([](const hh_result_t& t) -> unsigned long { return t.flow_key; })     // each replica keeps the heavy hitters of its flows
+                    .withOutputBatchSize(detector_batch_size)
+                    .build();
+            pipe->add(detector_change);
+        } else {
+            Detector_Functor detector_fun;                     // heavy hitter detector operator
+            wf::Filter detector = wf::Filter_Builder(detector_fun)
+                    .withParallelism(detector_pardeg)
+                    .withName("HeavyHitterDetector")
+                    .withOutputBatchSize(detector_batch_size)
+                    .build();
+            pipe->add(detector);
+        }
+    }
+    if (two_ops) {
+        add_sink(Sink_Functor<packet_t>());
+    } else {
+        add_sink(Sink_Functor<hh_result_t>());
     }
 
     /// execution summary
     std::stringstream summary;
+    auto ms_of = [](const uint64_t ns) {
+        std::ostringstream s;
+        s << ns / 1e6;
+        return s.str();
+    };
+    std::string zipf_shares;        // effective distribution of the synthetic flows (the replicas emit at the same rate)
+    if (!generate.empty() && source_pardeg * traffic_spec.shares > 1) {
+        const auto [low, high] = traffic::replica_shares(traffic_spec, source_pardeg);
+        std::ostringstream ss;
+        ss << std::setprecision(3) << ", zipf mass of a replica from " << low * 100 << "% to " << high * 100 << "% (the flows of a replica are scaled by 1 / (replicas * mass))";
+        zipf_shares = ss.str();
+    }
     summary << "Executing HH application configured as:\n"
-            << "* source rate: " << ((rate == 0) ? "max speed" : std::to_string(rate)) << " (tuples/s)\n"
+            << "* input: " << ((!generate.empty()) ? "synthetic traffic, " + traffic_spec.to_string() + zipf_shares
+                             : (interface.empty()) ? input_pcap_file + ((trace_input) ? " (pre-parsed trace)" : "")
+                                                     + ((streaming && !trace_input) ? " (streaming, " + std::to_string(prefetch_mb) + " MB prefetch window)" : "")
+                                                     + ((streaming && trace_input) ? " (streaming)" : "")
+                                                     + ((!streaming && !shard.empty()) ? " (sharded by " + shard + ")" : "")
+                                                     + ((multi_input) ? " (" + std::to_string(input_files.size()) + " inputs, split among the source replicas)" : "")
+                                 : (interface.find_first_of(":,") != std::string::npos) ? "live capture from " + interface + ((zero_copy) ? " (zero-copy)" : "")
+                                                   : "live capture from " + interface
+                                 + " (RX queues " + std::to_string(first_queue) + "-" + std::to_string(first_queue + source_pardeg - 1)
+                                 + ((zero_copy) ? ", zero-copy" : "") + ")") << "\n"
+            << "* source rate: " << source_pacer.describe(rate) << "\n"
+            << "* time policy: " << ((event_mode) ? "event time (allowed lateness " + std::to_string(lateness_ms) + " ms)" : "ingress time") << "\n"
             << "* batch size: " << batch_size << "\n"
+            << "* clock: " << tsc::clock_source.describe() << ", latency marker on 1 tuple every " << latency_sampling
+            << ((stage_trace_period > 0) ? ", stage tracing of 1 marked tuple every " + std::to_string(stage_trace_period) : "") << "\n"
+            << "* runtime: " << ((bare_mode) ? "bare (dedicated threads, Iffq rings)" : "WindFlow") << "\n"
+            << "* nodes: " << ((node.enabled()) ? "node " + std::to_string(node.id) + " of " + std::to_string(node.nodes)
+                                                  + ", summary to " + node.host + ":" + std::to_string(node.port) : "single node") << "\n"
             << "* chaining: " << ((chaining) ? "ON" : "OFF") << "\n"
-            << "* topology: source(" << source_pardeg << ") -> ";
-#ifndef TWO_OPS
-    summary << "flow_id(" << flowid_pardeg << ") -> "
-            << "byte_len_acc(" << winacc_pardeg << ") -> "
-            << "detector(" << detector_pardeg << ") -> ";
-#endif
+            << "* placement: " << ((placement_spec.empty()) ? "runtime" : placement_spec) << "\n"
+            << "* vectorized operators: " << ((!vectorized) ? "OFF" : (batch_slo.enabled())
+                ? "ON (adaptive batches of up to " + std::to_string(batch_slo.max_batch) + " tuples, p99 target " + ms_of(batch_slo.p99_ns)
+                  + " ms, flush after " + ms_of(batch_slo.flush_ns) + " ms)"
+                : "ON (batches of " + std::to_string(vector_batch) + " tuples)") << "\n"
+            << "* gpu offload: " << ((gpu_mode) ? "flow identifier and windows (batches of " + std::to_string(gpu_batch) + " tuples)" : "OFF") << "\n"
+            << "* topology: source(" << source_pardeg << ((sampling::spec.enabled()) ? " + sampler" : "") << ") -> ";
+    if (two_ops) {
+        /// the sources are directly connected to the sink
+    } else if (fused) {
+        summary << "fused(" << source_pardeg << ") -> ";
+    } else {
+        summary << ((gpu_mode) ? "gpu_stage(" + std::to_string(source_pardeg) + ") -> " : "")
+                << "flow_id(" << flowid_pardeg << ((preagg_ms > 0) ? " + pre_aggregation" : "") << ((gpu_mode) ? ", gpu" : "") << ") -> ";
+        if (hhh_mode) {
+            summary << "hhh_detector(" << winacc_pardeg << ") -> ";
+        } else if (sketch_mode) {
+            summary << "sketch(" << winacc_pardeg << ") -> ";
+        } else {
+            summary << "byte_len_acc(" << winacc_pardeg << ((gpu_mode) ? ", gpu" : "") << ") -> ";
+            if (topk_mode == "global") {
+                summary << "top_k(" << detector_pardeg << ") -> top_k_merge(1) -> ";
+            } else if (topk_mode == "dst") {
+                summary << "top_k(" << detector_pardeg << ") -> ";
+            } else {
+                summary << "detector(" << detector_pardeg << ") -> ";
+            }
+        }
+    }
     summary << "sink(" << sink_pardeg << ")\n";
-#ifndef TWO_OPS
-    summary << "* windows: length " << win_length << " ms, slide " << win_slide << " ms\n";
-#endif
+    for (const auto& q : queries) {
+        summary << "* query " << query::name(q.kind) << ": flow_id(" << flowid_pardeg << ") -> " << query::name(q.kind) << "_acc(" << winacc_pardeg << ") -> "
+                << query::name(q.kind) << "_detector(" << detector_pardeg << ") -> sink(" << sink_pardeg << "), " << query::keys(q.kind) << " above "
+                << q.threshold << " " << query::unit(q.kind) << " in windows of " << q.win_ms << " ms, slide " << q.slide_ms << " ms\n";
+    }
+
+    /// threads running the replicas (the chained operators run in the thread of the preceding one)
+    std::size_t threads = source_pardeg + sink_pardeg;
+    if (!two_ops && !fused) threads += flowid_pardeg + winacc_pardeg + ((hhh_mode || sketch_mode) ? 0 : detector_pardeg) + ((topk_mode == "global") ? 1 : 0);
+    if (chaining && last_pardeg == sink_pardeg) threads -= sink_pardeg;
+    threads += queries.size() * (winacc_pardeg + detector_pardeg + ((chaining && detector_pardeg == sink_pardeg) ? 0 : sink_pardeg));
+    summary << "* threads: " << threads << "\n";
+    summary << "* run time: " << duration_s << " s";
+    if (generations > 0) summary << ", at most " << generations << " generation" << ((generations > 1) ? "s" : "") << " of the input";
+    if (fenced) {
+        summary << " (measures after " << warmup_s << " s of warm-up, over "
+                << (measure::end_ns - measure::begin_ns) / 1e9 << " s)";
+    }
+    summary << "\n";
+    if (live_ms > 0) {
+        summary << "* live metrics: every " << live_ms << " ms to " << live_file
+                << ((prometheus_port > 0) ? " (Prometheus endpoint on port " + std::to_string(prometheus_port) + ")" : "") << "\n";
+    } else if (prometheus_port > 0) {
+        summary << "* live metrics: OFF (the Prometheus endpoint requires -L)\n";
+    }
+    if (alerts::writer.enabled()) {
+        summary << "* alerts: " << alerts::writer.describe() << "\n";
+    }
+    if (!two_ops) {
+        if (sampling::spec.enabled()) {
+            summary << "* sampling: 1 in " << sampling::spec.rate << ((sampling::spec.mode == sampling::mode_t::PACKET) ? " packets (lengths scaled by the rate)" : " flows (hash of the flow key)") << "\n";
+        }
+        if (preagg_ms > 0) {
+            summary << "* pre-aggregation: partial sums of the flows over " << preagg_ms << " ms sub-intervals\n";
+        }
+        if (hhh_mode) {
+            summary << "* detection: hierarchical heavy hitters over the /8, /16, /24, /32 " << prefix::dim_to_string(hhh_dim) << " prefixes\n";
+        } else {
+            summary << "* flow definition: " << flow::def_to_string(flow_def) << "\n";
+        }
+        if (by_address && (!interface.empty() || (streaming && !trace_input))) {
+            summary << "* IPv6 packets: skipped (analysis by address)\n";
+        }
+        summary << "* windows: length " << win_length << " ms, slide " << win_slide << " ms"
+                << ((sketch_mode || hhh_mode) ? "" : (acc_mode == "inc") ? " (incremental)" : (acc_mode == "ffat") ? " (pane-based)" : (gpu_mode) ? " (pane-based, on the GPU)"
+                : (acc_mode == "table") ? " (flow table, " + std::to_string(expected_flows) + " expected flows, idle timeout " + std::to_string((long)idle_timeout_ms) + " ms)" : " (non incremental)") << "\n";
+        if (change_only) {
+            summary << "* detection: changes of the heavy hitter set of each detector replica (new, raised and cleared flows)\n";
+        }
+        if (!topk_mode.empty()) {
+            summary << "* detection: top-" << topk << " flows of each window" << ((topk_mode == "dst") ? " and destination" : "") << "\n";
+        }
+        if (sketch_mode) {
+            using sketch::Window_Count_Min;
+            summary << "* detection: Count-Min sketch " << Window_Count_Min::round_width(sketch_width) << "x" << sketch_depth
+                    << " (epsilon " << Window_Count_Min::epsilon(sketch_width) << ", delta " << Window_Count_Min::delta(sketch_depth) << ", "
+                    << (Window_Count_Min::memory(sketch_width, sketch_depth, (win_length + win_slide - 1) / win_slide) * winacc_pardeg) / 1024
+                    << " KB in total)\n";
+        }
+    }
     std::cout << summary.str() << std::endl;;
 
-    /// evaluate topology execution time
+    /// periodic export of the counters of the replicas while the topology runs
+    std::unique_ptr<metrics::Live_Reporter> live_reporter;
+    if (live_ms > 0) {
+        try {
+            live_reporter = std::make_unique<metrics::Live_Reporter>(metrics::registry, live_ms, live_file, prometheus_port);
+            live_reporter->start();     // opens the Prometheus endpoint (-X), which can be in use
+        } catch (const std::exception& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /// streaming output of the heavy hitters (writer thread draining the rings of the sinks)
+    if (alerts::writer.enabled()) {
+        try {
+            alerts::writer.start();
+        } catch (const std::runtime_error& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /// latency of the sinks observed by the adaptive batching
+    if (batch_slo.enabled()) adaptive::monitor.start();
+
+    /// evaluate topology execution time (and CPU time of all the threads)
+    measure::Steady_State steady_state(metrics::registry, [] { return tsc::now(); });
+    if (fenced) steady_state.start();
+    struct rusage usage_start, usage_end;
+    getrusage(RUSAGE_SELF, &usage_start);
     volatile unsigned long start_time_main_usecs = wf::current_time_usecs();
-    topology.run();
+    if (bare_pipeline) {
+        bare_pipeline->run();
+    } else {
+        topology.run();
+    }
     volatile unsigned long end_time_main_usecs = wf::current_time_usecs();
+    getrusage(RUSAGE_SELF, &usage_end);
+    steady_state.stop();
+    if (live_reporter) live_reporter->stop();
+    alerts::writer.stop();
+    adaptive::monitor.stop();
     double elapsed_time_seconds = (double)(end_time_main_usecs - start_time_main_usecs) / (1000000.0);
     std::cout << "Exiting..." << std::endl;
 
     /// evaluate throughput
-    double throughput = (double)sent_tuples / elapsed_time_seconds;
-    double source_bw = (double)sent_tuples / ((source_exec_time.get() / 1000.0) / (double)source_pardeg);
-    double sink_bw = (double)received_tuples / ((sink_exec_time.get() / 1000.0) / (double)latency_aggr.get_active_sinks());
+    /// (tuple counts and execution times are summed over the registry slots of the replicas)
+    const metrics::Registry::totals_t sources = metrics::registry.total("Source");
+    const metrics::Registry::totals_t sinks = metrics::registry.total("Sink");
+    double throughput = (double)sources.tuples_out / elapsed_time_seconds;
+    double source_bw = (double)sources.tuples_out / ((sources.exec_time / 1e9) / (double)source_pardeg);
+    double sink_bw = (double)sinks.tuples_in / ((sinks.exec_time / 1e9) / (double)latency_aggr.get_active_sinks());
+    if (fenced) {       // rates over the measurement interval, when all the replicas are running
+        const double secs = steady_state.seconds();
+        if (!steady_state.is_complete()) {
+            std::cout << "[MEASURE] the run ended before the end of the measurement interval (" << secs << " s measured)" << std::endl;
+        }
+        throughput = (secs > 0) ? steady_state.sent() / secs : 0;
+        source_bw = throughput;
+        sink_bw = (secs > 0) ? steady_state.received() / secs : 0;
+    }
     std::cout << "[MEASURE] throughput: " << (int) throughput << " tuples/second" << std::endl;
+    std::cout << "[MEASURE] throughput per thread: " << (int) (throughput / threads) << " tuples/second" << std::endl;
     std::cout << "[MEASURE] throughput at source node: " << (int) source_bw << " tuples/second" << std::endl;
     std::cout << "[MEASURE] throughput at sink node: " << (int) sink_bw << " tuples/second" << std::endl;
+    if (source_max_rate > 0) {
+        std::cout << "[MEASURE] source max emit rate: " << (int) source_max_rate << " tuples/second per replica (bulk emission, without the runtime)" << std::endl;
+    }
+    auto cpu_seconds = [](const struct rusage& u) {
+        return u.ru_utime.tv_sec + u.ru_stime.tv_sec + (u.ru_utime.tv_usec + u.ru_stime.tv_usec) / 1000000.0;
+    };
+    const double cpu_util = (fenced) ? steady_state.cpu_util()
+                                     : (cpu_seconds(usage_end) - cpu_seconds(usage_start)) / elapsed_time_seconds;     // busy cores on average
+    std::cout << "[MEASURE] cpu utilisation: " << cpu_util << " cores" << std::endl;
+    const double gpu_fill_ms = (gpu_mode && throughput > 0) ? gpu_batch * source_pardeg / throughput * 1000 : 0;
+    if (gpu_mode) {     // a packet waits on average half of the time needed to fill its batch before reaching the GPU
+        std::cout << "[MEASURE] gpu batch fill time: " << gpu_fill_ms << " ms (" << gpu_batch << " tuples per batch)" << std::endl;
+    }
 
     /// print heavy hitter reports
+    if (sampling::spec.enabled()) {
+        sampling::outcome.collect(metrics::registry);      // error bounds of the estimates in the sink reports
+    }
     result_aggr.dump_per_sink();
     std::size_t hh_hosts = result_aggr.dump_aggregated();
+    if (sampling::spec.enabled()) {
+        sampling::outcome.write_summary(std::cout, threshold);
+    }
+    if (!two_ops && sketch_mode) {
+        std::cout << "[MEASURE] sketch error bound: +" << (uint64_t)(sketch::Window_Count_Min::epsilon(sketch_width) * sketch_window_bytes.load())
+                  << " bytes per flow and window (probability " << 1.0 - sketch::Window_Count_Min::delta(sketch_depth) << ")" << std::endl;
+    }
 
     /// evaluate latency (average time required by a tuple to traverse the whole system)
     //start_time_main_usecs = current_time_usecs();
@@ -283,7 +1485,117 @@ int main(int argc, char* argv[]) {
     //end_time_main_usecs = current_time_usecs();
     //std::cout << "[MEASURE] latency evaluation required " << (double)(end_time_main_usecs - start_time_main_usecs) / (1000000.0) << " seconds." << std::endl;
     std::cout << "[MEASURE] average latency: " << std::fixed << std::setprecision(5) << latency << " ms" <<  std::endl;
+    const metrics::Histogram& lat_hist = latency_aggr.get_histogram();
+    std::cout << "[MEASURE] latency percentiles: " << lat_hist.percentile(0.5) / 1000000.0 << " ms (p50), "
+              << lat_hist.percentile(0.99) / 1000000.0 << " ms (p99), "
+              << lat_hist.percentile(0.999) / 1000000.0 << " ms (p99.9), "
+              << lat_hist.max() / 1000000.0 << " ms (max)" << std::endl;
+    if (stage_trace::tracer.enabled()) {
+        stage_trace::tracer.write_summary(std::cout);
+    }
     std::cout << "[RESULTS] heavy hitter hosts (no duplicates): " << hh_hosts << std::endl;
+    std::vector<std::size_t> query_hits;
+    for (const auto& q : queries) {
+        query_hits.push_back(query::write_report(std::cout, q));
+    }
+    if (alerts::writer.enabled()) {
+        std::cout << "[RESULTS] streamed alerts: " << alerts::writer.sent() << " written, " << alerts::writer.lost() << " lost" << std::endl;
+    }
+
+    /// load and service times of the operator replicas
+    metrics::write_operator_summary(std::cout, metrics::registry);
+    memory::write_summary(std::cout, metrics::registry);
+    arena::blocks.write_summary(std::cout);
+    if (placement::placement.has_records()) {
+        placement::placement.write_summary(std::cout);
+    }
+
+    /// record of the run (same field names in all the engines, see run_report.hpp)
+    if (!report_file.empty()) {
+        bench::Run_Report report;
+        report.add("engine", (bare_mode) ? "bare" : "windflow");
+        report.add("input_file", (!generate.empty()) ? "synthetic:" + generate : (interface.empty()) ? input_pcap_file : "live:" + interface);
+        report.add("detection", detection);
+        report.add("change_only", change_only);
+        report.add("load_s", load_s);
+        report.add("source_threads", source_pardeg);
+        report.add("flowid_threads", flowid_pardeg);
+        report.add("acc_threads", winacc_pardeg);
+        report.add("detector_threads", detector_pardeg);
+        report.add("sink_threads", sink_pardeg);
+        report.add("all_threads", threads);
+        report.add("chaining", chaining);
+        report.add("batch_len", batch_size);
+        report.add("batch_slo_p99_ms", batch_slo.p99_ns / 1e6);
+        report.add("win_len", win_length);
+        report.add("win_slide", win_slide);
+        report.add("win_implementation", acc_mode);
+        report.add("gpu_batch_len", (gpu_mode) ? (long)gpu_batch : 0L);
+        report.add("gpu_batch_fill_ms", gpu_fill_ms);
+        report.add("gen_rate", (rate > 0) ? rate : -1);
+        report.add("threshold", threshold);
+        report.add("app_runtime_s", duration_s);
+        report.add("warmup_s", warmup_s);
+        report.add("generations", generations);
+        report.add("measure_s", (fenced) ? steady_state.seconds() : elapsed_time_seconds);
+        report.add("elapsed_s", elapsed_time_seconds);
+        report.add("sent_tuples", (fenced) ? steady_state.sent() : sources.tuples_out);
+        report.add("received_tuples", (fenced) ? steady_state.received() : sinks.tuples_in);
+        report.add("throughput", throughput);
+        report.add("source_max_emit_rate", source_max_rate);
+        report.add("latency_mean_ms", latency);
+        report.add("latency_p50_ms", lat_hist.percentile(0.5) / 1000000.0);
+        report.add("latency_p99_ms", lat_hist.percentile(0.99) / 1000000.0);
+        report.add("latency_p999_ms", lat_hist.percentile(0.999) / 1000000.0);
+        report.add("latency_max_ms", lat_hist.max() / 1000000.0);
+        report.add("cpu_util", cpu_util);
+        report.add("heavy_hitters", hh_hosts);
+        for (const query::kind_t kind : {query::kind_t::SYN, query::kind_t::DDOS, query::kind_t::SCAN}) {      // -1 for the queries that did not run
+            long hits = -1;
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                if (queries[i].kind == kind) hits = query_hits[i];
+            }
+            report.add("query_" + query::name(kind), hits);
+        }
+        report.add("nodes", (node.enabled()) ? node.nodes : 1);
+        report.add("peak_rss_mb", memory::peak_rss_bytes() / 1048576.0);
+        report.add("state_mb", memory::state_bytes(metrics::registry) / 1048576.0);
+        report.add("sampling", sampling::spec.to_string());
+        report.add("sampling_kept", sampling::outcome.kept_fraction());
+        report.add("sampling_error_pct", sampling::outcome.relative_bound(threshold) * 100);
+        report.add("pages", arena::to_string(arena::blocks.pages()));
+        report.add("arena_peak_mb", arena::blocks.peak_mb());
+        report.add("arena_fallbacks", arena::blocks.fallback_blocks());
+        report.add("thp_mb", arena::thp_bytes() / 1048576.0);
+        report.add("trace_residency_p50_ms", stage_trace::tracer.residency_percentile(0.5));
+        report.add("trace_residency_p99_ms", stage_trace::tracer.residency_percentile(0.99));
+        report.add("trace_processing_p50_ms", stage_trace::tracer.processing_percentile(0.5));
+        report.add("trace_processing_p99_ms", stage_trace::tracer.processing_percentile(0.99));
+        report.append(report_file);
+    }
+
+    /// multi-node run: ship the summary of this node to the coordinator
+    if (node.enabled()) {
+        cluster::node_report_t node_summary;
+        node_summary.node = node.id;
+        node_summary.sent = (fenced) ? steady_state.sent() : sources.tuples_out;
+        node_summary.received = (fenced) ? steady_state.received() : sinks.tuples_in;
+        node_summary.measured_s = (fenced) ? steady_state.seconds() : elapsed_time_seconds;
+        node_summary.throughput = throughput;
+        node_summary.cpu_util = cpu_util;
+        node_summary.threads = threads;
+        node_summary.prefix_results = hh_stats::prefix_results;
+        node_summary.latencies = lat_hist;
+        if (const hh_stats::Results_Table* results = result_aggr.get_aggregated()) node_summary.results = *results;
+        node_summary.add_ip6_names();
+        try {
+            cluster::send_report(node, node_summary);
+        } catch (const std::runtime_error& e) {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Summary sent to the coordinator " << node.host << ":" << node.port << std::endl;
+    }
 
     return 0;
 }
\ No newline at end of file
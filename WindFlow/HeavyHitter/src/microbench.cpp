@@ -0,0 +1,436 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file   microbench.cpp
+ *
+ *  @brief Micro-benchmarks of the functors of the HH application, driven directly outside the PipeGraph.
+ *
+ *  Each stage runs the application logic of one operator on inputs prepared in memory (the packets
+ *  of a trace, or synthetic traffic), repeating passes over them for a minimum time, and reports the
+ *  time, the instructions, the cycles and the cache misses per tuple (the counters are read through
+ *  perf_event_open when the kernel grants them). Comparing the service times of the operators in a
+ *  run (see the operator summary) with these costs gives the overhead of the runtime, and the
+ *  kernels of the batch operators can be compared with the per-tuple functors. The Zipf sampler of
+ *  the synthetic traffic is also checked with a chi-square test against the exact weights of its ranks.
+ *
+ *  Usage: microbench.out [ -i input | -G traffic ] [ -n packets ] [ -f 2tuple|5tuple|src|dst ] [ -w window sizes ]
+ *                        [ -b batch ] [ -t threshold ] [ -T min ms per stage ] [ -s stage[,stage...] ]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <windflow.hpp>
+#include "tuples/wf_tuple.hpp"
+#include "tuples/hh_tuples.hpp"
+#include "parser/header_parser.hpp"
+#include "parser/pcap_parser.hpp"
+#include "parser/trace_file.hpp"
+#include "util/flow.hpp"
+#include "util/hh_stats.hpp"
+#include "util/metric.hpp"
+#include "util/perf_counters.hpp"
+#include "util/simd.hpp"
+#include "util/traffic.hpp"
+#include "util/tsc_clock.hpp"
+#include "nodes/flow_identifier.hpp"
+#include "nodes/accumulator.hpp"
+#include "nodes/detector.hpp"
+
+long threshold = 1500;
+volatile unsigned long app_start_time = 0;
+volatile unsigned long app_run_time = 0;
+
+namespace {
+
+    /// bytes of the synthetic frames decoded by the parser stage (ethernet, IPv4 and TCP headers)
+    constexpr std::size_t FRAME_LEN = 54;
+    constexpr std::size_t FRAME_STRIDE = 64;
+
+    /// result of a stage
+    struct result_t {
+        std::string stage;
+        uint64_t tuples = 0;
+        uint64_t ns = 0;
+        perf::sample_t counters;
+    };
+
+    /// keeps the outputs of the stages from being optimised away
+    volatile uint64_t digest = 0;
+
+    /**
+     * @brief Runs passes of a stage until the minimum time is reached, after a warm-up pass.
+     *
+     * @param name name of the stage
+     * @param tuples tuples processed by a pass
+     * @param min_ms minimum length of the measure
+     * @param pass one pass over the inputs of the stage
+     */
+    result_t run_stage(const std::string& name, const uint64_t tuples, const uint64_t min_ms, perf::Counters& counters, const std::function<void()>& pass) {
+        pass();
+        result_t r;
+        r.stage = name;
+        counters.start();
+        const uint64_t start = tsc::now();
+        do {
+            pass();
+            r.tuples += tuples;
+            r.ns = tsc::now() - start;
+        } while (r.ns < min_ms * 1000000);
+        r.counters = counters.stop();
+        return r;
+    }
+
+    /**
+     * @brief Writes an ethernet frame carrying the IPv4 and TCP headers of a packet.
+     */
+    void write_frame(const packet_t& p, u_char* frame) {
+        std::memset(frame, 0, FRAME_STRIDE);
+        struct ether_header* eth = reinterpret_cast<struct ether_header*>(frame);
+        eth->ether_type = htons(ETHERTYPE_IP);
+        struct ip* ip_hdr = reinterpret_cast<struct ip*>(frame + sizeof(struct ether_header));
+        ip_hdr->ip_v = 4;
+        ip_hdr->ip_hl = 5;
+        ip_hdr->ip_p = IPPROTO_TCP;
+        ip_hdr->ip_len = p.ip_len;
+        ip_hdr->ip_src.s_addr = p.ip_src;
+        ip_hdr->ip_dst.s_addr = p.ip_dst;
+        struct tcphdr* tcp_hdr = reinterpret_cast<struct tcphdr*>(frame + sizeof(struct ether_header) + 20);
+        tcp_hdr->th_sport = p.port_src;
+        tcp_hdr->th_dport = p.port_dst;
+        tcp_hdr->doff = 5;
+        tcp_hdr->syn = p.syn;
+    }
+
+    void write_table(std::ostream& out, const std::vector<result_t>& results, const perf::Counters& counters) {
+        out << "[MICROBENCH] " << std::left << std::setw(24) << "stage" << std::right << std::setw(14) << "tuples"
+            << std::setw(12) << "ns/tuple" << std::setw(14) << "instr/tuple" << std::setw(14) << "cycles/tuple"
+            << std::setw(8) << "IPC" << std::setw(14) << "LLC miss/tup" << std::setw(14) << "L1D miss/tup" << "\n";
+        for (const auto& r : results) {
+            auto per_tuple = [&r, &counters](const perf::event_t e) {
+                std::ostringstream s;
+                if (counters.counts(e)) s << std::fixed << std::setprecision(3) << (double)r.counters.value[e] / r.tuples;
+                else s << "n/a";
+                return s.str();
+            };
+            std::ostringstream ipc;
+            if (counters.counts(perf::CYCLES) && r.counters.value[perf::CYCLES] > 0) {
+                ipc << std::fixed << std::setprecision(2) << (double)r.counters.value[perf::INSTRUCTIONS] / r.counters.value[perf::CYCLES];
+            } else {
+                ipc << "n/a";
+            }
+            out << "[MICROBENCH] " << std::left << std::setw(24) << r.stage << std::right << std::setw(14) << r.tuples
+                << std::setw(12) << std::fixed << std::setprecision(2) << (double)r.ns / r.tuples
+                << std::setw(14) << per_tuple(perf::INSTRUCTIONS) << std::setw(14) << per_tuple(perf::CYCLES) << std::setw(8) << ipc.str()
+                << std::setw(14) << per_tuple(perf::CACHE_MISSES) << std::setw(14) << per_tuple(perf::L1D_MISSES) << "\n";
+        }
+        if (!counters.available()) {
+            out << "[MICROBENCH] hardware counters not available (check /proc/sys/kernel/perf_event_paranoid)\n";
+        }
+    }
+
+    /**
+     * @brief Checks the Zipf sampler with a chi-square test of its draws against the exact weights of the ranks.
+     *
+     * The ranks expected less than 5 times are pooled with the following ones. The statistic is turned into
+     * a standard normal score with the Wilson-Hilferty approximation.
+     *
+     * @param ranks ranks of the law
+     * @param exponent exponent of the law
+     * @param offset offset of the ranks (see traffic::Zipf)
+     * @param draws samples drawn
+     * @return z-score of the statistic (a score above 4 rejects the sampler, p < 3e-5)
+     */
+    double zipf_score(const uint64_t ranks, const double exponent, const double offset, const uint64_t draws) {
+        const traffic::Zipf zipf(ranks, exponent, offset);
+        traffic::Rng rng(1);
+        std::vector<uint64_t> observed(ranks, 0);
+        for (uint64_t i = 0; i < draws; i++) observed[zipf.sample(rng)]++;
+        const double mass = traffic::zipf_mass(ranks, exponent, offset);
+        double chi2 = 0, expected = 0, count = 0;
+        uint64_t bins = 0;
+        for (uint64_t k = 0; k < ranks; k++) {
+            expected += draws * std::pow(k + offset, -exponent) / mass;
+            count += observed[k];
+            if (expected < 5 && k + 1 < ranks) continue;
+            chi2 += (count - expected) * (count - expected) / expected;
+            bins++;
+            expected = count = 0;
+        }
+        const double dof = std::max<uint64_t>(bins, 2) - 1;
+        return (std::cbrt(chi2 / dof) - (1 - 2 / (9 * dof))) / std::sqrt(2 / (9 * dof));
+    }
+
+    std::vector<std::size_t> parse_sizes(const std::string& list) {
+        std::vector<std::size_t> sizes;
+        std::stringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            const long v = atol(item.c_str());
+            if (v <= 0) throw std::invalid_argument("[microbench] ERR: bad window size " + item);
+            sizes.push_back(v);
+        }
+        return sizes;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string usage = "Usage: " + std::string(argv[0]) + " [ -i input | -G traffic ] [ -n packets ] [ -f 2tuple|5tuple|src|dst ] [ -w window sizes ] "
+                              "[ -b batch ] [ -t threshold ] [ -T min ms per stage ] [ -s stage[,stage...] ]";
+    std::string input, generate = "flows=100000";
+    std::size_t packets = 1000000;
+    flow::flow_def_t flow_def = flow::flow_def_t::TWO_TUPLE;
+    std::vector<std::size_t> win_sizes = {16, 256, 4096};
+    std::size_t batch = 64;
+    uint64_t min_ms = 500;
+    std::string stages;
+    int option;
+    while ((option = getopt(argc, argv, "i:G:n:f:w:b:t:T:s:h")) != -1) {
+        try {
+            switch (option) {
+                case 'i': input = optarg; break;
+                case 'G': generate = optarg; break;
+                case 'n': packets = std::max(1L, atol(optarg)); break;
+                case 'f':
+                    if (!flow::parse_def(optarg, flow_def)) throw std::invalid_argument("[microbench] ERR: unknown flow definition " + std::string(optarg));
+                    break;
+                case 'w': win_sizes = parse_sizes(optarg); break;
+                case 'b': batch = std::max(1L, atol(optarg)); break;
+                case 't': threshold = atol(optarg); break;
+                case 'T': min_ms = std::max(1L, atol(optarg)); break;
+                case 's': stages = "," + std::string(optarg) + ","; break;
+                default:
+                    std::cout << usage << std::endl;
+                    exit((option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE);
+            }
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    auto selected = [&stages](const std::string& name) {
+        return stages.empty() || stages.find("," + name + ",") != std::string::npos;
+    };
+
+    /// input packets: a trace (pcap or pre-parsed), or synthetic traffic
+    std::vector<packet_t> dataset;
+    try {
+        if (!input.empty()) {
+            std::vector<wf_tuple_t> parsed;
+            if (trace_file::is_trace_file(input)) {
+                parsed = trace_file::load(input);
+            } else {
+                PcapTransformer pcap_tran(input);
+                parsed = pcap_tran.toTupleDataset(0);
+            }
+            for (std::size_t i = 0; i < parsed.size() && dataset.size() < packets; i++) dataset.emplace_back(parsed[i]);
+        } else {
+            traffic::Generator gen(traffic::parse(generate), 0, 1);
+            dataset.resize(packets);
+            for (auto& p : dataset) gen.next(false, p);
+        }
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    if (dataset.empty()) {
+        std::cout << "[microbench] ERR: no TCP packets in the input." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    const std::size_t n = dataset.size();
+    std::cout << "[MICROBENCH] " << n << " packets from " << ((input.empty()) ? "synthetic traffic (" + generate + ")" : input)
+              << ", flow definition " << flow::def_to_string(flow_def) << ", batch " << batch << ", threshold " << threshold
+              << ", at least " << min_ms << " ms per stage, clock " << tsc::clock_source.describe() << std::endl;
+
+    perf::Counters counters;
+    std::vector<result_t> results;
+    wf::RuntimeContext rc(1, 0);
+
+    /// parser: decoding of the headers of a frame into a tuple (the work of PcapParser::parsePacket for each packet)
+    if (selected("parse")) {
+        std::vector<u_char> frames(n * FRAME_STRIDE);
+        for (std::size_t i = 0; i < n; i++) write_frame(dataset[i], frames.data() + i * FRAME_STRIDE);
+        results.push_back(run_stage("parse", n, min_ms, counters, [&frames, n] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                wf_tuple_t t;
+                if (header_parser::parse(frames.data() + i * FRAME_STRIDE, FRAME_LEN, t)) d += packet_t(t).ip_src;
+            }
+            digest += d;
+        }));
+    }
+
+    /// flow identifier: per-tuple functor, and the kernels of its batch version
+    std::vector<flow_len_t> flows(n);
+    flow::with_def(flow_def, [&](auto def) {
+        FlowId_Functor<def> flowid_fun;
+        for (std::size_t i = 0; i < n; i++) flows[i] = flowid_fun(dataset[i], rc);
+        if (selected("flowid")) {
+            results.push_back(run_stage("flowid", n, min_ms, counters, [&] {
+                uint64_t d = 0;
+                for (std::size_t i = 0; i < n; i++) d += flowid_fun(dataset[i], rc).flow_key;
+                digest += d;
+            }));
+        }
+        if (selected("flowid-batch")) {
+            std::vector<uint32_t> ip_src(n), ip_dst(n), total_len(n);
+            std::vector<uint16_t> port_src(n), port_dst(n), ip_len(n);
+            std::vector<uint8_t> protocol(n);
+            std::vector<uint64_t> keys(n);
+            for (std::size_t i = 0; i < n; i++) {
+                ip_src[i] = dataset[i].ip_src;
+                ip_dst[i] = dataset[i].ip_dst;
+                port_src[i] = dataset[i].port_src;
+                port_dst[i] = dataset[i].port_dst;
+                ip_len[i] = dataset[i].ip_len;
+                protocol[i] = dataset[i].protocol;
+            }
+            results.push_back(run_stage("flowid-batch", n, min_ms, counters, [&] {
+                for (std::size_t i = 0; i < n; i += batch) {
+                    const std::size_t b = std::min(batch, n - i);
+                    flow::key_batch<def>(b, ip_src.data() + i, ip_dst.data() + i, port_src.data() + i, port_dst.data() + i, protocol.data() + i, keys.data() + i);
+                    simd::lengths(b, ip_len.data() + i, total_len.data() + i);
+                }
+                digest += keys[n - 1] + total_len[n - 1];
+            }));
+        }
+    });
+
+    /// window accumulators: non incremental on windows of the given sizes, incremental per tuple
+    for (const std::size_t size : win_sizes) {
+        const std::string name = "winacc-" + std::to_string(size);
+        if (!selected(name) && !selected("winacc")) continue;
+        std::deque<flow_len_t> archive;
+        for (std::size_t i = 0; i < size; i++) archive.push_back(flows[i % n]);
+        const wf::Iterable<flow_len_t> win(archive.begin(), archive.end());
+        WinAcc_Functor winacc_fun;
+        const std::size_t windows = std::max<std::size_t>(1, n / size);
+        results.push_back(run_stage(name, windows * size, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t w = 0; w < windows; w++) {
+                hh_result_t t;
+                winacc_fun(win, t, rc);
+                d += t.acc_len;
+            }
+            digest += d;
+        }));
+    }
+    if (selected("winacc-inc")) {
+        WinAcc_Inc_Functor winacc_fun;
+        results.push_back(run_stage("winacc-inc", n, min_ms, counters, [&] {
+            hh_result_t t;
+            for (std::size_t i = 0; i < n; i++) winacc_fun(flows[i], t, rc);
+            digest += t.acc_len;
+        }));
+    }
+
+    /// window results around the threshold (one every 8 flows above it)
+    std::vector<hh_result_t> window_results(n);
+    for (std::size_t i = 0; i < n; i++) {
+        hh_result_t& r = window_results[i];
+        r.ts = flows[i].ts | 2;
+        r.flow_key = flows[i].flow_key;
+        r.ip_src = flows[i].ip_src;
+        r.ip_dst = flows[i].ip_dst;
+        r.acc_len = (flow::mix64(r.flow_key) % 8 == 0) ? threshold + flows[i].total_len : flows[i].total_len % std::max(threshold, 1L);
+    }
+
+    /// detector: per-tuple filter, and the kernel of its batch version
+    if (selected("detector")) {
+        Detector_Functor detector_fun;
+        results.push_back(run_stage("detector", n, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i++) d += detector_fun(window_results[i], rc);
+            digest += d;
+        }));
+    }
+    if (selected("detector-batch")) {
+        std::vector<uint64_t> acc_len(n);
+        std::vector<uint32_t> picked(batch);
+        for (std::size_t i = 0; i < n; i++) acc_len[i] = window_results[i].acc_len;
+        results.push_back(run_stage("detector-batch", n, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i += batch) {
+                d += simd::select_above(std::min(batch, n - i), acc_len.data() + i, (uint64_t)std::max(threshold, 0L), picked.data());
+            }
+            digest += d;
+        }));
+    }
+
+    /// sink: heavy hitter collection and latency collection of a replica
+    if (selected("results-collector")) {
+        hh_stats::Results_Collector collector;
+        results.push_back(run_stage("results-collector", n, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i++) d += (uint64_t)collector.update(window_results[i]);
+            digest += d;
+        }));
+    }
+    if (selected("metrics-collector")) {
+        metrics::Metrics_Collector collector;
+        std::vector<hh_result_t> marked(window_results);
+        const uint64_t now = tsc::now();
+        for (std::size_t i = 0; i < n; i++) marked[i].ts = (now - (i % 1000) * 1000) | 1;     // latencies of up to a millisecond
+        results.push_back(run_stage("metrics-collector", n, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i++) d += collector.update(marked[i]);
+            digest += d;
+        }));
+    }
+
+    /// Zipf sampler of the synthetic traffic: chi-square check of the global law (offset 1) and of the
+    /// ranks of the first of four replicas (offset 1/4), then the cost of a draw
+    bool rejected = false;
+    if (selected("zipf")) {
+        for (const double exponent : {0.0, 0.8, 1.0, 1.2}) {
+            for (const double offset : {1.0, 0.25}) {
+                const double z = zipf_score(1000, exponent, offset, 1000000);
+                std::cout << "[MICROBENCH] zipf chi-square (1000 ranks, exponent " << exponent << ", offset " << offset
+                          << "): z " << std::fixed << std::setprecision(2) << z << ((z > 4) ? " REJECTED" : "") << std::endl;
+                rejected |= z > 4;
+            }
+        }
+        const traffic::Zipf zipf(100000, 1.0);
+        traffic::Rng rng(1);
+        results.push_back(run_stage("zipf", n, min_ms, counters, [&] {
+            uint64_t d = 0;
+            for (std::size_t i = 0; i < n; i++) d += zipf.sample(rng);
+            digest += d;
+        }));
+    }
+
+    write_table(std::cout, results, counters);
+    return (rejected) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
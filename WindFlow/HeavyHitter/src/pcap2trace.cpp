@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Università di Pisa
+ * Copyright (C) 2022 Alessandra Fais
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ *  @file   pcap2trace.cpp
+ *
+ *  @brief One-time converter from a pcap dump file to the binary pre-parsed trace format.
+ *
+ *  The TCP packets of the dump file are decoded once and stored as trace records (see
+ *  parser/trace_file.hpp). The HH application, as well as the Flink, Storm and Spark
+ *  variants, recognize a trace file by its magic number and load it without parsing.
+ *  Optionally, the packets can also be exported in the standard or human-readable csv format.
+ *
+ *  Usage: pcap2trace.out <input.pcap> <output.hht> [--csv <file>] [--readable-csv <file>]
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <stdexcept>
+#include "parser/pcap_mmap_reader.hpp"
+#include "parser/trace_file.hpp"
+#include "parser/csv_writer.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || (argc % 2) != 1) {
+        std::cout << "Usage: " << argv[0] << " <input.pcap> <output.hht> [--csv <file>] [--readable-csv <file>]" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    const std::string input_pcap_file(argv[1]);
+    const std::string output_trace_file(argv[2]);
+    std::unique_ptr<Csv_Writer> csv, readable_csv;
+
+    try {
+        for (int i = 3; i < argc; i += 2) {
+            const std::string opt(argv[i]);
+            if (opt == "--csv") {
+                csv.reset(new Csv_Writer(argv[i + 1], false));
+            } else if (opt == "--readable-csv") {
+                readable_csv.reset(new Csv_Writer(argv[i + 1], true));
+            } else {
+                std::cerr << "Unknown option " << opt << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        Pcap_Mmap_Reader reader(input_pcap_file, 64 << 20);
+        reader.open();
+        trace_file::Trace_Writer trace(output_trace_file);
+        wf_tuple_t t;
+        while (reader.next(t)) {
+            trace.write(t);
+            if (csv) csv->write(t);
+            if (readable_csv) readable_csv->write(t);
+        }
+        trace.close();
+        std::cout << "Converted " << input_pcap_file << " into " << output_trace_file
+                  << " (" << trace.get_records() << " TCP packets)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return 0;
+}